@@ -0,0 +1,25 @@
+#version 330 core
+layout (location = 0) in uvec4 aPositionFace;
+layout (location = 1) in uvec2 aLightAO;
+layout (location = 2) in uint aTexture; // texture layer from the block registry
+
+uniform mat4 projection;
+uniform mat4 view;
+uniform vec3 chunkOffset; // chunk origin relative to the camera
+// flat colour per texture layer from the block registry; size matches ChunkRenderer::MAX_TEXTURE_LAYERS
+uniform vec3 textureColors[128];
+
+out vec3 vColor;
+
+// +X, -X, +Y, -Y, +Z, -Z
+const float FACE_SHADE[6] = float[6](0.8, 0.8, 1.0, 0.5, 0.9, 0.9);
+const float AO_SHADE[4] = float[4](0.45, 0.65, 0.85, 1.0);
+
+void main() {
+    float sky = float(aLightAO.x >> 4u) / 15.0;
+    float torch = float(aLightAO.x & 15u) / 15.0;
+    float light = 0.08 + 0.92 * pow(max(sky, torch), 1.6);
+
+    vColor = textureColors[min(aTexture, 127u)] * light * FACE_SHADE[aPositionFace.w] * AO_SHADE[aLightAO.y];
+    gl_Position = projection * view * vec4(chunkOffset + vec3(aPositionFace.xyz), 1.0);
+}
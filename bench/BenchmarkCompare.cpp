@@ -0,0 +1,199 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+// Compares two camera path benchmark reports (the benchmark.json a headless run writes) and
+// prints a markdown table of frame times, generation and meshing throughput and peak memory,
+// with the change from the baseline. Used by the PGO pipeline for its before/after report,
+// and just as useful by hand when checking any other change.
+//
+// Usage: silk_bench_compare baseline.json candidate.json [--out=report.md]
+//        [--baseline-name=text] [--candidate-name=text]
+//
+#include "tinygltf/json.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+using Json = nlohmann::json;
+
+struct Metric
+{
+    const char* label;
+    const char* group; // enclosing object, or null for a top-level value
+    const char* key;
+    bool higherIsBetter;
+    double scale = 1.0; // applied to the stored value before display
+};
+
+const Metric METRICS[] = {
+    {"Wall time (s)", nullptr, "wallSeconds", false},
+    {"Frame time mean (ms)", "frameTimeMs", "mean", false},
+    {"Frame time p50 (ms)", "frameTimeMs", "p50", false},
+    {"Frame time p95 (ms)", "frameTimeMs", "p95", false},
+    {"Frame time p99 (ms)", "frameTimeMs", "p99", false},
+    {"Frame time max (ms)", "frameTimeMs", "max", false},
+    {"Generation, whole path (columns/s)", "generation", "columnsPerSecond", true},
+    {"Generation, streamed (columns/s)", "generation", "streamedColumnsPerSecond", true},
+    {"Meshing (chunks/s)", "meshing", "chunksPerSecond", true},
+    {"Peak resident (MiB)", "memory", "peakResidentBytes", false, 1.0 / (1024.0 * 1024.0)},
+};
+
+// run settings that have to match for the numbers to mean anything side by side
+const char* const RUN_SETTINGS[] = {"path", "mode", "seed", "renderDistance", "workers", "timestep", "frames"};
+
+bool LoadReport(const std::string& path, Json& report)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open benchmark report: " << path << std::endl;
+        return false;
+    }
+
+    report = Json::parse(file, nullptr, false);
+    if (report.is_discarded() || !report.is_object())
+    {
+        std::cerr << "Failed to parse benchmark report: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Look up report[group][key], or report[key] without a group; null if either is missing
+ */
+const Json* Find(const Json& report, const char* group, const char* key)
+{
+    const Json* node = &report;
+    if (group)
+    {
+        const auto it = report.find(group);
+        if (it == report.end() || !it->is_object())
+            return nullptr;
+        node = &*it;
+    }
+
+    const auto it = node->find(key);
+    return it != node->end() ? &*it : nullptr;
+}
+
+bool GetNumber(const Json& report, const Metric& metric, double& value)
+{
+    const Json* node = Find(report, metric.group, metric.key);
+    if (!node || !node->is_number())
+        return false;
+
+    value = node->get<double>() * metric.scale;
+    return true;
+}
+
+std::string FormatChange(const Metric& metric, double baseline, double candidate)
+{
+    if (baseline == 0.0)
+        return "n/a";
+
+    const double change = (candidate - baseline) / std::fabs(baseline) * 100.0;
+    std::ostringstream text;
+    if (std::fabs(change) < 0.05)
+        return "0.0%";
+    text << std::showpos << std::fixed << std::setprecision(1) << change << "%" << std::noshowpos;
+    text << ((change > 0.0) == metric.higherIsBetter ? " (better)" : " (worse)");
+    return text.str();
+}
+
+void WriteReport(std::ostream& out, const Json& baseline, const Json& candidate, const std::string& baselineName,
+                 const std::string& candidateName)
+{
+    out << "# Benchmark comparison\n\n";
+    out << "Camera path `" << baseline.value("path", std::string("?")) << "`, "
+        << baseline.value("frames", 0) << " frames, " << baseline.value("mode", std::string("?")) << " mode.\n\n";
+
+    for (const char* setting : RUN_SETTINGS)
+    {
+        const Json* a = Find(baseline, nullptr, setting);
+        const Json* b = Find(candidate, nullptr, setting);
+        if (!a || !b || *a != *b)
+        {
+            out << "**Warning:** runs differ in `" << setting << "` (" << (a ? a->dump() : "missing") << " vs "
+                << (b ? b->dump() : "missing") << "), so they are not directly comparable.\n\n";
+        }
+    }
+
+    out << "| Metric | " << baselineName << " | " << candidateName << " | Change |\n";
+    out << "|---|---:|---:|---:|\n";
+    out << std::fixed << std::setprecision(3);
+    for (const Metric& metric : METRICS)
+    {
+        double a = 0.0;
+        double b = 0.0;
+        if (!GetNumber(baseline, metric, a) || !GetNumber(candidate, metric, b))
+            continue;
+        out << "| " << metric.label << " | " << a << " | " << b << " | " << FormatChange(metric, a, b) << " |\n";
+    }
+    out.unsetf(std::ios::fixed);
+}
+
+bool StartsWith(const std::string& text, const char* prefix)
+{
+    return text.compare(0, std::strlen(prefix), prefix) == 0;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::string paths[2];
+    int pathCount = 0;
+    std::string outPath;
+    std::string baselineName = "Baseline";
+    std::string candidateName = "Candidate";
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        const std::string value = argument.substr(argument.find('=') + 1);
+        if (StartsWith(argument, "--out="))
+            outPath = value;
+        else if (StartsWith(argument, "--baseline-name="))
+            baselineName = value;
+        else if (StartsWith(argument, "--candidate-name="))
+            candidateName = value;
+        else if (!StartsWith(argument, "--") && pathCount < 2)
+            paths[pathCount++] = argument;
+        else
+        {
+            std::cerr << "Unknown argument " << argument << std::endl;
+            return 1;
+        }
+    }
+    if (pathCount != 2)
+    {
+        std::cerr << "Usage: silk_bench_compare baseline.json candidate.json [--out=report.md]" << std::endl;
+        return 1;
+    }
+
+    Json baseline;
+    Json candidate;
+    if (!LoadReport(paths[0], baseline) || !LoadReport(paths[1], candidate))
+        return 1;
+
+    std::ostringstream report;
+    WriteReport(report, baseline, candidate, baselineName, candidateName);
+    std::cout << report.str();
+
+    if (!outPath.empty())
+    {
+        std::ofstream file(outPath, std::ios::trunc);
+        if (!file.is_open() || !(file << report.str()))
+        {
+            std::cerr << "Failed to write " << outPath << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,172 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "MicroBenchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+double Median(std::vector<double> values)
+{
+    if (values.empty())
+        return 0.0;
+
+    const std::size_t middle = values.size() / 2;
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(middle), values.end());
+    const double upper = values[middle];
+    if (values.size() % 2 == 1)
+        return upper;
+    return (upper + *std::max_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(middle))) / 2.0;
+}
+
+void WriteEscaped(std::ostream& out, const std::string& value)
+{
+    for (const char c : value)
+    {
+        if (c == '"' || c == '\\')
+            out << '\\';
+        out << c;
+    }
+}
+} // namespace
+
+MicroBenchmark::MicroBenchmark(const BenchmarkOptions& options)
+    : m_options(options)
+{
+    m_options.repetitions = std::max(m_options.repetitions, 1);
+    m_options.warmup = std::max(m_options.warmup, 0);
+}
+
+void MicroBenchmark::Add(const std::string& name, std::size_t elements, Body body)
+{
+    m_cases.push_back({name, std::max<std::size_t>(elements, 1), std::move(body)});
+}
+
+void MicroBenchmark::Run()
+{
+    m_results.clear();
+    for (const Case& benchmark : m_cases)
+    {
+        if (!m_options.filter.empty() && benchmark.name.find(m_options.filter) == std::string::npos)
+            continue;
+
+        m_results.push_back(Measure(benchmark));
+        const BenchmarkResult& result = m_results.back();
+        std::cerr << "  " << result.name << ": " << result.medianNs << " ns/element" << std::endl;
+    }
+}
+
+BenchmarkResult MicroBenchmark::Measure(const Case& benchmark) const
+{
+    // grow the batch until one repetition is long enough that clock reads are noise
+    std::size_t iterations = 1;
+    for (;;)
+    {
+        const auto start = Clock::now();
+        benchmark.body(iterations);
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if (seconds >= m_options.minRepetitionSeconds)
+            break;
+
+        const double scale = seconds > 0.0 ? m_options.minRepetitionSeconds * 1.2 / seconds : 10.0;
+        iterations = static_cast<std::size_t>(static_cast<double>(iterations) * std::clamp(scale, 2.0, 10.0));
+    }
+
+    for (int i = 0; i < m_options.warmup; ++i)
+    {
+        benchmark.body(iterations);
+    }
+
+    const double elements = static_cast<double>(iterations) * static_cast<double>(benchmark.elements);
+    std::vector<double> times;
+    std::vector<double> cycles;
+    times.reserve(m_options.repetitions);
+    cycles.reserve(m_options.repetitions);
+    for (int i = 0; i < m_options.repetitions; ++i)
+    {
+        const std::uint64_t startCycles = ReadCycleCounter();
+        const auto start = Clock::now();
+        benchmark.body(iterations);
+        const auto end = Clock::now();
+        const std::uint64_t endCycles = ReadCycleCounter();
+
+        times.push_back(std::chrono::duration<double, std::nano>(end - start).count() / elements);
+        cycles.push_back(static_cast<double>(endCycles - startCycles) / elements);
+    }
+
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.elements = benchmark.elements;
+    result.iterations = iterations;
+    result.repetitions = m_options.repetitions;
+    result.medianNs = Median(times);
+    result.minNs = *std::min_element(times.begin(), times.end());
+    result.cyclesPerElement = Median(cycles);
+
+    std::vector<double> deviations;
+    deviations.reserve(times.size());
+    for (const double time : times)
+    {
+        deviations.push_back(std::fabs(time - result.medianNs));
+    }
+    result.madNs = Median(deviations);
+    return result;
+}
+
+void MicroBenchmark::WriteText(std::ostream& out) const
+{
+    std::size_t nameWidth = 4;
+    for (const BenchmarkResult& result : m_results)
+    {
+        nameWidth = std::max(nameWidth, result.name.size());
+    }
+
+    out << std::left << std::setw(static_cast<int>(nameWidth)) << "case" << std::right << std::setw(14)
+        << "ns/element" << std::setw(10) << "MAD %" << std::setw(14) << "min ns" << std::setw(14)
+        << "cycles/elem" << std::setw(12) << "elements" << "\n";
+    for (const BenchmarkResult& result : m_results)
+    {
+        const double madPercent = result.medianNs > 0.0 ? 100.0 * result.madNs / result.medianNs : 0.0;
+        out << std::left << std::setw(static_cast<int>(nameWidth)) << result.name << std::right << std::fixed
+            << std::setprecision(3) << std::setw(14) << result.medianNs << std::setprecision(1) << std::setw(10)
+            << madPercent << std::setprecision(3) << std::setw(14) << result.minNs << std::setprecision(1)
+            << std::setw(14) << result.cyclesPerElement << std::setw(12) << result.elements << "\n";
+        out.unsetf(std::ios::fixed);
+    }
+}
+
+void MicroBenchmark::WriteJson(std::ostream& out) const
+{
+    out << "{\n  \"warmup\": " << m_options.warmup << ",\n  \"repetitions\": " << m_options.repetitions
+        << ",\n  \"cycleCounter\": " << (ReadCycleCounter() != 0 ? "true" : "false") << ",\n  \"results\": [";
+    for (std::size_t i = 0; i < m_results.size(); ++i)
+    {
+        const BenchmarkResult& result = m_results[i];
+        out << (i > 0 ? "," : "") << "\n    {\"name\": \"";
+        WriteEscaped(out, result.name);
+        out << "\", \"elements\": " << result.elements << ", \"iterations\": " << result.iterations
+            << ", \"medianNs\": " << result.medianNs << ", \"madNs\": " << result.madNs
+            << ", \"minNs\": " << result.minNs << ", \"cyclesPerElement\": " << result.cyclesPerElement << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+void MicroBenchmark::WriteCsv(std::ostream& out) const
+{
+    out << "name,elements,iterations,repetitions,median_ns,mad_ns,min_ns,cycles_per_element\n";
+    for (const BenchmarkResult& result : m_results)
+    {
+        out << result.name << "," << result.elements << "," << result.iterations << "," << result.repetitions
+            << "," << result.medianNs << "," << result.madNs << "," << result.minNs << ","
+            << result.cyclesPerElement << "\n";
+    }
+}
@@ -0,0 +1,123 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+// Minimal microbenchmark harness for silk_bench. Each case is calibrated to run long enough
+// per repetition to dwarf timer overhead, warmed up, then repeated; results are reported as
+// the median and median absolute deviation per element, which shrug off the odd
+// interrupted repetition that would drag a mean around.
+//
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/**
+ * Make the compiler assume value is read, so the work producing it can't be dropped
+ */
+template<typename T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(_MSC_VER)
+    const volatile char* sink = reinterpret_cast<const volatile char*>(&value);
+    (void)*sink;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+/**
+ * Make the compiler assume all memory is read and written here, so stores can't be dropped
+ */
+inline void ClobberMemory()
+{
+#if defined(_MSC_VER)
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : : "memory");
+#endif
+}
+
+/**
+ * Time stamp counter, or 0 where there is none. On current x86 it ticks at a fixed rate
+ * close to the base clock, so cycle counts are only comparable on the same machine.
+ */
+inline std::uint64_t ReadCycleCounter()
+{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+struct BenchmarkOptions
+{
+    std::string filter; // only cases whose name contains this
+    int warmup = 2; // repetitions run and thrown away
+    int repetitions = 15;
+    double minRepetitionSeconds = 0.02; // iterations per repetition are raised until one takes this long
+};
+
+struct BenchmarkResult
+{
+    std::string name;
+    std::size_t elements = 0; // per iteration
+    std::size_t iterations = 0; // per repetition
+    int repetitions = 0;
+    double medianNs = 0.0; // per element
+    double madNs = 0.0;
+    double minNs = 0.0;
+    double cyclesPerElement = 0.0; // median; 0 without a cycle counter
+};
+
+/**
+ * Cases are added with a body that runs the measured operation a given number of times;
+ * anything it needs is set up once in the enclosing scope so it isn't timed.
+ */
+class MicroBenchmark
+{
+public:
+    using Body = std::function<void(std::size_t iterations)>;
+
+    explicit MicroBenchmark(const BenchmarkOptions& options);
+
+    /**
+     * @param elements Items processed by one iteration; times are reported per item
+     */
+    void Add(const std::string& name, std::size_t elements, Body body);
+
+    /**
+     * Run every case matching the filter; progress goes to stderr so stdout stays parseable
+     */
+    void Run();
+
+    [[nodiscard]] const std::vector<BenchmarkResult>& GetResults() const { return m_results; }
+
+    void WriteText(std::ostream& out) const;
+    void WriteJson(std::ostream& out) const;
+    void WriteCsv(std::ostream& out) const;
+
+private:
+    struct Case
+    {
+        std::string name;
+        std::size_t elements;
+        Body body;
+    };
+
+    BenchmarkOptions m_options;
+    std::vector<Case> m_cases;
+    std::vector<BenchmarkResult> m_results;
+
+    [[nodiscard]] BenchmarkResult Measure(const Case& benchmark) const;
+};
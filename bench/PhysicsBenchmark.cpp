@@ -0,0 +1,213 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+// Measures voxel collision cost: fixed-step time for a growing number of bodies walking
+// over generated terrain (kept on it), single threaded and across the job system. Then
+// measures the entity broadphase against brute force for spread out and crowded mobs.
+//
+#include "Core/JobSystem.hpp"
+#include "Physics/SpatialHash.hpp"
+#include "Physics/VoxelCollider.hpp"
+#include "World/BlockRegistry.hpp"
+#include "World/Generation/TerrainGenerator.hpp"
+#include "World/World.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr float TICK = 1.0f / 20.0f;
+constexpr int TICKS = 200;
+constexpr int WORLD_RADIUS = 3;
+
+// bodies stay a few blocks inside the generated chunks, -WORLD_RADIUS to WORLD_RADIUS
+constexpr float AREA_MIN = static_cast<float>(-WORLD_RADIUS * Chunk::SIZE) + 4.0f;
+constexpr float AREA_MAX = static_cast<float>((WORLD_RADIUS + 1) * Chunk::SIZE) - 4.0f;
+
+/**
+ * Register the blocks terrain generation places under the names the engine looks up, and
+ * point the settings at the ids they got
+ */
+void RegisterTerrainBlocks(BlockRegistry& registry, TerrainSettings& terrain)
+{
+    for (const std::string name : {"stone", "dirt", "grass", "water"})
+    {
+        BlockDefinition definition;
+        definition.name = name;
+        definition.solid = name != "water";
+        definition.opaque = name != "water";
+        registry.Register(definition);
+    }
+    registry.Freeze();
+
+    terrain.stoneBlock = registry.GetId("stone");
+    terrain.dirtBlock = registry.GetId("dirt");
+    terrain.grassBlock = registry.GetId("grass");
+    terrain.waterBlock = registry.GetId("water");
+}
+
+/**
+ * Bodies standing on the generated terrain, heading off in random directions
+ */
+std::vector<PhysicsBody> SpawnBodies(std::size_t count, const World& world)
+{
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(AREA_MIN, AREA_MAX);
+    std::uniform_real_distribution<float> speed(-4.0f, 4.0f);
+
+    std::vector<PhysicsBody> bodies(count);
+    for (PhysicsBody& body : bodies)
+    {
+        // on top of the highest block under the box, so nobody starts inside terrain
+        Vector3 feet(position(random), 0.0f, position(random));
+        body.box = {feet - Vector3(0.3f, 0.0f, 0.3f), feet + Vector3(0.3f, 1.8f, 0.3f)};
+        for (int x = static_cast<int>(std::floor(body.box.min.x)); x <= static_cast<int>(std::floor(body.box.max.x)); ++x)
+        {
+            for (int z = static_cast<int>(std::floor(body.box.min.z)); z <= static_cast<int>(std::floor(body.box.max.z));
+                 ++z)
+            {
+                int y = WORLD_HEIGHT - 1;
+                while (y > 0 && world.GetBlock(x, y, z) == BLOCK_AIR)
+                    --y;
+                feet.y = std::max(feet.y, static_cast<float>(y + 1));
+            }
+        }
+        body.box = {feet - Vector3(0.3f, 0.0f, 0.3f), feet + Vector3(0.3f, 1.8f, 0.3f)};
+        body.velocity = {speed(random), 0.0f, speed(random)};
+    }
+    return bodies;
+}
+
+double RunTicks(const VoxelCollider& collider, JobSystem* jobs, std::vector<PhysicsBody>& bodies)
+{
+    const Vector3 gravity(0.0f, -32.0f, 0.0f);
+    const auto start = Clock::now();
+    for (int tick = 0; tick < TICKS; ++tick)
+    {
+        if (jobs)
+            collider.StepParallel(*jobs, bodies.data(), bodies.size(), TICK, gravity);
+        else
+            collider.Step(bodies.data(), bodies.size(), TICK, gravity);
+
+        // keep everyone walking so the run measures sliding and stepping, not resting bodies,
+        // and turn them back at the edge of the generated area before they walk off it
+        for (std::size_t i = 0; i < bodies.size(); ++i)
+        {
+            PhysicsBody& body = bodies[i];
+            if (body.velocity.x == 0.0f)
+                body.velocity.x = (i & 1) ? 4.0f : -4.0f;
+            if (body.velocity.z == 0.0f)
+                body.velocity.z = (i & 2) ? 4.0f : -4.0f;
+
+            if ((body.box.min.x < AREA_MIN && body.velocity.x < 0.0f) ||
+                (body.box.max.x > AREA_MAX && body.velocity.x > 0.0f))
+                body.velocity.x = -body.velocity.x;
+            if ((body.box.min.z < AREA_MIN && body.velocity.z < 0.0f) ||
+                (body.box.max.z > AREA_MAX && body.velocity.z > 0.0f))
+                body.velocity.z = -body.velocity.z;
+        }
+    }
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / TICKS;
+}
+
+/**
+ * Mob-sized boxes scattered over a square of the given half extent
+ */
+std::vector<AABB> SpawnBoxes(std::size_t count, float extent)
+{
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> position(-extent, extent);
+
+    std::vector<AABB> boxes(count);
+    for (AABB& box : boxes)
+    {
+        const Vector3 feet(position(random), 64.0f, position(random));
+        box = {feet - Vector3(0.3f, 0.0f, 0.3f), feet + Vector3(0.3f, 1.8f, 0.3f)};
+    }
+    return boxes;
+}
+
+void RunBroadphase(std::size_t count, float extent)
+{
+    const std::vector<AABB> boxes = SpawnBoxes(count, extent);
+    SpatialHash hash;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs;
+
+    const auto start = Clock::now();
+    for (int tick = 0; tick < TICKS; ++tick)
+    {
+        pairs.clear();
+        hash.Build(boxes.data(), boxes.size());
+        hash.QueryPairs(pairs);
+    }
+    const double hashed = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / TICKS;
+
+    const auto bruteStart = Clock::now();
+    std::size_t brutePairs = 0;
+    for (std::size_t a = 0; a < boxes.size(); ++a)
+    {
+        for (std::size_t b = a + 1; b < boxes.size(); ++b)
+        {
+            brutePairs += boxes[a].Intersects(boxes[b]) ? 1 : 0;
+        }
+    }
+    const double brute = std::chrono::duration<double, std::micro>(Clock::now() - bruteStart).count();
+
+    std::cout << "  " << count << "    " << extent * 2.0f << "    " << hashed << "    " << brute << "    "
+              << pairs.size() << (pairs.size() == brutePairs ? "" : " (MISMATCH)") << std::endl;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::size_t maxBodies = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 8192;
+
+    TerrainSettings terrain;
+    BlockRegistry registry;
+    RegisterTerrainBlocks(registry, terrain);
+
+    JobSystem jobs;
+    World world;
+    TerrainGenerator generator(terrain);
+    generator.GenerateColumns(jobs, world, World::GetColumnsInRadius(ChunkCoord{}, WORLD_RADIUS));
+    const VoxelCollider collider(world, registry);
+
+    std::cout << "Swept AABB collision, " << TICKS << " ticks at " << 1.0f / TICK << " Hz ("
+              << jobs.GetWorkerCount() << " workers)" << std::endl;
+    std::cout << "  bodies    serial us/tick    parallel us/tick    ns/body    inside terrain" << std::endl;
+
+    for (std::size_t count = 128; count <= maxBodies; count *= 4)
+    {
+        std::vector<PhysicsBody> serialBodies = SpawnBodies(count, world);
+        std::vector<PhysicsBody> parallelBodies = serialBodies;
+        const double serial = RunTicks(collider, nullptr, serialBodies);
+        const double parallel = RunTicks(collider, &jobs, parallelBodies);
+
+        std::size_t stuck = 0;
+        for (const PhysicsBody& body : serialBodies)
+        {
+            stuck += collider.Overlaps(body.box) ? 1 : 0;
+        }
+
+        std::cout << "  " << count << "    " << serial << "    " << parallel << "    "
+                  << serial * 1000.0 / static_cast<double>(count) << "    " << stuck << std::endl;
+    }
+
+    std::cout << "Entity broadphase, spatial hash build + pairs vs brute force" << std::endl;
+    std::cout << "  boxes    area    hash us/tick    brute us/tick    pairs" << std::endl;
+    for (std::size_t count = 128; count <= maxBodies; count *= 4)
+    {
+        RunBroadphase(count, WORLD_RADIUS * 32.0f);
+        RunBroadphase(count, 8.0f); // a mob farm: everyone in one 16x16 pen
+    }
+    return 0;
+}
@@ -0,0 +1,620 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+// Microbenchmarks of engine hot paths: vector and quaternion math, config parsing, shader
+// uniform updates, chunk meshing, fluid flow, ECS entities and noise. Runs offline with no
+// window or GL context; shader calls go to stub GL entry points, so that case measures only
+// the engine's side.
+// With --check it runs the correctness checks in SilkChecks.cpp instead and exits non-zero
+// if any fails.
+//
+// Usage: silk_bench [--filter=text] [--reps=N] [--warmup=N] [--min-time=seconds]
+//                   [--format=text|json|csv] [--out=path]
+//        silk_bench --check [--filter=text]
+//
+#include "MicroBenchmark.hpp"
+#include "SilkChecks.hpp"
+
+#include "Core/EngineConfig.hpp"
+#include "Core/JobSystem.hpp"
+#include "Core/Math/Quaternion.hpp"
+#include "Core/Math/Vector3.hpp"
+#include "ECS/CommandBuffer.hpp"
+#include "ECS/EntityManager.hpp"
+#include "Rendering/ChunkMesher.hpp"
+#include "Rendering/Shader.hpp"
+#include "World/BlockRegistry.hpp"
+#include "World/FluidSimulator.hpp"
+#include "World/Generation/Noise.hpp"
+#include "World/Generation/TerrainGenerator.hpp"
+#include "World/World.hpp"
+// clang-format off
+#include "glad/glad.h"
+// clang-format on
+
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t VECTOR_COUNT = 1024;
+constexpr std::size_t NOISE_POINTS = 4096;
+constexpr std::size_t ENTITY_COUNT = 65536;
+
+/**
+ * Swallows std::cout while alive, for engine code that reports what it did
+ */
+class QuietScope
+{
+public:
+    QuietScope()
+        : m_previous(std::cout.rdbuf(&m_null))
+    {
+    }
+
+    ~QuietScope() { std::cout.rdbuf(m_previous); }
+
+    QuietScope(const QuietScope&) = delete;
+    QuietScope& operator=(const QuietScope&) = delete;
+
+private:
+    struct NullBuffer : std::streambuf
+    {
+        int overflow(int c) override { return c; }
+    };
+
+    NullBuffer m_null;
+    std::streambuf* m_previous;
+};
+
+std::vector<Vector3> RandomVectors(std::size_t count, unsigned seed)
+{
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> component(-100.0f, 100.0f);
+    std::vector<Vector3> vectors(count);
+    for (Vector3& vector : vectors)
+    {
+        vector = Vector3(component(random), component(random), component(random));
+    }
+    return vectors;
+}
+
+std::vector<Quaternion> RandomRotations(std::size_t count, unsigned seed)
+{
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> angle(-3.1f, 3.1f);
+    std::vector<Quaternion> rotations(count);
+    for (Quaternion& rotation : rotations)
+    {
+        rotation = Quaternion::FromEulerAngles(angle(random), angle(random) * 0.5f, angle(random));
+    }
+    return rotations;
+}
+
+void AddMathBenchmarks(MicroBenchmark& bench)
+{
+    const auto vectors = std::make_shared<std::vector<Vector3>>(RandomVectors(VECTOR_COUNT, 1));
+    const auto rotations = std::make_shared<std::vector<Quaternion>>(RandomRotations(VECTOR_COUNT, 2));
+
+    bench.Add("math/vector3_normalize_cross_dot", VECTOR_COUNT, [vectors](std::size_t iterations) {
+        const std::vector<Vector3>& v = *vectors;
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            float sum = 0.0f;
+            for (std::size_t j = 0; j + 1 < v.size(); ++j)
+            {
+                sum += v[j].Normalized().Cross(v[j + 1]).Dot(v[j]);
+            }
+            DoNotOptimize(sum);
+        }
+    });
+
+    bench.Add("math/vector3_lerp", VECTOR_COUNT, [vectors](std::size_t iterations) {
+        const std::vector<Vector3>& v = *vectors;
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            Vector3 sum;
+            for (std::size_t j = 0; j + 1 < v.size(); ++j)
+            {
+                sum += Vector3::Lerp(v[j], v[j + 1], 0.25f);
+            }
+            DoNotOptimize(sum);
+        }
+    });
+
+    bench.Add("math/quaternion_multiply_normalize", VECTOR_COUNT, [rotations](std::size_t iterations) {
+        const std::vector<Quaternion>& q = *rotations;
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            Quaternion product;
+            for (const Quaternion& rotation : q)
+            {
+                product = (product * rotation).Normalized();
+            }
+            DoNotOptimize(product);
+        }
+    });
+
+    bench.Add("math/quaternion_slerp", VECTOR_COUNT, [rotations](std::size_t iterations) {
+        const std::vector<Quaternion>& q = *rotations;
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            for (std::size_t j = 0; j + 1 < q.size(); ++j)
+            {
+                DoNotOptimize(q[j].Slerp(q[j + 1], 0.3f));
+            }
+        }
+    });
+
+    bench.Add("math/quaternion_euler_round_trip", VECTOR_COUNT, [rotations](std::size_t iterations) {
+        const std::vector<Quaternion>& q = *rotations;
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            for (const Quaternion& rotation : q)
+            {
+                DoNotOptimize(Quaternion::FromEulerAngles(rotation.ToEulerAngles()));
+            }
+        }
+    });
+}
+
+/**
+ * Command line overrides with storage for their argv
+ */
+struct ConfigArguments
+{
+    std::vector<std::string> strings;
+    std::vector<char*> argv;
+    std::vector<std::string> keys;
+};
+
+void AddConfigBenchmarks(MicroBenchmark& bench)
+{
+    constexpr std::size_t KEY_COUNT = 64;
+
+    // a config file and the same keys as command line overrides, with every value type
+    auto arguments = std::make_shared<ConfigArguments>();
+    arguments->strings.push_back("silk");
+    const std::string path = (std::filesystem::temp_directory_path() / "silk_bench_config.ini").string();
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << "# generated by silk_bench\n";
+        for (std::size_t i = 0; i < KEY_COUNT; ++i)
+        {
+            std::string value;
+            switch (i % 4)
+            {
+            case 0: value = std::to_string(i * 37); break;
+            case 1: value = std::to_string(static_cast<float>(i) * 0.125f); break;
+            case 2: value = i % 8 == 2 ? "true" : "false"; break;
+            default: value = "\"assets/section" + std::to_string(i) + "/file.ini\""; break;
+            }
+            const std::string key = "section" + std::to_string(i / 8) + ".key" + std::to_string(i);
+            file << key << " = " << value << "\n";
+            arguments->strings.push_back("--" + key + "=" + value);
+            arguments->keys.push_back(key);
+        }
+    }
+    for (std::string& argument : arguments->strings)
+    {
+        arguments->argv.push_back(argument.data());
+    }
+    const int argc = static_cast<int>(arguments->argv.size());
+
+    bench.Add("config/load_file", KEY_COUNT, [path](std::size_t iterations) {
+        const QuietScope quiet;
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            EngineConfig config;
+            DoNotOptimize(config.LoadFromFile(path));
+        }
+    });
+
+    // the command line only sets known keys, so the overrides go on top of the loaded file
+    auto config = std::make_shared<EngineConfig>();
+    {
+        const QuietScope quiet;
+        config->LoadFromFile(path);
+    }
+    bench.Add("config/apply_arguments", KEY_COUNT, [arguments, argc, config](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            DoNotOptimize(config->ApplyArguments(argc, arguments->argv.data()));
+        }
+    });
+
+    bench.Add("config/get_value", KEY_COUNT, [arguments, config](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            for (const std::string& key : arguments->keys)
+            {
+                DoNotOptimize(config->GetValueAs<int>(key, 0));
+            }
+        }
+    });
+}
+
+// stub GL: just enough for Shader to build a program and look up uniforms the way a driver
+// would, by name; uniform uploads are dropped
+const char* const UNIFORM_NAMES[] = {"view", "projection", "chunkOffset"};
+GLint g_uniformSink = 0;
+
+GLuint APIENTRY StubCreate(GLenum) { return 1; }
+GLuint APIENTRY StubCreateProgram() { return 1; }
+void APIENTRY StubShaderSource(GLuint, GLsizei, const GLchar* const*, const GLint*) {}
+void APIENTRY StubObject(GLuint) {}
+void APIENTRY StubAttach(GLuint, GLuint) {}
+void APIENTRY StubGetStatus(GLuint, GLenum, GLint* value) { *value = GL_TRUE; }
+
+GLint APIENTRY StubGetUniformLocation(GLuint, const GLchar* name)
+{
+    for (GLint i = 0; i < static_cast<GLint>(std::size(UNIFORM_NAMES)); ++i)
+    {
+        if (std::strcmp(UNIFORM_NAMES[i], name) == 0)
+            return i;
+    }
+    return -1;
+}
+
+void APIENTRY StubUniformMatrix4(GLint location, GLsizei, GLboolean, const GLfloat* value)
+{
+    g_uniformSink += location + static_cast<GLint>(value[0]);
+}
+
+void APIENTRY StubUniform3(GLint location, GLsizei, const GLfloat* value)
+{
+    g_uniformSink += location + static_cast<GLint>(value[0]);
+}
+
+void InstallStubGl()
+{
+    glad_glCreateShader = StubCreate;
+    glad_glShaderSource = StubShaderSource;
+    glad_glCompileShader = StubObject;
+    glad_glGetShaderiv = StubGetStatus;
+    glad_glCreateProgram = StubCreateProgram;
+    glad_glAttachShader = StubAttach;
+    glad_glLinkProgram = StubObject;
+    glad_glGetProgramiv = StubGetStatus;
+    glad_glDeleteShader = StubObject;
+    glad_glDeleteProgram = StubObject;
+    glad_glUseProgram = StubObject;
+    glad_glGetUniformLocation = StubGetUniformLocation;
+    glad_glUniformMatrix4fv = StubUniformMatrix4;
+    glad_glUniform3fv = StubUniform3;
+}
+
+void AddShaderBenchmarks(MicroBenchmark& bench)
+{
+    constexpr std::size_t CHUNK_COUNT = 256;
+    InstallStubGl();
+    std::shared_ptr<Shader> shader;
+    {
+        const QuietScope quiet;
+        shader = std::make_shared<Shader>("assets/shaders/chunk_vert.glsl", "assets/shaders/chunk_frag.glsl");
+    }
+
+    // the per-frame sequence of ChunkRenderer::Render: two matrices, then an offset per chunk
+    bench.Add("shader/chunk_uniforms", CHUNK_COUNT + 2, [shader](std::size_t iterations) {
+        const glm::mat4 view(1.0f);
+        const glm::mat4 projection(1.0f);
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            shader->use();
+            shader->setMat4("view", view);
+            shader->setMat4("projection", projection);
+            for (std::size_t c = 0; c < CHUNK_COUNT; ++c)
+            {
+                shader->setVec3("chunkOffset", glm::vec3(static_cast<float>(c), 0.0f, 0.0f));
+            }
+        }
+        DoNotOptimize(g_uniformSink);
+    });
+}
+
+/**
+ * Register the blocks terrain generation places under the names the engine looks up, and
+ * point the settings at the ids they got
+ */
+void RegisterTerrainBlocks(BlockRegistry& registry, TerrainSettings& terrain)
+{
+    for (const std::string name : {"stone", "dirt", "grass", "water"})
+    {
+        BlockDefinition definition;
+        definition.name = name;
+        definition.solid = name != "water";
+        definition.opaque = name != "water";
+        registry.Register(definition);
+    }
+    registry.Freeze();
+
+    terrain.stoneBlock = registry.GetId("stone");
+    terrain.dirtBlock = registry.GetId("dirt");
+    terrain.grassBlock = registry.GetId("grass");
+    terrain.waterBlock = registry.GetId("water");
+}
+
+void AddMeshingBenchmarks(MicroBenchmark& bench)
+{
+    TerrainSettings terrain;
+    auto registry = std::make_shared<BlockRegistry>();
+    RegisterTerrainBlocks(*registry, terrain);
+
+    // the middle column of a 3x3 patch, so every chunk has its neighbours
+    JobSystem jobs;
+    World world;
+    const TerrainGenerator generator(terrain);
+    generator.GenerateColumns(jobs, world, World::GetColumnsInRadius(ChunkCoord{}, 1));
+
+    auto inputs = std::make_shared<std::vector<ChunkMeshInput>>();
+    for (int y = 0; y < WORLD_HEIGHT_CHUNKS; ++y)
+    {
+        if (world.GetChunk(ChunkCoord{0, y, 0}))
+        {
+            inputs->emplace_back();
+            ChunkMesher::GatherInput(world, ChunkCoord{0, y, 0}, inputs->back());
+        }
+    }
+
+    // mesh of a terrain column, per block
+    bench.Add("meshing/greedy_column", inputs->size() * Chunk::VOLUME, [registry, inputs](std::size_t iterations) {
+        const ChunkMesher mesher(*registry);
+        ChunkMesh mesh;
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            for (const ChunkMeshInput& input : *inputs)
+            {
+                mesh.Clear();
+                mesher.Mesh(input, mesh);
+                DoNotOptimize(mesh.vertices.data());
+            }
+        }
+        ClobberMemory();
+    });
+}
+
+void AddFluidBenchmarks(MicroBenchmark& bench)
+{
+    constexpr int POOL_SIZE = 60;
+    constexpr int MAX_STEPS = 64;
+    auto terrain = std::make_shared<TerrainSettings>();
+    auto registry = std::make_shared<BlockRegistry>();
+    RegisterTerrainBlocks(*registry, *terrain);
+    auto jobs = std::make_shared<JobSystem>();
+
+    // a 60x60 pool of water sources dropped on a stone floor and flooded until it settles,
+    // per source; the world is rebuilt each time, which costs little next to the flood
+    bench.Add("fluid/flood_settle", POOL_SIZE * POOL_SIZE, [terrain, registry, jobs](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            World world;
+            for (int cz = -1; cz <= 2; ++cz)
+            {
+                for (int cx = -1; cx <= 2; ++cx)
+                {
+                    world.GetOrCreateChunk(ChunkCoord{cx, 0, cz}).Fill(terrain->stoneBlock);
+                }
+            }
+
+            FluidSimulator fluids(world, *registry);
+            FluidType water;
+            water.block = terrain->waterBlock;
+            fluids.AddFluid(water);
+            for (int z = 0; z < POOL_SIZE; ++z)
+            {
+                for (int x = 0; x < POOL_SIZE; ++x)
+                {
+                    world.SetBlock(x, Chunk::SIZE, z, terrain->waterBlock);
+                    fluids.OnBlockChanged(x, Chunk::SIZE, z);
+                }
+            }
+
+            int steps = 0;
+            do
+            {
+                fluids.Step(*jobs);
+            } while (++steps < MAX_STEPS && fluids.GetActiveCellCount() > 0);
+            DoNotOptimize(steps);
+        }
+    });
+}
+
+struct BenchPosition
+{
+    float x, y, z;
+};
+
+struct BenchVelocity
+{
+    float x, y, z;
+};
+
+void AddEcsBenchmarks(MicroBenchmark& bench)
+{
+    // 64k entities created and then destroyed through a command buffer, per entity
+    bench.Add("ecs/create_destroy", ENTITY_COUNT, [](std::size_t iterations) {
+        EntityManager entities;
+        CommandBuffer commands;
+        std::vector<Entity> handles;
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            for (std::size_t e = 0; e < ENTITY_COUNT; ++e)
+            {
+                commands.Create(BenchPosition{static_cast<float>(e), 0.0f, 0.0f}, BenchVelocity{0.0f, 1.0f, 0.0f});
+            }
+            commands.Playback(entities);
+
+            handles.clear();
+            entities.Each<const BenchPosition>([&](Entity entity, const BenchPosition&) { handles.push_back(entity); });
+            for (const Entity entity : handles)
+            {
+                commands.Destroy(entity);
+            }
+            commands.Playback(entities);
+            DoNotOptimize(entities.GetEntityCount());
+        }
+    });
+
+    // position += velocity over 64k entities, per entity, on one thread and across the job system
+    auto world = std::make_shared<EntityManager>();
+    for (std::size_t e = 0; e < ENTITY_COUNT; ++e)
+    {
+        world->Create(BenchPosition{static_cast<float>(e), 0.0f, 0.0f}, BenchVelocity{0.0f, 1.0f, 0.0f});
+    }
+    auto jobs = std::make_shared<JobSystem>();
+
+    bench.Add("ecs/each", ENTITY_COUNT, [world](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            world->Each<BenchPosition, const BenchVelocity>([](BenchPosition& position, const BenchVelocity& velocity) {
+                position.x += velocity.x;
+                position.y += velocity.y;
+                position.z += velocity.z;
+            });
+            ClobberMemory();
+        }
+    });
+
+    bench.Add("ecs/parallel_each", ENTITY_COUNT, [world, jobs](std::size_t iterations) {
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            world->ParallelEach<BenchPosition, const BenchVelocity>(
+                *jobs, [](BenchPosition& position, const BenchVelocity& velocity) {
+                    position.x += velocity.x;
+                    position.y += velocity.y;
+                    position.z += velocity.z;
+                });
+            ClobberMemory();
+        }
+    });
+}
+
+void AddNoiseBenchmarks(MicroBenchmark& bench)
+{
+    auto coordinates = std::make_shared<std::vector<float>>(NOISE_POINTS * 3);
+    for (std::size_t i = 0; i < NOISE_POINTS; ++i)
+    {
+        (*coordinates)[i] = static_cast<float>(i % 64) * 0.37f;
+        (*coordinates)[NOISE_POINTS + i] = static_cast<float>(i / 64) * 0.37f;
+        (*coordinates)[2 * NOISE_POINTS + i] = static_cast<float>(i % 97) * 0.51f;
+    }
+    const Noise::FractalSettings settings{Noise::NoiseType::Simplex, 4, 0.05f, 2.0f, 0.5f};
+
+    bench.Add("noise/simplex3d", NOISE_POINTS, [coordinates](std::size_t iterations) {
+        const float* xs = coordinates->data();
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            float sum = 0.0f;
+            for (std::size_t p = 0; p < NOISE_POINTS; ++p)
+            {
+                sum += Noise::Simplex3D(7, xs[p], xs[NOISE_POINTS + p], xs[2 * NOISE_POINTS + p]);
+            }
+            DoNotOptimize(sum);
+        }
+    });
+
+    const auto addBatch = [&](const char* name, bool simd) {
+        bench.Add(name, NOISE_POINTS, [coordinates, settings, simd](std::size_t iterations) {
+            std::vector<float> out(NOISE_POINTS);
+            const float* xs = coordinates->data();
+            Noise::SetSIMDEnabled(simd);
+            for (std::size_t i = 0; i < iterations; ++i)
+            {
+                Noise::Fbm3DBatch(7, settings, xs, xs + NOISE_POINTS, xs + 2 * NOISE_POINTS, out.data(), NOISE_POINTS);
+                DoNotOptimize(out.data());
+                ClobberMemory();
+            }
+            Noise::SetSIMDEnabled(true);
+        });
+    };
+    addBatch("noise/fbm3d_batch_scalar", false);
+    Noise::SetSIMDEnabled(true);
+    if (Noise::IsSIMDActive())
+        addBatch("noise/fbm3d_batch_avx2", true);
+}
+
+bool StartsWith(const std::string& text, const char* prefix)
+{
+    return text.compare(0, std::strlen(prefix), prefix) == 0;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    BenchmarkOptions options;
+    std::string format = "text";
+    std::string outPath;
+    bool check = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        const std::string value = argument.substr(argument.find('=') + 1);
+        if (StartsWith(argument, "--filter="))
+            options.filter = value;
+        else if (StartsWith(argument, "--reps="))
+            options.repetitions = std::atoi(value.c_str());
+        else if (StartsWith(argument, "--warmup="))
+            options.warmup = std::atoi(value.c_str());
+        else if (StartsWith(argument, "--min-time="))
+            options.minRepetitionSeconds = std::atof(value.c_str());
+        else if (StartsWith(argument, "--format="))
+            format = value;
+        else if (StartsWith(argument, "--out="))
+            outPath = value;
+        else if (argument == "--check")
+            check = true;
+        else
+        {
+            std::cerr << "Unknown argument " << argument << std::endl;
+            return 1;
+        }
+    }
+    if (format != "text" && format != "json" && format != "csv")
+    {
+        std::cerr << "Unknown format " << format << " (expected text, json or csv)" << std::endl;
+        return 1;
+    }
+    if (check)
+        return RunChecks(options.filter) == 0 ? 0 : 1;
+
+    MicroBenchmark bench(options);
+    AddMathBenchmarks(bench);
+    AddConfigBenchmarks(bench);
+    AddShaderBenchmarks(bench);
+    AddMeshingBenchmarks(bench);
+    AddFluidBenchmarks(bench);
+    AddEcsBenchmarks(bench);
+    AddNoiseBenchmarks(bench);
+
+    std::cerr << "Running microbenchmarks (" << options.warmup << " warmup, " << options.repetitions
+              << " repetitions)" << std::endl;
+    bench.Run();
+
+    std::ofstream file;
+    if (!outPath.empty())
+    {
+        file.open(outPath, std::ios::trunc);
+        if (!file.is_open())
+        {
+            std::cerr << "Failed to open " << outPath << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& out = outPath.empty() ? std::cout : file;
+    if (format == "json")
+        bench.WriteJson(out);
+    else if (format == "csv")
+        bench.WriteCsv(out);
+    else
+        bench.WriteText(out);
+    return out.good() ? 0 : 1;
+}
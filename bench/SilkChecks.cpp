@@ -0,0 +1,815 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#include "SilkChecks.hpp"
+
+#include "Core/JobSystem.hpp"
+#include "ECS/CommandBuffer.hpp"
+#include "ECS/EntityManager.hpp"
+#include "Rendering/ChunkMesher.hpp"
+#include "World/BlockRegistry.hpp"
+#include "World/BlockTickScheduler.hpp"
+#include "World/FluidSimulator.hpp"
+#include "World/Generation/TerrainGenerator.hpp"
+#include "World/LightEngine.hpp"
+#include "World/SparseVoxelTree.hpp"
+#include "World/VoxelRaycaster.hpp"
+#include "World/World.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+/**
+ * Lit terrain from the shipped block definitions, for checks to read and edit
+ */
+struct CheckWorld
+{
+    BlockRegistry registry;
+    JobSystem jobs;
+    World world;
+    LightEngine light{world, registry};
+
+    bool Generate(const ChunkCoord& center, int radius)
+    {
+        if (!registry.LoadFromFile("assets/blocks.ini"))
+            return false;
+
+        registry.Freeze();
+
+        TerrainSettings terrain;
+        terrain.stoneBlock = registry.GetId("stone");
+        terrain.dirtBlock = registry.GetId("dirt");
+        terrain.grassBlock = registry.GetId("grass");
+        terrain.waterBlock = registry.GetId("water");
+        const TerrainGenerator generator(terrain);
+        const std::vector<ChunkCoord> columns = World::GetColumnsInRadius(center, radius);
+        generator.GenerateColumns(jobs, world, columns);
+        light.LightColumns(jobs, columns);
+        return true;
+    }
+
+    /**
+     * Height of the first block above the highest non-air block of a column
+     */
+    [[nodiscard]] int SurfaceY(int x, int z) const
+    {
+        for (int y = WORLD_HEIGHT_CHUNKS * Chunk::SIZE - 1; y >= 0; --y)
+        {
+            if (world.GetBlock(x, y, z) != BLOCK_AIR)
+                return y + 1;
+        }
+        return 0;
+    }
+
+    void SetBlock(int x, int y, int z, BlockId block)
+    {
+        const BlockId old = world.GetBlock(x, y, z);
+        world.SetBlock(x, y, z, block);
+        light.OnBlockChanged(x, y, z, old, block);
+    }
+};
+
+/**
+ * Mesh every chunk of the origin column and validate it against the brute-force mesher
+ */
+bool ValidateOriginColumn(const CheckWorld& check, const char* stage)
+{
+    const ChunkMesher mesher(check.registry);
+    ChunkMeshInput input;
+    ChunkMesh mesh;
+    bool valid = true;
+    int meshed = 0;
+    for (int y = 0; y < WORLD_HEIGHT_CHUNKS; ++y)
+    {
+        const ChunkCoord coord{0, y, 0};
+        if (!check.world.GetChunk(coord))
+            continue;
+
+        ChunkMesher::GatherInput(check.world, coord, input);
+        mesh.Clear();
+        mesher.Mesh(input, mesh);
+        ++meshed;
+        if (!mesher.Validate(input, mesh))
+        {
+            std::cerr << "  " << stage << " chunk (0, " << y << ", 0) does not match the brute-force mesh" << std::endl;
+            valid = false;
+        }
+    }
+
+    if (meshed == 0)
+    {
+        std::cerr << "  " << stage << " terrain has no chunks at the origin" << std::endl;
+        return false;
+    }
+    return valid;
+}
+
+bool CheckChunkMeshes()
+{
+    CheckWorld check;
+    if (!check.Generate(ChunkCoord{}, 2))
+        return false;
+
+    bool valid = ValidateOriginColumn(check, "generated");
+
+    // a room dug under the surface and lit by lava, a water pool and an overhang, so the
+    // relit mesh has block light, translucent faces and AO under a ledge
+    const BlockId stone = check.registry.GetId("stone");
+    const BlockId water = check.registry.GetId("water");
+    const BlockId lava = check.registry.GetId("lava");
+    const int floor = check.SurfaceY(8, 8) - 6;
+    for (int y = floor; y < floor + 4; ++y)
+    {
+        for (int z = 4; z < 13; ++z)
+        {
+            for (int x = 4; x < 13; ++x)
+            {
+                check.SetBlock(x, y, z, BLOCK_AIR);
+            }
+        }
+    }
+    check.SetBlock(8, floor, 8, lava);
+    for (int z = 20; z < 24; ++z)
+    {
+        for (int x = 20; x < 24; ++x)
+        {
+            check.SetBlock(x, check.SurfaceY(x, z), z, water);
+        }
+    }
+    const int ledge = check.SurfaceY(28, 12) + 3;
+    for (int x = 26; x < 31; ++x)
+    {
+        check.SetBlock(x, ledge, 12, stone);
+    }
+    check.light.ProcessUpdates(check.jobs);
+
+    valid = ValidateOriginColumn(check, "edited") && valid;
+    return valid;
+}
+
+constexpr double REFERENCE_STEP = 1.0 / 512.0;
+
+/**
+ * Reference raycast: walk the ray in tiny fixed steps and stop in the first cell that is not air.
+ * Much slower than the grid traversal, and it can step over a cell the ray only clips by
+ * less than a step.
+ */
+bool StepRay(const World& world, const Ray& ray, RaycastHit& hit, int previous[3])
+{
+    hit = RaycastHit{};
+    const Vector3 unit = ray.direction.Normalized();
+    const glm::dvec3 direction(unit.x, unit.y, unit.z);
+    int cell[3] = {std::numeric_limits<int>::min(), 0, 0};
+    for (double t = 0.0; t <= ray.maxDistance; t += REFERENCE_STEP)
+    {
+        const glm::dvec3 point = ray.origin + direction * t;
+        const int next[3] = {static_cast<int>(std::floor(point.x)), static_cast<int>(std::floor(point.y)),
+                             static_cast<int>(std::floor(point.z))};
+        if (next[0] == cell[0] && next[1] == cell[1] && next[2] == cell[2])
+            continue;
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            previous[axis] = cell[axis];
+            cell[axis] = next[axis];
+        }
+        const BlockId block = world.GetBlock(cell[0], cell[1], cell[2]);
+        if (block != BLOCK_AIR)
+        {
+            hit.hit = true;
+            hit.x = cell[0];
+            hit.y = cell[1];
+            hit.z = cell[2];
+            hit.block = block;
+            hit.distance = static_cast<float>(t);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Length of the part of the ray inside a block, by clipping it against the block's slabs
+ */
+double ClipLength(const Ray& ray, int x, int y, int z)
+{
+    const Vector3 unit = ray.direction.Normalized();
+    const double direction[3] = {unit.x, unit.y, unit.z};
+    const double origin[3] = {ray.origin.x, ray.origin.y, ray.origin.z};
+    const int cell[3] = {x, y, z};
+    double enter = 0.0;
+    double exit = ray.maxDistance;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        if (direction[axis] == 0.0)
+        {
+            if (origin[axis] < cell[axis] || origin[axis] >= cell[axis] + 1)
+                return 0.0;
+            continue;
+        }
+        double t0 = (cell[axis] - origin[axis]) / direction[axis];
+        double t1 = (cell[axis] + 1 - origin[axis]) / direction[axis];
+        if (t0 > t1)
+            std::swap(t0, t1);
+        enter = std::max(enter, t0);
+        exit = std::min(exit, t1);
+    }
+    return std::max(exit - enter, 0.0);
+}
+
+/**
+ * Ray from up to 16 blocks above the terrain at a random point of a span x span square from
+ * base, pointing mostly down
+ */
+Ray RandomRay(const CheckWorld& check, const glm::dvec3& base, double span, float reach, std::mt19937& random)
+{
+    std::uniform_real_distribution<double> offset(0.0, span);
+    std::uniform_real_distribution<double> height(0.0, 16.0);
+    std::uniform_real_distribution<float> component(-1.0f, 1.0f);
+
+    Ray ray;
+    ray.origin = base + glm::dvec3(offset(random), 0.0, offset(random));
+    ray.origin.y = check.SurfaceY(static_cast<int>(std::floor(ray.origin.x)), static_cast<int>(std::floor(ray.origin.z))) +
+                   height(random);
+    ray.direction = Vector3(component(random), component(random) - 0.5f, component(random));
+    ray.maxDistance = reach;
+    return ray;
+}
+
+/**
+ * Cast random rays from just above the terrain and compare the raycaster with the stepping
+ * reference: same hit cell, face and distance, except where the reference stepped over a
+ * sliver of a block that the traversal rightly caught
+ */
+bool CompareRays(const CheckWorld& check, const glm::dvec3& base, const char* stage)
+{
+    constexpr int RAY_COUNT = 400;
+    constexpr float REACH = 40.0f;
+
+    const VoxelRaycaster raycaster(check.world);
+    std::mt19937 random(29);
+    int mismatches = 0;
+    int hits = 0;
+    for (int i = 0; i < RAY_COUNT; ++i)
+    {
+        const Ray ray = RandomRay(check, base, Chunk::SIZE, REACH, random);
+        RaycastHit fast;
+        RaycastHit reference;
+        int previous[3];
+        raycaster.Cast(ray, fast);
+        StepRay(check.world, ray, reference, previous);
+        hits += fast.hit ? 1 : 0;
+
+        bool agrees = fast.hit == reference.hit;
+        if (agrees && fast.hit)
+        {
+            agrees = fast.x == reference.x && fast.y == reference.y && fast.z == reference.z &&
+                     std::fabs(fast.distance - reference.distance) <= 2.0 * REFERENCE_STEP + 1e-3;
+            // the cell the reference entered from tells the face, unless it stepped across a corner
+            const int changed = (previous[0] != fast.x) + (previous[1] != fast.y) + (previous[2] != fast.z);
+            if (agrees && changed == 1 && fast.face != BlockFace::None)
+            {
+                const int axis = previous[0] != fast.x ? 0 : previous[1] != fast.y ? 1 : 2;
+                const int from = axis == 0 ? previous[0] - fast.x : axis == 1 ? previous[1] - fast.y : previous[2] - fast.z;
+                agrees = fast.face == static_cast<BlockFace>(axis * 2 + (from > 0 ? 0 : 1));
+            }
+        }
+        if (!agrees && fast.hit && (!reference.hit || fast.distance <= reference.distance) &&
+            ClipLength(ray, fast.x, fast.y, fast.z) < 2.0 * REFERENCE_STEP)
+        {
+            agrees = true;
+        }
+
+        if (!agrees)
+        {
+            if (++mismatches <= 5)
+            {
+                std::cerr << "  " << stage << " ray " << i << ": raycaster " << (fast.hit ? "hit" : "missed") << " ("
+                          << fast.x << ", " << fast.y << ", " << fast.z << ") at " << fast.distance << ", reference "
+                          << (reference.hit ? "hit" : "missed") << " (" << reference.x << ", " << reference.y << ", "
+                          << reference.z << ") at " << reference.distance << std::endl;
+            }
+        }
+    }
+
+    if (hits < RAY_COUNT / 2)
+    {
+        std::cerr << "  " << stage << " only " << hits << " of " << RAY_COUNT << " rays hit terrain" << std::endl;
+        return false;
+    }
+    if (mismatches > 0)
+        std::cerr << "  " << stage << ": " << mismatches << " of " << RAY_COUNT << " rays disagree" << std::endl;
+    return mismatches == 0;
+}
+
+bool CheckRaycasts()
+{
+    // near the origin, and 16 million blocks out where a float origin could not hold the
+    // position within a block
+    constexpr int FAR_CHUNK = 500000;
+    CheckWorld nearWorld;
+    CheckWorld farWorld;
+    if (!nearWorld.Generate(ChunkCoord{}, 2) || !farWorld.Generate(ChunkCoord{FAR_CHUNK, 0, FAR_CHUNK}, 2))
+        return false;
+
+    const double farBlock = static_cast<double>(FAR_CHUNK) * Chunk::SIZE;
+    const bool nearValid = CompareRays(nearWorld, glm::dvec3(0.0, 0.0, 0.0), "near");
+    const bool farValid = CompareRays(farWorld, glm::dvec3(farBlock, 0.0, farBlock), "far");
+    return nearValid && farValid;
+}
+
+/**
+ * Cast the same rays through a sparse voxel tree of a region and through the chunks it was
+ * built from; both must report the same hit cell, block, face and distance
+ */
+bool CompareTreeRays(const CheckWorld& check, int regionX, int regionZ, const char* stage)
+{
+    constexpr int RAY_COUNT = 2000;
+    constexpr float REACH = 96.0f;
+
+    SparseVoxelTree tree;
+    tree.Build(regionX, regionZ, [&check](const ChunkCoord& coord) { return check.world.GetChunk(coord); });
+
+    // rays start in the middle of the region so they rarely leave it, where the tree sees air
+    const glm::dvec3 base(static_cast<double>(regionX) * SparseVoxelTree::REGION_SIZE + 64.0, 0.0,
+                          static_cast<double>(regionZ) * SparseVoxelTree::REGION_SIZE + 64.0);
+    const VoxelRaycaster raycaster(check.world);
+    std::mt19937 random(32);
+    int mismatches = 0;
+    int hits = 0;
+    for (int i = 0; i < RAY_COUNT; ++i)
+    {
+        const Ray ray = RandomRay(check, base, 128.0, REACH, random);
+        RaycastHit grid;
+        RaycastHit sparse;
+        raycaster.Cast(ray, grid);
+        tree.Raycast(ray, sparse);
+        hits += grid.hit ? 1 : 0;
+
+        // the region is convex, so a ray whose first hit lies outside it sees only air in the tree
+        const int localX = grid.x - regionX * SparseVoxelTree::REGION_SIZE;
+        const int localZ = grid.z - regionZ * SparseVoxelTree::REGION_SIZE;
+        if (grid.hit && (localX < 0 || localX >= SparseVoxelTree::REGION_SIZE || localZ < 0 ||
+                         localZ >= SparseVoxelTree::REGION_SIZE))
+        {
+            grid = RaycastHit{};
+        }
+
+        const bool agrees = grid.hit == sparse.hit &&
+                            (!grid.hit || (grid.x == sparse.x && grid.y == sparse.y && grid.z == sparse.z &&
+                                           grid.block == sparse.block && grid.face == sparse.face &&
+                                           std::fabs(grid.distance - sparse.distance) <= 1e-3f));
+        if (!agrees && ++mismatches <= 5)
+        {
+            std::cerr << "  " << stage << " ray " << i << ": chunks " << (grid.hit ? "hit" : "missed") << " ("
+                      << grid.x << ", " << grid.y << ", " << grid.z << ") face " << static_cast<int>(grid.face)
+                      << " at " << grid.distance << ", tree " << (sparse.hit ? "hit" : "missed") << " (" << sparse.x
+                      << ", " << sparse.y << ", " << sparse.z << ") face " << static_cast<int>(sparse.face) << " at "
+                      << sparse.distance << std::endl;
+        }
+    }
+
+    if (hits < RAY_COUNT / 2)
+    {
+        std::cerr << "  " << stage << " only " << hits << " of " << RAY_COUNT << " rays hit terrain" << std::endl;
+        return false;
+    }
+    if (mismatches > 0)
+        std::cerr << "  " << stage << ": " << mismatches << " of " << RAY_COUNT << " rays disagree" << std::endl;
+    return mismatches == 0;
+}
+
+bool CheckSparseTreeRaycasts()
+{
+    // one region at the origin and one 16 million blocks out, each generated in full
+    constexpr int FAR_REGION = 62500;
+    constexpr int HALF = SparseVoxelTree::REGION_CHUNKS / 2;
+    CheckWorld nearWorld;
+    CheckWorld farWorld;
+    const ChunkCoord farCenter{FAR_REGION * SparseVoxelTree::REGION_CHUNKS + HALF, 0,
+                               FAR_REGION * SparseVoxelTree::REGION_CHUNKS + HALF};
+    if (!nearWorld.Generate(ChunkCoord{HALF, 0, HALF}, HALF) || !farWorld.Generate(farCenter, HALF))
+        return false;
+
+    const bool nearValid = CompareTreeRays(nearWorld, 0, 0, "near");
+    const bool farValid = CompareTreeRays(farWorld, FAR_REGION, FAR_REGION, "far");
+    return nearValid && farValid;
+}
+
+/**
+ * Compare coarse tree cells at every inner depth with a count of the blocks inside them: a cell
+ * must read as air exactly when less than half of it is solid, and otherwise as a block it holds
+ */
+bool CheckSparseTreeCoarseCells()
+{
+    // three by three columns in the corner of region (0, 0); the rest of the region is air
+    CheckWorld check;
+    if (!check.Generate(ChunkCoord{1, 0, 1}, 1))
+        return false;
+
+    SparseVoxelTree tree;
+    tree.Build(0, 0, [&check](const ChunkCoord& coord) { return check.world.GetChunk(coord); });
+
+    constexpr int EXTENT = 3 * Chunk::SIZE;
+    int mismatches = 0;
+    int solidCells = 0;
+    std::vector<int> counts;
+    for (int depth = 1; depth < SparseVoxelTree::DEPTH; ++depth)
+    {
+        const int size = SparseVoxelTree::REGION_SIZE >> (SparseVoxelTree::BRANCH_BITS * depth);
+        const long long volume = static_cast<long long>(size) * size * size;
+        for (int cellY = 0; cellY < SparseVoxelTree::REGION_SIZE; cellY += size)
+        {
+            for (int cellZ = 0; cellZ < std::max(EXTENT, size); cellZ += size)
+            {
+                for (int cellX = 0; cellX < std::max(EXTENT, size); cellX += size)
+                {
+                    counts.assign(check.registry.GetBlockCount() + 1, 0);
+                    long long solid = 0;
+                    for (int y = cellY; y < cellY + size; ++y)
+                    {
+                        for (int z = cellZ; z < cellZ + size; ++z)
+                        {
+                            for (int x = cellX; x < cellX + size; ++x)
+                            {
+                                const BlockId block = check.world.GetBlock(x, y, z);
+                                ++counts[block];
+                                solid += block != BLOCK_AIR ? 1 : 0;
+                            }
+                        }
+                    }
+
+                    // the summary of a 64^3 cell rounds its fill; do not judge cells on the edge
+                    const long long margin = volume / 4096;
+                    const BlockId coarse = tree.GetCoarseBlock(depth, cellX, cellY, cellZ);
+                    bool valid = true;
+                    if (solid * 2 < volume - margin)
+                        valid = coarse == BLOCK_AIR;
+                    else if (solid * 2 >= volume + margin)
+                        valid = coarse != BLOCK_AIR && counts[coarse] > 0;
+                    solidCells += coarse != BLOCK_AIR ? 1 : 0;
+                    if (!valid && mismatches++ < 5)
+                    {
+                        std::cerr << "  depth " << depth << " cell (" << cellX << ", " << cellY << ", " << cellZ
+                                  << ") is " << solid << " of " << volume << " solid but reads as block " << coarse
+                                  << std::endl;
+                    }
+                }
+            }
+        }
+    }
+
+    if (solidCells == 0)
+    {
+        std::cerr << "  every coarse cell reads as air" << std::endl;
+        return false;
+    }
+    return mismatches == 0;
+}
+
+/**
+ * Make random edits around the surface of the origin column, relighting them incrementally in
+ * batches, then relight the same edited terrain from scratch: every cell the edits can reach
+ * (the origin column and its 8 neighbours) must end up with the same sky and block light
+ */
+bool CheckIncrementalLight()
+{
+    CheckWorld incremental;
+    CheckWorld reference;
+    if (!incremental.Generate(ChunkCoord{}, 2) || !reference.Generate(ChunkCoord{}, 2))
+        return false;
+
+    constexpr int EDIT_COUNT = 400;
+    constexpr int EDITS_PER_UPDATE = 25;
+    const BlockId blocks[] = {BLOCK_AIR, BLOCK_AIR, incremental.registry.GetId("stone"),
+                              incremental.registry.GetId("lava")};
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> local(0, Chunk::SIZE - 1);
+    std::uniform_int_distribution<int> height(-12, 6);
+    std::uniform_int_distribution<std::size_t> pick(0, std::size(blocks) - 1);
+    for (int i = 0; i < EDIT_COUNT; ++i)
+    {
+        const int x = local(rng);
+        const int z = local(rng);
+        const int y = std::clamp(incremental.SurfaceY(x, z) + height(rng), 1, WORLD_HEIGHT - 1);
+        const BlockId block = blocks[pick(rng)];
+        incremental.SetBlock(x, y, z, block);
+        reference.world.SetBlock(x, y, z, block);
+        if ((i + 1) % EDITS_PER_UPDATE == 0)
+            incremental.light.ProcessUpdates(incremental.jobs);
+    }
+    incremental.light.ProcessUpdates(incremental.jobs);
+    reference.light.LightColumns(reference.jobs, World::GetColumnsInRadius(ChunkCoord{}, 2));
+
+    int mismatches = 0;
+    for (int z = -Chunk::SIZE; z < 2 * Chunk::SIZE; ++z)
+    {
+        for (int x = -Chunk::SIZE; x < 2 * Chunk::SIZE; ++x)
+        {
+            for (int y = 0; y < WORLD_HEIGHT; ++y)
+            {
+                const int sky = incremental.light.GetSkyLight(x, y, z);
+                const int block = incremental.light.GetBlockLight(x, y, z);
+                const int expectedSky = reference.light.GetSkyLight(x, y, z);
+                const int expectedBlock = reference.light.GetBlockLight(x, y, z);
+                if (sky == expectedSky && block == expectedBlock)
+                    continue;
+
+                if (mismatches++ < 5)
+                {
+                    std::cerr << "  (" << x << ", " << y << ", " << z << ") has sky " << sky << " block " << block
+                              << ", relit from scratch it has sky " << expectedSky << " block " << expectedBlock
+                              << std::endl;
+                }
+            }
+        }
+    }
+
+    if (mismatches > 0)
+        std::cerr << "  " << mismatches << " cells differ from the lighting computed from scratch" << std::endl;
+    return mismatches == 0;
+}
+
+/**
+ * Schedule ticks whose due tick crosses every level boundary of the timing wheel (64, 4096 and
+ * 2^18 ticks) and the wrap of its top level at 2^24, some from the start and some from just
+ * before the wrap: each must fire exactly once, on the tick it was due
+ */
+bool CheckScheduledTicks()
+{
+    CheckWorld check;
+    if (!check.Generate(ChunkCoord{}, 0))
+        return false;
+
+    constexpr std::uint64_t WRAP = std::uint64_t{1} << 24;
+    constexpr std::uint32_t EARLY_DELAYS[] = {1,      63,     64,     65,       4095, 4096,     4097,
+                                              262143, 262144, 262145, WRAP - 1, WRAP, WRAP + 1, WRAP + 300000};
+    constexpr std::uint32_t LATE_DELAYS[] = {9, 10, 11, 70, 5000, 300000};
+    constexpr std::uint64_t LATE_START = WRAP - 10;
+
+    struct Expected
+    {
+        int x, y, z;
+        std::uint64_t dueTick;
+        int fired = 0;
+        std::uint64_t firedTick = 0;
+    };
+    std::vector<Expected> expected;
+
+    const BlockId stone = check.registry.GetId("stone");
+    BlockTickScheduler scheduler(check.world);
+    scheduler.AddColumns({ChunkCoord{}});
+    scheduler.SetScheduledHandler(stone, [&expected](BlockTickContext& context, int x, int y, int z, BlockId) {
+        for (Expected& entry : expected)
+        {
+            if (entry.x == x && entry.y == y && entry.z == z)
+            {
+                ++entry.fired;
+                entry.firedTick = context.GetTick();
+            }
+        }
+    });
+
+    // one position per tick, since a position holds at most one pending tick
+    auto schedule = [&](std::uint32_t delay) {
+        const int index = static_cast<int>(expected.size());
+        const Expected entry{index % Chunk::SIZE, 1 + index / Chunk::SIZE, 0, scheduler.GetCurrentTick() + delay};
+        check.world.SetBlock(entry.x, entry.y, entry.z, stone);
+        expected.push_back(entry);
+        scheduler.ScheduleTick(entry.x, entry.y, entry.z, delay);
+    };
+
+    for (const std::uint32_t delay : EARLY_DELAYS)
+    {
+        schedule(delay);
+    }
+    const std::uint64_t lastTick = WRAP + 300000 + 1;
+    while (scheduler.GetCurrentTick() < lastTick)
+    {
+        if (scheduler.GetCurrentTick() == LATE_START)
+        {
+            for (const std::uint32_t delay : LATE_DELAYS)
+            {
+                schedule(delay);
+            }
+        }
+        scheduler.Tick(check.jobs);
+    }
+
+    bool valid = true;
+    for (const Expected& entry : expected)
+    {
+        if (entry.fired != 1 || entry.firedTick != entry.dueTick)
+        {
+            std::cerr << "  tick due at " << entry.dueTick << " fired " << entry.fired << " times, last at "
+                      << entry.firedTick << std::endl;
+            valid = false;
+        }
+    }
+    if (scheduler.GetPendingTickCount() != 0)
+    {
+        std::cerr << "  " << scheduler.GetPendingTickCount() << " ticks still pending" << std::endl;
+        valid = false;
+    }
+    return valid;
+}
+
+/**
+ * Flood a 60x60 pool of water sources on a stone floor until it settles, then remove the
+ * sources and let it drain: both must settle within a few steps of the flow distance, and
+ * once the water is gone the simulator must hold no state for any column
+ */
+bool CheckFluidFlood()
+{
+    constexpr int POOL_SIZE = 60;
+    constexpr int MAX_STEPS = 32;
+    constexpr int Y = Chunk::SIZE;
+
+    BlockRegistry registry;
+    if (!registry.LoadFromFile("assets/blocks.ini"))
+        return false;
+    registry.Freeze();
+    const BlockId stone = registry.GetId("stone");
+    const BlockId water = registry.GetId("water");
+
+    JobSystem jobs;
+    World world;
+    for (int cz = -1; cz <= 2; ++cz)
+    {
+        for (int cx = -1; cx <= 2; ++cx)
+        {
+            world.GetOrCreateChunk(ChunkCoord{cx, 0, cz}).Fill(stone);
+        }
+    }
+    FluidSimulator fluids(world, registry);
+    FluidType waterType;
+    waterType.block = water;
+    if (!fluids.AddFluid(waterType))
+        return false;
+
+    auto fillPool = [&](BlockId block) {
+        for (int z = 0; z < POOL_SIZE; ++z)
+        {
+            for (int x = 0; x < POOL_SIZE; ++x)
+            {
+                world.SetBlock(x, Y, z, block);
+                fluids.OnBlockChanged(x, Y, z);
+            }
+        }
+    };
+    auto settle = [&](const char* stage) {
+        int steps = 0;
+        while (fluids.GetActiveCellCount() > 0)
+        {
+            if (++steps > MAX_STEPS)
+            {
+                std::cerr << "  " << stage << " still has " << fluids.GetActiveCellCount() << " active cells after "
+                          << MAX_STEPS << " steps" << std::endl;
+                return false;
+            }
+            fluids.Step(jobs);
+        }
+        return true;
+    };
+    auto countWater = [&]() {
+        int count = 0;
+        const int reach = waterType.maxDistance + 1;
+        for (int z = -reach; z < POOL_SIZE + reach; ++z)
+        {
+            for (int x = -reach; x < POOL_SIZE + reach; ++x)
+            {
+                count += world.GetBlock(x, Y, z) == water ? 1 : 0;
+            }
+        }
+        return count;
+    };
+
+    fillPool(water);
+    if (!settle("flood"))
+        return false;
+
+    // the pool spreads maxDistance blocks past each edge, rounded at the corners
+    const int flooded = countWater();
+    const int side = POOL_SIZE + 2 * waterType.maxDistance;
+    if (flooded <= POOL_SIZE * POOL_SIZE || flooded > side * side)
+    {
+        std::cerr << "  flood covers " << flooded << " cells, expected more than " << POOL_SIZE * POOL_SIZE
+                  << " and at most " << side * side << std::endl;
+        return false;
+    }
+
+    fillPool(BLOCK_AIR);
+    if (!settle("drain"))
+        return false;
+
+    bool valid = true;
+    if (const int left = countWater(); left != 0)
+    {
+        std::cerr << "  " << left << " water cells left after draining" << std::endl;
+        valid = false;
+    }
+    if (fluids.GetColumnCount() != 0)
+    {
+        std::cerr << "  " << fluids.GetColumnCount() << " columns still hold fluid state after draining" << std::endl;
+        valid = false;
+    }
+    return valid;
+}
+
+struct CheckPosition
+{
+    float x, y, z;
+};
+
+struct CheckTag
+{
+    std::uint32_t value;
+};
+
+/**
+ * Create 50000 entities through a command buffer and edit every other one through the handle
+ * Create returned, in the same buffer: the edits must land on the entities playback created
+ */
+bool CheckCommandBufferHandles()
+{
+    constexpr std::uint32_t COUNT = 50000;
+
+    EntityManager entities;
+    CommandBuffer commands;
+    for (std::uint32_t i = 0; i < COUNT; ++i)
+    {
+        const Entity entity = commands.Create(CheckPosition{static_cast<float>(i), 0.0f, 0.0f});
+        if (i % 2 == 0)
+            commands.Add(entity, CheckTag{i});
+        if (i % 5 == 0)
+            commands.Destroy(entity);
+    }
+    commands.Playback(entities);
+
+    std::uint32_t tagged = 0;
+    std::uint32_t mismatched = 0;
+    entities.Each<const CheckPosition, const CheckTag>([&](const CheckPosition& position, const CheckTag& tag) {
+        ++tagged;
+        mismatched += position.x == static_cast<float>(tag.value) ? 0 : 1;
+    });
+
+    // every even index is tagged, minus the multiples of 10 that were destroyed again
+    const std::uint32_t expectedTagged = COUNT / 2 - COUNT / 10;
+    const std::size_t expectedAlive = COUNT - COUNT / 5;
+    bool valid = true;
+    if (entities.GetEntityCount() != expectedAlive || tagged != expectedTagged)
+    {
+        std::cerr << "  " << entities.GetEntityCount() << " entities with " << tagged << " tagged, expected "
+                  << expectedAlive << " with " << expectedTagged << std::endl;
+        valid = false;
+    }
+    if (mismatched != 0)
+    {
+        std::cerr << "  " << mismatched << " tags landed on the wrong entity" << std::endl;
+        valid = false;
+    }
+    return valid;
+}
+
+struct Check
+{
+    const char* name;
+    bool (*run)();
+};
+
+const Check CHECKS[] = {
+    {"meshing/greedy_matches_brute_force", CheckChunkMeshes},
+    {"raycast/traversal_matches_stepping", CheckRaycasts},
+    {"raycast/sparse_tree_matches_chunks", CheckSparseTreeRaycasts},
+    {"sparse_tree/coarse_cells_match_blocks", CheckSparseTreeCoarseCells},
+    {"light/incremental_matches_full", CheckIncrementalLight},
+    {"ticks/scheduled_ticks_fire_on_time", CheckScheduledTicks},
+    {"fluid/flood_settles_and_drains", CheckFluidFlood},
+    {"ecs/command_buffer_handles", CheckCommandBufferHandles},
+};
+} // namespace
+
+int RunChecks(const std::string& filter)
+{
+    int failed = 0;
+    int run = 0;
+    for (const Check& check : CHECKS)
+    {
+        if (std::string(check.name).find(filter) == std::string::npos)
+            continue;
+
+        ++run;
+        const bool passed = check.run();
+        std::cout << (passed ? "[pass] " : "[FAIL] ") << check.name << std::endl;
+        failed += passed ? 0 : 1;
+    }
+    std::cout << run - failed << " of " << run << " checks passed" << std::endl;
+    return failed;
+}
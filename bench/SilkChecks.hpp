@@ -0,0 +1,14 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+// Correctness checks run by silk_bench --check (and ctest): each compares a fast engine path
+// against a slow reference on generated and edited terrain and reports any disagreement.
+//
+#pragma once
+#include <string>
+
+/**
+ * Run every check whose name contains filter
+ * @return Number of failed checks
+ */
+int RunChecks(const std::string& filter);
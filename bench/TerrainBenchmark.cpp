@@ -0,0 +1,172 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+// Measures world generation throughput: raw noise kernel speed (scalar vs AVX2) and
+// full chunk-column generation per core and across the job system, plus the build time
+// and footprint of sparse voxel trees for distant terrain.
+//
+#include "Core/JobSystem.hpp"
+#include "World/Generation/Noise.hpp"
+#include "World/Generation/TerrainGenerator.hpp"
+#include "World/SparseVoxelTree.hpp"
+#include "World/World.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+double SecondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+std::vector<ChunkCoord> MakeColumns(int count, int offset)
+{
+    std::vector<ChunkCoord> columns;
+    columns.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+        // spread columns out so neighbouring runs never sample the same terrain
+        columns.push_back({offset + (i % 64) * 3, 0, offset + (i / 64) * 3});
+    }
+    return columns;
+}
+
+double BenchmarkKernel(const char* name, bool simd)
+{
+    constexpr std::size_t POINTS = 1 << 16;
+    constexpr int REPETITIONS = 20;
+
+    std::vector<float> xs(POINTS), ys(POINTS), zs(POINTS), out(POINTS);
+    for (std::size_t i = 0; i < POINTS; ++i)
+    {
+        xs[i] = static_cast<float>(i % 256) * 0.37f;
+        ys[i] = static_cast<float>(i / 256) * 0.37f;
+        zs[i] = static_cast<float>(i % 97) * 0.51f;
+    }
+
+    Noise::SetSIMDEnabled(simd);
+    const Noise::FractalSettings settings{Noise::NoiseType::Simplex, 4, 0.05f, 2.0f, 0.5f};
+
+    const auto start = Clock::now();
+    for (int r = 0; r < REPETITIONS; ++r)
+    {
+        Noise::Fbm3DBatch(r, settings, xs.data(), ys.data(), zs.data(), out.data(), POINTS);
+    }
+    const double seconds = SecondsSince(start);
+    const double pointsPerSecond = static_cast<double>(POINTS) * REPETITIONS / seconds;
+
+    std::cout << "  " << name << ": " << pointsPerSecond / 1.0e6 << " Mpoints/s (4-octave 3D fBm)"
+              << std::endl;
+    return pointsPerSecond;
+}
+
+void BenchmarkColumns(const TerrainGenerator& generator, int columnCount)
+{
+    // single thread: the per-core number that bounds how fast players can explore
+    {
+        const std::vector<ChunkCoord> columns = MakeColumns(columnCount, 0);
+        std::size_t chunks = 0;
+        const auto start = Clock::now();
+        for (const ChunkCoord& coord : columns)
+        {
+            for (const auto& chunk : generator.GenerateColumn(coord.x, coord.z))
+            {
+                chunks += chunk ? 1 : 0;
+            }
+        }
+        const double seconds = SecondsSince(start);
+        std::cout << "  1 thread: " << columnCount / seconds << " columns/s, " << chunks / seconds
+                  << " chunks/s/core (" << chunks << " non-empty chunks)" << std::endl;
+    }
+
+    {
+        JobSystem jobs;
+        World world;
+        const unsigned threads = jobs.GetWorkerCount() + 1;
+        const std::vector<ChunkCoord> columns = MakeColumns(columnCount, 100000);
+
+        const auto start = Clock::now();
+        const std::size_t chunks = generator.GenerateColumns(jobs, world, columns);
+        const double seconds = SecondsSince(start);
+        std::cout << "  " << threads << " threads: " << chunks / seconds << " chunks/s total, "
+                  << chunks / seconds / threads << " chunks/s/core" << std::endl;
+    }
+}
+void BenchmarkSparseTree(const TerrainGenerator& generator, int regionCount)
+{
+    JobSystem jobs;
+    SparseVoxelTree tree;
+    double buildSeconds = 0.0;
+    std::size_t treeBytes = 0;
+    std::size_t denseBytes = 0;
+
+    for (int region = 0; region < regionCount; ++region)
+    {
+        World world;
+        std::vector<ChunkCoord> columns;
+        for (int z = 0; z < SparseVoxelTree::REGION_CHUNKS; ++z)
+        {
+            for (int x = 0; x < SparseVoxelTree::REGION_CHUNKS; ++x)
+            {
+                columns.push_back({region * SparseVoxelTree::REGION_CHUNKS + x, 0, z});
+            }
+        }
+        generator.GenerateColumns(jobs, world, columns);
+
+        const auto start = Clock::now();
+        tree.Build(region, 0, [&world](const ChunkCoord& coord) { return world.GetChunk(coord); });
+        buildSeconds += SecondsSince(start);
+
+        treeBytes += tree.GetMemoryUsage();
+        denseBytes += world.GetLoadedChunkCount() * Chunk::VOLUME * sizeof(BlockId);
+    }
+
+    // one block is one metre
+    const double squareKilometres = static_cast<double>(regionCount) * SparseVoxelTree::REGION_SIZE *
+                                    SparseVoxelTree::REGION_SIZE / 1.0e6;
+    std::cout << "  build: " << buildSeconds * 1000.0 / regionCount << " ms/region ("
+              << SparseVoxelTree::REGION_SIZE << "^3 blocks, 1 thread)" << std::endl;
+    std::cout << "  memory: " << treeBytes / squareKilometres / (1024.0 * 1024.0) << " MB/km^2 vs "
+              << denseBytes / squareKilometres / (1024.0 * 1024.0) << " MB/km^2 for dense chunks (block ids only)"
+              << std::endl;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const int columnCount = argc > 1 ? std::max(1, std::atoi(argv[1])) : 256;
+
+    std::cout << "Noise kernels:" << std::endl;
+    const double scalar = BenchmarkKernel("scalar", false);
+    Noise::SetSIMDEnabled(true);
+    if (Noise::IsSIMDActive())
+    {
+        const double simd = BenchmarkKernel("avx2  ", true);
+        std::cout << "  speedup: " << simd / scalar << "x" << std::endl;
+    }
+    else
+    {
+        std::cout << "  avx2 kernels unavailable on this CPU/build" << std::endl;
+    }
+
+    Noise::SetSIMDEnabled(true);
+    const TerrainGenerator generator;
+
+    std::cout << "Terrain generation (" << columnCount << " columns of " << Chunk::SIZE << "x"
+              << TerrainGenerator::COLUMN_HEIGHT * Chunk::SIZE << "x" << Chunk::SIZE
+              << ", simd " << (Noise::IsSIMDActive() ? "on" : "off") << "):" << std::endl;
+    BenchmarkColumns(generator, columnCount);
+
+    constexpr int REGION_COUNT = 2;
+    std::cout << "Sparse voxel tree (" << REGION_COUNT << " regions):" << std::endl;
+    BenchmarkSparseTree(generator, REGION_COUNT);
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+#
+# Created by Bisher Almasri on 2026-10-19.
+#
+# Profile-guided optimization pipeline, run by the silk_pgo target in script mode:
+#
+#   1. build a plain silk in <root>/baseline
+#   2. build an instrumented silk in <root>/optimized (SILK_PGO=GENERATE)
+#   3. run the headless camera path benchmark with it to collect profiles
+#   4. rebuild <root>/optimized against the profiles (SILK_PGO=USE); GCC keys its profile
+#      files on object paths, so the instrumented and optimized builds share a directory
+#   5. benchmark both builds and write <root>/pgo_report.md with silk_bench_compare
+#
+# Settings come from the SilkPGOSettings.cmake the main configure writes next to the pgo root.
+#
+cmake_minimum_required(VERSION 3.13)
+
+if(NOT SILK_PGO_SETTINGS OR NOT EXISTS "${SILK_PGO_SETTINGS}")
+  message(FATAL_ERROR "SilkPGO.cmake: SILK_PGO_SETTINGS is not set; run it through the silk_pgo target")
+endif()
+include("${SILK_PGO_SETTINGS}")
+separate_arguments(TRAINING_ARGS UNIX_COMMAND "${SILK_PGO_TRAINING_ARGS}")
+
+set(BASELINE_DIR "${SILK_PGO_ROOT}/baseline")
+set(OPTIMIZED_DIR "${SILK_PGO_ROOT}/optimized")
+set(PROFILE_DIR "${SILK_PGO_ROOT}/profiles")
+# a nested build can't join the outer make's job server, so give it its own job count
+if(DEFINED ENV{CMAKE_BUILD_PARALLEL_LEVEL})
+  set(BUILD_JOBS $ENV{CMAKE_BUILD_PARALLEL_LEVEL})
+else()
+  cmake_host_system_information(RESULT BUILD_JOBS QUERY NUMBER_OF_LOGICAL_CORES)
+endif()
+
+set(IS_CLANG OFF)
+if(SILK_CXX_COMPILER_ID MATCHES "Clang")
+  set(IS_CLANG ON)
+endif()
+
+function(silk_pgo_step description)
+  message(STATUS "[pgo] ${description}")
+  execute_process(COMMAND ${ARGN} RESULT_VARIABLE result)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "[pgo] ${description} failed (${result})")
+  endif()
+endfunction()
+
+function(silk_pgo_build directory stage)
+  silk_pgo_step("Configuring ${directory} (SILK_PGO=${stage})"
+          ${CMAKE_COMMAND} -S "${SILK_SOURCE_DIR}" -B "${directory}" -G "${SILK_GENERATOR}"
+          -DCMAKE_BUILD_TYPE=${SILK_BUILD_TYPE}
+          -DCMAKE_C_COMPILER=${SILK_C_COMPILER}
+          -DCMAKE_CXX_COMPILER=${SILK_CXX_COMPILER}
+          ${SILK_CACHE_ARGS}
+          -DSILK_PGO=${stage}
+          -DSILK_PGO_PROFILE_DIR=${PROFILE_DIR})
+  silk_pgo_step("Building silk in ${directory}"
+          ${CMAKE_COMMAND} --build "${directory}" --target silk --config ${SILK_BUILD_TYPE} --parallel ${BUILD_JOBS})
+endfunction()
+
+# multi-config generators put the executable in a per-config subdirectory
+function(silk_pgo_find_executable directory result)
+  foreach(candidate "${directory}/silk${SILK_EXECUTABLE_SUFFIX}" "${directory}/${SILK_BUILD_TYPE}/silk${SILK_EXECUTABLE_SUFFIX}")
+    if(EXISTS "${candidate}")
+      set(${result} "${candidate}" PARENT_SCOPE)
+      return()
+    endif()
+  endforeach()
+  message(FATAL_ERROR "[pgo] No silk executable in ${directory}")
+endfunction()
+
+# runs from the source tree so config.ini and assets resolve; outputs go under the pgo root
+function(silk_pgo_run executable name)
+  silk_pgo_step("Running ${name} benchmark"
+          "${executable}" --headless --benchmark.path=default
+          --benchmark.report=${SILK_PGO_ROOT}/${name}.json
+          --stats.frameCsv=${SILK_PGO_ROOT}/${name}_frames.csv
+          ${TRAINING_ARGS}
+          WORKING_DIRECTORY "${SILK_SOURCE_DIR}")
+endfunction()
+
+silk_pgo_build("${BASELINE_DIR}" OFF)
+silk_pgo_find_executable("${BASELINE_DIR}" BASELINE_SILK)
+
+# stale counters from an earlier run of a different build would skew or break the new one
+file(REMOVE_RECURSE "${PROFILE_DIR}")
+file(MAKE_DIRECTORY "${PROFILE_DIR}")
+silk_pgo_build("${OPTIMIZED_DIR}" GENERATE)
+silk_pgo_find_executable("${OPTIMIZED_DIR}" INSTRUMENTED_SILK)
+silk_pgo_run("${INSTRUMENTED_SILK}" training)
+
+if(IS_CLANG)
+  if(NOT SILK_PROFDATA)
+    message(FATAL_ERROR "[pgo] llvm-profdata not found; set SILK_PROFDATA to merge Clang profiles")
+  endif()
+  file(GLOB RAW_PROFILES "${PROFILE_DIR}/*.profraw")
+  if(NOT RAW_PROFILES)
+    message(FATAL_ERROR "[pgo] The training run wrote no profiles to ${PROFILE_DIR}")
+  endif()
+  silk_pgo_step("Merging profiles"
+          "${SILK_PROFDATA}" merge -output=${PROFILE_DIR}/silk.profdata ${RAW_PROFILES})
+else()
+  file(GLOB_RECURSE GCC_PROFILES "${PROFILE_DIR}/*.gcda")
+  if(NOT GCC_PROFILES)
+    message(FATAL_ERROR "[pgo] The training run wrote no profiles to ${PROFILE_DIR}")
+  endif()
+endif()
+
+silk_pgo_build("${OPTIMIZED_DIR}" USE)
+silk_pgo_find_executable("${OPTIMIZED_DIR}" OPTIMIZED_SILK)
+
+silk_pgo_run("${BASELINE_SILK}" baseline)
+silk_pgo_run("${OPTIMIZED_SILK}" optimized)
+
+silk_pgo_step("Comparing baseline and PGO builds"
+        "${SILK_COMPARE_TOOL}" "${SILK_PGO_ROOT}/baseline.json" "${SILK_PGO_ROOT}/optimized.json"
+        --out=${SILK_PGO_ROOT}/pgo_report.md --baseline-name=Baseline --candidate-name=PGO)
+message(STATUS "[pgo] Report written to ${SILK_PGO_ROOT}/pgo_report.md; optimized silk is ${OPTIMIZED_SILK}")
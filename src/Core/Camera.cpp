@@ -6,11 +6,13 @@
 
 #include <glm/ext/matrix_transform.hpp>
 
+#include <algorithm>
+
 Camera::Camera(glm::vec3 position, glm::vec3 up, float yaw, float pitch, float roll)
     : Front(glm::vec3(0.0f, 0.0f, -1.0f)), MovementSpeed(SPEED), MouseSensitivity(SENSITIVITY),
       Zoom(ZOOM)
 {
-    Position = position;
+    Position = glm::dvec3(position);
     WorldUp = up;
     Yaw = yaw;
     Pitch = pitch;
@@ -23,7 +25,7 @@ Camera::Camera(float posX, float posY, float posZ, float upX, float upY, float u
     : Front(glm::vec3(0.0f, 0.0f, -1.0f)), MovementSpeed(SPEED), MouseSensitivity(SENSITIVITY),
       Zoom(ZOOM)
 {
-    Position = glm::vec3(posX, posY, posZ);
+    Position = glm::dvec3(posX, posY, posZ);
     WorldUp = glm::vec3(upX, upY, upZ);
     Yaw = yaw;
     Pitch = pitch;
@@ -33,24 +35,24 @@ Camera::Camera(float posX, float posY, float posZ, float upX, float upY, float u
 
 glm::mat4 Camera::GetViewMatrix() const
 {
-    return glm::lookAt(Position, Position + Front, Up);
+    return glm::lookAt(glm::vec3(0.0f), Front, Up);
 }
 
 void Camera::ProcessKeyboardInput(Camera_Movement direction, float deltaTime)
 {
-    const float velocity = MovementSpeed * deltaTime;
+    const double velocity = static_cast<double>(MovementSpeed) * deltaTime;
     if (direction == FORWARD)
-        Position += Front * velocity;
+        Position += glm::dvec3(Front) * velocity;
     if (direction == BACKWARD)
-        Position -= Front * velocity;
+        Position -= glm::dvec3(Front) * velocity;
     if (direction == LEFT)
-        Position -= Right * velocity;
+        Position -= glm::dvec3(Right) * velocity;
     if (direction == RIGHT)
-        Position += Right * velocity;
+        Position += glm::dvec3(Right) * velocity;
     if (direction == UPWARD)
-        Position += Up * velocity;
+        Position += glm::dvec3(Up) * velocity;
     if (direction == DOWNWARD)
-        Position -= Up * velocity;
+        Position -= glm::dvec3(Up) * velocity;
 }
 
 void Camera::ProcessMouseInput(float xOffset, float yOffset, GLboolean constrainPitch)
@@ -73,6 +75,13 @@ void Camera::ProcessMouseInput(float xOffset, float yOffset, GLboolean constrain
     updateCameraVectors();
 }
 
+void Camera::SetOrientation(float yaw, float pitch)
+{
+    Yaw = yaw;
+    Pitch = std::clamp(pitch, -89.0f, 89.0f);
+    updateCameraVectors();
+}
+
 void Camera::ProcessMouseScroll(float yOffset)
 {
     Zoom -= static_cast<float>(yOffset);
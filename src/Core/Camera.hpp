@@ -24,10 +24,16 @@ enum Camera_Movement {
     DOWNWARD
 };
 
+/**
+ * Fly camera. The position is kept in double precision and rendering happens relative to it:
+ * the view matrix only rotates, and world positions are brought into camera space on the
+ * CPU (GetRelativePosition) before they reach the GPU as floats. This keeps vertices
+ * stable tens of thousands of blocks from the origin without rebasing the world.
+ */
 class Camera
 {
 public:
-    glm::vec3 Position{};
+    glm::dvec3 Position{};
     glm::vec3 Up{};
     glm::vec3 Right{};
     glm::vec3 Front;
@@ -49,14 +55,30 @@ public:
     Camera(float posX, float posY, float posZ, float upX, float upY, float upZ, float yaw,
            float pitch, float roll);
 
+    /**
+     * View matrix for a camera sitting at the origin (rotation only)
+     */
     glm::mat4 GetViewMatrix() const;
 
+    /**
+     * Offset of a world position from the camera, small enough to be exact as floats near the camera
+     */
+    [[nodiscard]] glm::vec3 GetRelativePosition(const glm::dvec3& worldPosition) const
+    {
+        return glm::vec3(worldPosition - Position);
+    }
+
     void ProcessKeyboardInput(Camera_Movement direction, float deltaTime);
 
     void ProcessMouseInput(float xOffset, float yOffset, GLboolean constrainPitch);
 
     void ProcessMouseScroll(float yOffset);
 
+    /**
+     * Point the camera; yaw and pitch in degrees, pitch clamped to +-89
+     */
+    void SetOrientation(float yaw, float pitch);
+
 private:
     void updateCameraVectors();
 };
@@ -0,0 +1,129 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "CameraPath.hpp"
+
+#include "Math/Math.hpp"
+#include "Math/Quaternion.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+// yaw and pitch map onto the quaternion's yaw and pitch; roll is always zero, so converting
+// back recovers them exactly while pitch stays inside +-90
+Quaternion ToRotation(float yaw, float pitch)
+{
+    return Quaternion::FromEulerAngles(0.0f, Math::ToRadians(pitch), Math::ToRadians(yaw));
+}
+} // namespace
+
+bool CameraPath::LoadFromFile(const std::string& filename)
+{
+    std::ifstream file(filename);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open camera path: " << filename << std::endl;
+        return false;
+    }
+
+    m_keyframes.clear();
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        ++lineNumber;
+        line.erase(0, line.find_first_not_of(" \t\r\n"));
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream row(line);
+        CameraKeyframe keyframe;
+        if (!(row >> keyframe.time >> keyframe.position.x >> keyframe.position.y >> keyframe.position.z >>
+              keyframe.yaw >> keyframe.pitch))
+        {
+            std::cerr << "Warning: Skipping invalid camera path line " << lineNumber << ": " << line << "\n";
+            continue;
+        }
+        if (!m_keyframes.empty() && keyframe.time < m_keyframes.back().time)
+        {
+            std::cerr << "Camera path " << filename << " goes back in time at line " << lineNumber << std::endl;
+            return false;
+        }
+        m_keyframes.push_back(keyframe);
+    }
+
+    if (m_keyframes.empty())
+    {
+        std::cerr << "Camera path has no keyframes: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+CameraPath CameraPath::CreateDefault()
+{
+    constexpr int KEYFRAME_COUNT = 17;
+    constexpr float DURATION = 24.0f;
+    constexpr float LOOPS = 2.0f;
+    constexpr float RADIUS = 48.0f;
+
+    CameraPath path;
+    for (int i = 0; i < KEYFRAME_COUNT; ++i)
+    {
+        const float t = static_cast<float>(i) / static_cast<float>(KEYFRAME_COUNT - 1);
+        const float angle = t * LOOPS * Math::TWO_PI;
+
+        CameraKeyframe keyframe;
+        keyframe.time = t * DURATION;
+        keyframe.position = Vector3(RADIUS * std::cos(angle), Math::Lerp(120.0f, 200.0f, t), RADIUS * std::sin(angle));
+        // face along the circle, looking further down as the camera climbs
+        keyframe.yaw = Math::ToDegrees(angle) + 90.0f;
+        keyframe.pitch = Math::Lerp(-15.0f, -40.0f, t);
+        path.AddKeyframe(keyframe);
+    }
+    return path;
+}
+
+void CameraPath::AddKeyframe(const CameraKeyframe& keyframe)
+{
+    const auto position = std::upper_bound(m_keyframes.begin(), m_keyframes.end(), keyframe.time,
+                                           [](float time, const CameraKeyframe& other) { return time < other.time; });
+    m_keyframes.insert(position, keyframe);
+}
+
+float CameraPath::GetDuration() const
+{
+    return m_keyframes.empty() ? 0.0f : m_keyframes.back().time;
+}
+
+CameraKeyframe CameraPath::Sample(float time) const
+{
+    if (m_keyframes.empty())
+        return {};
+    if (time <= m_keyframes.front().time)
+        return m_keyframes.front();
+    if (time >= m_keyframes.back().time)
+        return m_keyframes.back();
+
+    const auto next = std::upper_bound(m_keyframes.begin(), m_keyframes.end(), time,
+                                       [](float t, const CameraKeyframe& other) { return t < other.time; });
+    const CameraKeyframe& a = *(next - 1);
+    const CameraKeyframe& b = *next;
+    const float span = b.time - a.time;
+    const float t = span > 0.0f ? (time - a.time) / span : 1.0f;
+
+    const Vector3 angles = ToRotation(a.yaw, a.pitch).Slerp(ToRotation(b.yaw, b.pitch), t).ToEulerAngles();
+
+    CameraKeyframe result;
+    result.time = time;
+    result.position = Vector3::Lerp(a.position, b.position, t);
+    result.yaw = Math::ToDegrees(angles.z);
+    result.pitch = Math::ToDegrees(angles.y);
+    return result;
+}
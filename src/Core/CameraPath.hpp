@@ -0,0 +1,58 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Math/Vector3.hpp"
+
+#include <string>
+#include <vector>
+
+/**
+ * Camera pose at a point in time along a path; angles in degrees like Camera's
+ */
+struct CameraKeyframe
+{
+    float time = 0.0f; // seconds from the start of the path
+    Vector3 position;
+    float yaw = 0.0f;
+    float pitch = 0.0f;
+};
+
+/**
+ * Keyframed camera flight, replayed by the path benchmark so every run sees the same views.
+ * Positions are interpolated linearly and orientations along the shortest arc, so yaw may
+ * wrap between keyframes (350 to 10 turns 20 degrees, not 340).
+ */
+class CameraPath
+{
+public:
+    /**
+     * Read keyframes from a text file with one "time x y z yaw pitch" row per line, sorted
+     * by time; blank lines and lines starting with # are skipped
+     */
+    bool LoadFromFile(const std::string& filename);
+
+    /**
+     * Built-in path: two rising loops around the spawn, low enough to look at the full
+     * resolution chunks and high enough to see the LOD rings
+     */
+    static CameraPath CreateDefault();
+
+    void AddKeyframe(const CameraKeyframe& keyframe);
+
+    [[nodiscard]] bool IsEmpty() const { return m_keyframes.empty(); }
+    [[nodiscard]] std::size_t GetKeyframeCount() const { return m_keyframes.size(); }
+
+    /**
+     * Time of the last keyframe in seconds
+     */
+    [[nodiscard]] float GetDuration() const;
+
+    /**
+     * Pose at time, clamped to the ends of the path
+     */
+    [[nodiscard]] CameraKeyframe Sample(float time) const;
+
+private:
+    std::vector<CameraKeyframe> m_keyframes;
+};
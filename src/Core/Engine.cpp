@@ -3,15 +3,35 @@
 //
 
 #include "Engine.hpp"
+#include "Memory/AllocationTracker.hpp"
+#include "Memory/MemoryStats.hpp"
+#include "Memory/TransientMemory.hpp"
+#include "Profiling/Profiler.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <iostream>
 #include <ostream>
 
 Engine::Engine()
-    : m_window(nullptr)
+    : m_nextPendingColumn(0)
+    , m_generationCenter{}
+    , m_initialFillDone(false)
+    , m_lastDrawCalls(0)
+    , m_window(nullptr)
     , m_isRunning(false)
+    , m_headless(HeadlessMode::Off)
+    , m_frameLimit(0)
     , m_deltaTime(0.0f)
     , m_frameRate(0.0f)
     , m_frameTimeSampleIndex(0)
+    , m_worldSettled(false)
+    , m_checkSteadyHeap(false)
+    , m_benchmarkTimestep(0.0f)
+    , m_profileCaptureFrames(0)
+    , m_profileCaptureAtFrame(0)
+    , m_profileCaptureRequested(false)
 {
     std::fill(std::begin(m_frameTimeSamples), std::end(m_frameTimeSamples), 0.0f);
 }
@@ -26,17 +46,39 @@ bool Engine::Initialize(const EngineConfig& config)
     std::cout << "Initializing Voxel Game Engine..." << std::endl;
 
     m_config = std::make_unique<EngineConfig>(config);
-
-    if (!InitializeWindow())
-    {
-        std::cerr << "Failed to initialize window" << std::endl;
+    m_headless = ParseHeadlessMode(m_config->GetValue("engine.headless", false));
+    m_frameLimit = static_cast<std::size_t>(std::max(m_config->GetValueAs<int>("engine.frames", 0), 0));
+    if (m_headless != HeadlessMode::Off && m_frameLimit == 0)
+        m_frameLimit = DEFAULT_HEADLESS_FRAMES;
+    m_profileCaptureFrames = static_cast<std::size_t>(
+        std::max(m_config->GetValueAs<int>("profiler.captureFrames", 120), 1));
+    m_profileCaptureAtFrame = static_cast<std::size_t>(
+        std::max(m_config->GetValueAs<int>("profiler.captureAtFrame", 0), 0));
+    m_profileTracePath = m_config->GetValueAs<std::string>("profiler.tracePath", "silk_trace.json");
+    m_frameStatsPath = m_config->GetValueAs<std::string>("stats.frameCsv", "frame_stats.csv");
+    m_snapshotBakePath = m_config->GetValueAs<std::string>("snapshot.bake");
+    m_checkSteadyHeap = m_config->GetValueAs<bool>("engine.checkSteadyHeap", false);
+    if (m_config->GetMaxFPS() > 0)
+        m_frameStats.SetBudget(1000.0f / static_cast<float>(m_config->GetMaxFPS()));
+    Profiler::SetThreadName("Main");
+
+    if (!InitializeBenchmark())
         return false;
-    }
 
-    if (!InitializeGraphics())
+    // simulation-only runs never touch GLFW or GL
+    if (m_headless != HeadlessMode::Simulation)
     {
-        std::cerr << "Failed to initialize graphics" << std::endl;
-        return false;
+        if (!InitializeWindow())
+        {
+            std::cerr << "Failed to initialize window" << std::endl;
+            return false;
+        }
+
+        if (!InitializeGraphics())
+        {
+            std::cerr << "Failed to initialize graphics" << std::endl;
+            return false;
+        }
     }
 
     if (!InitializeSystems())
@@ -60,21 +102,123 @@ int Engine::Run()
         return -1;
     }
 
-    while (!glfwWindowShouldClose(m_window))
+    std::size_t heapAllocations = MemoryStats::GetHeapAllocationCount();
+    std::size_t lastGrowthFrame = 0;
+    std::size_t settledFrames = 0;
+    std::size_t settledAllocations = 0;
+    std::size_t lastSettledAllocationFrame = 0;
+    std::size_t frame = 0;
+    const auto loopStart = std::chrono::high_resolution_clock::now();
+    while (!IsFinished(frame))
     {
+        // captures start on a frame boundary, from the hotkey or at a configured frame
+        if (m_profileCaptureRequested || (m_profileCaptureAtFrame > 0 && frame == m_profileCaptureAtFrame))
+        {
+            Profiler::RequestCapture(m_profileCaptureFrames, m_profileTracePath);
+            m_profileCaptureRequested = false;
+        }
+
+        // everything allocated for the previous frame is dropped at once
+        GetFrameArena().Reset();
+
+        // arenas and pools only go to the heap while they grow to the working set
+        if (const std::size_t count = MemoryStats::GetHeapAllocationCount(); count != heapAllocations)
+        {
+            heapAllocations = count;
+            lastGrowthFrame = frame;
+        }
+        ++frame;
+
         UpdateTiming();
+        if (m_cameraPath)
+            FollowCameraPath(frame - 1);
 
-        glfwPollEvents();
+        if (m_window)
+            glfwPollEvents();
 
         Update();
 
-        Render();
-
-        glfwSwapBuffers(m_window);
+        if (m_window)
+        {
+            Render();
+
+            PROFILE_SCOPE("SwapBuffers");
+            glfwSwapBuffers(m_window);
+        }
+
+        AllocationTracker::EndFrame();
+        if (m_worldSettled)
+        {
+            ++settledFrames;
+            if (const std::size_t allocations = AllocationTracker::GetFrameHeapAllocations(); allocations > 0)
+            {
+                settledAllocations += allocations;
+                lastSettledAllocationFrame = frame;
+            }
+        }
+        if (m_pathBenchmark)
+            m_pathBenchmark->SampleMemory();
+        Profiler::EndFrame();
     }
 
     std::cout << "Engine loop ended" << std::endl;
-    return 0;
+    int exitCode = 0;
+    const std::chrono::duration<double> loopTime = std::chrono::high_resolution_clock::now() - loopStart;
+    std::cout << "Ran " << frame << " frames in " << loopTime.count() << " s" << std::endl;
+    const FrameStatsSummary frameSummary = m_frameStats.GetSummary();
+    std::cout << "Frame times over " << frameSummary.frameCount << " frames: p50 " << frameSummary.p50 << " ms, p95 "
+              << frameSummary.p95 << " ms, p99 " << frameSummary.p99 << " ms, max " << frameSummary.max
+              << " ms, stddev " << frameSummary.standardDeviation << " ms, " << frameSummary.overBudget
+              << " over the " << frameSummary.budget << " ms budget" << std::endl;
+    if (!m_frameStatsPath.empty() && m_frameStats.WriteCsv(m_frameStatsPath))
+        std::cout << "Frame stats written to " << m_frameStatsPath << std::endl;
+    if (m_pathBenchmark)
+    {
+        PathBenchmarkInfo info;
+        info.path = m_benchmarkPathName;
+        info.mode = m_headless == HeadlessMode::Simulation ? "simulation"
+                    : m_headless == HeadlessMode::Offscreen ? "offscreen"
+                                                            : "windowed";
+        info.seed = m_config->GetValueAs<int>("world.seed", TerrainSettings{}.seed);
+        info.renderDistance = m_config->GetRenderDistance();
+        info.workerCount = m_jobSystem->GetWorkerCount();
+        info.timestep = m_benchmarkTimestep;
+        info.frames = frame;
+        info.wallSeconds = loopTime.count();
+        if (m_pathBenchmark->WriteJson(m_benchmarkReportPath, m_frameStats, info))
+            std::cout << "Benchmark report written to " << m_benchmarkReportPath << std::endl;
+    }
+    // e.g. silk --headless --engine.frames=600 --snapshot.bake=world.silkw, then run with
+    // --world.snapshot=world.silkw to skip generation
+    if (!m_snapshotBakePath.empty() && !WorldSnapshot::Bake(*m_world, m_snapshotBakePath))
+        exitCode = 1;
+
+    std::cout << "Frame arena peak " << GetFrameArena().GetPeakUsed() / 1024 << " KB, " << heapAllocations
+              << " arena/pool heap allocations, last in frame " << lastGrowthFrame << " of " << frame << std::endl;
+    for (std::size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+    {
+        const auto tag = static_cast<MemoryTag>(i);
+        const MemoryTagStats heap = AllocationTracker::GetHeapStats(tag);
+        const MemoryTagStats gpu = AllocationTracker::GetGpuStats(tag);
+        std::cout << "  " << GetMemoryTagName(tag) << ": heap " << heap.currentBytes / 1024 << " KB ("
+                  << heap.allocations << " allocations last frame), GPU " << gpu.currentBytes / 1024 << " KB"
+                  << std::endl;
+    }
+
+    if (AllocationTracker::IsHeapTrackingEnabled())
+    {
+        std::cout << settledAllocations << " heap allocations in " << settledFrames
+                  << " frames without generation or meshing";
+        if (settledAllocations > 0)
+            std::cout << ", last in frame " << lastSettledAllocationFrame;
+        std::cout << std::endl;
+        if (m_checkSteadyHeap && settledAllocations > 0)
+        {
+            std::cerr << "Steady state heap check failed: settled frames allocated" << std::endl;
+            exitCode = 1;
+        }
+    }
+    return exitCode;
 }
 
 void Engine::Shutdown()
@@ -85,6 +229,19 @@ void Engine::Shutdown()
     std::cout << "Shutting down Engine " << std::endl;
     m_isRunning = false;
 
+    m_perfOverlay.reset();
+    m_gpuProfiler.reset();
+    m_worldRenderer.reset();
+    m_lodStore.reset();
+    m_fluidSimulator.reset();
+    m_blockTicker.reset();
+    m_lightEngine.reset();
+    m_blockRegistry.reset();
+    m_terrainGenerator.reset();
+    m_worldSnapshot.reset();
+    m_world.reset();
+    m_jobSystem.reset();
+
     if (m_window)
     {
         glfwDestroyWindow(m_window);
@@ -112,14 +269,31 @@ bool Engine::InitializeWindow()
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
 
+    const bool offscreen = m_headless == HeadlessMode::Offscreen;
+    if (offscreen)
+    {
+        // a hidden window still needs a display server (Xvfb will do); an EGL context lets
+        // Mesa fall back to a software rasterizer such as llvmpipe on machines without a GPU
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+    }
+
     m_window = glfwCreateWindow(
         m_config->GetWindowWidth(),
         m_config->GetWindowHeight(),
         m_config->GetWindowTitle().c_str(),
-        m_config->IsFullscreen() ? glfwGetPrimaryMonitor() : nullptr,
+        m_config->IsFullscreen() && !offscreen ? glfwGetPrimaryMonitor() : nullptr,
         nullptr
         );
 
+    if (!m_window && offscreen)
+    {
+        std::cout << "No EGL context, retrying offscreen with the native context API" << std::endl;
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_NATIVE_CONTEXT_API);
+        m_window = glfwCreateWindow(m_config->GetWindowWidth(), m_config->GetWindowHeight(),
+                                    m_config->GetWindowTitle().c_str(), nullptr, nullptr);
+    }
+
     if (!m_window)
     {
         std::cerr << "Failed to create GLFW window" << std::endl;
@@ -131,8 +305,10 @@ bool Engine::InitializeWindow()
 
     glfwSetWindowUserPointer(m_window, this);
     glfwSetFramebufferSizeCallback(m_window, OnWindowResize);
+    glfwSetKeyCallback(m_window, OnKey);
 
-    glfwSwapInterval(m_config->IsVSyncEnabled() ? 1 : 0);
+    // headless runs measure the engine, not the display
+    glfwSwapInterval(m_config->IsVSyncEnabled() && !offscreen ? 1 : 0);
 
     return true;
 }
@@ -154,6 +330,23 @@ bool Engine::InitializeGraphics()
 
     glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
 
+    // timer queries are only worth issuing when the scopes they feed are compiled in
+    if (Profiler::IsEnabled())
+    {
+        m_gpuProfiler = std::make_unique<GpuProfiler>();
+        if (!m_gpuProfiler->Initialize())
+            std::cerr << "Failed to create GPU timer queries" << std::endl;
+    }
+
+    if (m_headless == HeadlessMode::Off)
+    {
+        m_perfOverlay = std::make_unique<PerfOverlay>();
+        if (m_perfOverlay->Initialize(m_window))
+            m_perfOverlay->SetVisible(m_config->GetValueAs<bool>("debug.perfOverlay", false));
+        else
+            m_perfOverlay.reset();
+    }
+
     std::cout << "OpenGL Version: " << glGetString(GL_VERSION) << std::endl;
     std::cout << "OpenGL Renderer: " << glGetString(GL_RENDERER) << std::endl;
 
@@ -168,6 +361,9 @@ void Engine::UpdateTiming()
     m_lastFrameTime = currentTime;
     m_frameTimeSamples[m_frameTimeSampleIndex] = m_deltaTime;
     m_frameTimeSampleIndex = (m_frameTimeSampleIndex + 1) % FRAME_RATE_SAMPLE_COUNT;
+    m_frameStats.Record(m_deltaTime);
+    if (m_perfOverlay)
+        m_perfOverlay->AddFrameTime(m_deltaTime);
 
     float averageFrameTime = 0.0f;
     for (const float m_frameTimeSample : m_frameTimeSamples)
@@ -181,23 +377,365 @@ void Engine::UpdateTiming()
 
 void Engine::Update()
 {
-    // Todo
+    PROFILE_SCOPE("Update");
+    const MemoryTagScope worldTag(MemoryTag::World);
+    const std::uint64_t generationStart = Profiler::Now();
+    const std::size_t generated = UpdateWorldGeneration();
+    if (m_pathBenchmark)
+        m_pathBenchmark->RecordGeneration(generated, Profiler::Now() - generationStart, m_initialFillDone);
+
+    {
+        PROFILE_SCOPE("BlockTicks");
+        m_blockTicker->Update(*m_jobSystem, m_deltaTime);
+        for (const BlockChange& change : m_blockTicker->GetChanges())
+        {
+            m_lightEngine->OnBlockChanged(change.x, change.y, change.z, change.oldBlock, change.newBlock);
+            m_fluidSimulator->OnBlockChanged(change.x, change.y, change.z);
+        }
+    }
+
+    {
+        PROFILE_SCOPE("Fluids");
+        m_fluidSimulator->Update(*m_jobSystem, m_deltaTime);
+        for (const BlockChange& change : m_fluidSimulator->GetChanges())
+        {
+            m_lightEngine->OnBlockChanged(change.x, change.y, change.z, change.oldBlock, change.newBlock);
+        }
+    }
+
+    {
+        PROFILE_SCOPE("Light");
+        m_lightEngine->ProcessUpdates(*m_jobSystem);
+    }
+
+    const MemoryTagScope meshTag(MemoryTag::Meshes);
+    const std::uint64_t meshingStart = Profiler::Now();
+    m_worldRenderer->Update(*m_jobSystem, m_camera.Position);
+    if (m_pathBenchmark)
+        m_pathBenchmark->RecordMeshing(m_worldRenderer->GetMeshTaskCount(), Profiler::Now() - meshingStart);
+    m_worldSettled = generated == 0 && m_worldRenderer->GetMeshTaskCount() == 0;
+}
+
+std::size_t Engine::UpdateWorldGeneration()
+{
+    if (!m_terrainGenerator && !m_worldSnapshot)
+        return 0;
+
+    // the queue is built around the camera and rebuilt whenever it crosses into another column
+    if (const ChunkCoord cameraColumn = GetCameraColumn(); cameraColumn != m_generationCenter)
+    {
+        EvictColumnsOutside(cameraColumn);
+        QueueColumnsAround(cameraColumn);
+        m_initialFillDone = true;
+    }
+    if (m_nextPendingColumn >= m_pendingColumns.size())
+    {
+        m_initialFillDone = true;
+        return 0;
+    }
+    PROFILE_SCOPE("WorldGeneration");
+
+    // one column per thread keeps the frame cost near a single column's generation time
+    const std::size_t budget = m_jobSystem->GetWorkerCount() + 1;
+    const std::size_t end = std::min(m_nextPendingColumn + budget, m_pendingColumns.size());
+
+    m_generateFullDetail.clear();
+    m_generateLodOnly.clear();
+    for (std::size_t i = m_nextPendingColumn; i < end; ++i)
+    {
+        const PendingColumn& pending = m_pendingColumns[i];
+        (pending.fullDetail ? m_generateFullDetail : m_generateLodOnly).push_back(pending.column);
+        m_generatedColumns[pending.column] = pending.fullDetail;
+    }
+    m_nextPendingColumn = end;
+
+    // baked worlds go through the same queue, reading columns from the snapshot instead
+    if (!m_generateFullDetail.empty())
+    {
+        if (m_worldSnapshot)
+        {
+            for (const ChunkCoord& column : m_generateFullDetail)
+            {
+                m_worldSnapshot->LoadColumn(*m_world, column.x, column.z);
+            }
+        }
+        else
+        {
+            m_terrainGenerator->GenerateColumns(*m_jobSystem, *m_world, m_generateFullDetail);
+        }
+        m_lightEngine->LightColumns(*m_jobSystem, m_generateFullDetail);
+        m_blockTicker->AddColumns(m_generateFullDetail);
+        m_worldRenderer->AddColumns(m_generateFullDetail, true);
+    }
+    if (!m_generateLodOnly.empty())
+    {
+        if (m_worldSnapshot)
+            m_worldSnapshot->LoadLodColumns(*m_jobSystem, *m_lodStore, m_generateLodOnly);
+        else
+            m_terrainGenerator->GenerateLodColumns(*m_jobSystem, *m_lodStore, m_generateLodOnly);
+        m_worldRenderer->AddColumns(m_generateLodOnly, false);
+    }
+    return m_generateFullDetail.size() + m_generateLodOnly.size();
+}
+
+void Engine::QueueColumnsAround(const ChunkCoord& center)
+{
+    m_generationCenter = center;
+    m_pendingColumns.clear();
+    m_nextPendingColumn = 0;
+
+    // full resolution within the render distance, then one band per LOD level beyond it;
+    // columns generated downsampled earlier are generated again in full once they come close
+    const int renderDistance = m_config->GetRenderDistance();
+    for (const ChunkCoord& column : World::GetColumnsInRadius(center, renderDistance * (ChunkLod::MAX_LEVEL + 1)))
+    {
+        const bool fullDetail =
+            std::abs(column.x - center.x) <= renderDistance && std::abs(column.z - center.z) <= renderDistance;
+        const auto generated = m_generatedColumns.find(column);
+        if (generated == m_generatedColumns.end() || (fullDetail && !generated->second))
+            m_pendingColumns.push_back({column, fullDetail});
+    }
+}
+
+void Engine::EvictColumnsOutside(const ChunkCoord& center)
+{
+    // a couple of columns past the band, so moving back and forth across a column border
+    // does not unload and regenerate the outermost ring every time
+    constexpr int EVICTION_MARGIN = 2;
+    const int radius = m_config->GetRenderDistance() * (ChunkLod::MAX_LEVEL + 1) + EVICTION_MARGIN;
+
+    m_evictedColumns.clear();
+    for (auto it = m_generatedColumns.begin(); it != m_generatedColumns.end();)
+    {
+        if (std::abs(it->first.x - center.x) > radius || std::abs(it->first.z - center.z) > radius)
+        {
+            m_evictedColumns.push_back(it->first);
+            it = m_generatedColumns.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    if (m_evictedColumns.empty())
+        return;
+
+    PROFILE_SCOPE("EvictColumns");
+    m_blockTicker->RemoveColumns(m_evictedColumns);
+    m_fluidSimulator->RemoveColumns(m_evictedColumns);
+    m_lightEngine->RemoveColumns(m_evictedColumns);
+    m_worldRenderer->RemoveColumns(m_evictedColumns);
+    for (const ChunkCoord& column : m_evictedColumns)
+    {
+        for (int y = 0; y < WORLD_HEIGHT_CHUNKS; ++y)
+        {
+            m_lodStore->Remove(ChunkCoord{column.x, y, column.z});
+        }
+    }
+    // also catches chunks that edits created outside the generated columns
+    m_world->UnloadOutsideRadius(center, radius);
+}
+
+void Engine::RegisterBlockBehaviors(const TerrainSettings& terrain)
+{
+    FluidType water;
+    water.block = terrain.waterBlock;
+    m_fluidSimulator->AddFluid(water);
+
+    // lava is slow and short, and hardens where it meets water
+    if (const BlockId lavaBlock = m_blockRegistry->GetId("lava"); lavaBlock != BLOCK_AIR)
+    {
+        FluidType lava;
+        lava.block = lavaBlock;
+        lava.maxDistance = 3;
+        lava.stepInterval = 6;
+        lava.solidifiesInto = terrain.stoneBlock;
+        m_fluidSimulator->AddFluid(lava);
+    }
+
+    // grass spreads onto nearby dirt that is open to the air
+    m_blockTicker->SetRandomHandler(
+        terrain.grassBlock, [registry = m_blockRegistry.get(), grass = terrain.grassBlock, dirt = terrain.dirtBlock](
+                                BlockTickContext& context, int x, int y, int z, BlockId) {
+            if (registry->IsOpaque(context.GetBlock(x, y + 1, z)))
+            {
+                context.SetBlock(x, y, z, dirt);
+                return;
+            }
+
+            const std::uint32_t random = context.NextRandom();
+            const int targetX = x + static_cast<int>(random % 3) - 1;
+            const int targetY = y + static_cast<int>((random >> 8) % 3) - 1;
+            const int targetZ = z + static_cast<int>((random >> 16) % 3) - 1;
+            if (context.GetBlock(targetX, targetY, targetZ) == dirt &&
+                !registry->IsOpaque(context.GetBlock(targetX, targetY + 1, targetZ)))
+            {
+                context.SetBlock(targetX, targetY, targetZ, grass);
+            }
+        });
 }
 
 void Engine::Render()
 {
+    PROFILE_SCOPE("Render");
+    if (m_gpuProfiler)
+        m_gpuProfiler->BeginFrame();
+
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    const float aspect = static_cast<float>(m_config->GetWindowWidth()) /
+                         static_cast<float>(std::max(m_config->GetWindowHeight(), 1));
+    const glm::mat4 projection = glm::perspective(glm::radians(m_config->GetFieldOfView()), aspect,
+                                                  m_config->GetNearPlane(), m_config->GetFarPlane());
+    {
+        GPU_PROFILE_SCOPE(m_gpuProfiler.get(), "Terrain");
+        m_lastDrawCalls = m_worldRenderer->Render(m_camera.GetViewMatrix(), projection, m_camera.Position);
+    }
+
+    // the peak is taken every frame so it covers one frame even while the overlay is hidden
+    const std::size_t peakQueueDepth = m_jobSystem->TakePeakQueueDepth();
+    if (m_perfOverlay && m_perfOverlay->IsVisible())
+    {
+        PerfOverlayStats stats;
+        stats.drawCalls = m_lastDrawCalls;
+        stats.triangles = m_worldRenderer->GetTriangleCount();
+        stats.loadedChunks = m_world->GetLoadedChunkCount();
+        stats.meshedChunks = m_worldRenderer->GetMeshCount();
+        stats.meshTasks = m_worldRenderer->GetMeshTaskCount();
+        stats.pendingColumns = m_worldRenderer->GetPendingColumnCount();
+        stats.workerCount = m_jobSystem->GetWorkerCount();
+        stats.peakQueueDepth = peakQueueDepth;
+        RaycastHit target;
+        if (GetTargetBlock(target))
+        {
+            stats.targetBlock = m_blockRegistry->GetName(target.block).c_str();
+            stats.targetX = target.x;
+            stats.targetY = target.y;
+            stats.targetZ = target.z;
+        }
+        m_perfOverlay->Render(stats, m_frameStats, m_gpuProfiler.get());
+    }
+
+    if (m_gpuProfiler)
+        m_gpuProfiler->EndFrame();
 }
 
 bool Engine::InitializeSystems()
 {
-    
     std::cout << "Initializing engine systems..." << std::endl;
+    const MemoryTagScope worldTag(MemoryTag::World);
+
+    m_jobSystem = std::make_unique<JobSystem>();
+    m_world = std::make_unique<World>();
+
+    // block ids are fixed from here on; everything below may cache lookups
+    m_blockRegistry = std::make_unique<BlockRegistry>();
+    const auto blocksPath = m_config->GetValueAs<std::string>("world.blocks", "assets/blocks.ini");
+    if (!m_blockRegistry->LoadFromFile(blocksPath))
+    {
+        std::cerr << "Failed to load block definitions: " << blocksPath << std::endl;
+        return false;
+    }
+    m_blockRegistry->Freeze();
+
+    TerrainSettings terrain;
+    terrain.stoneBlock = m_blockRegistry->GetId("stone");
+    terrain.dirtBlock = m_blockRegistry->GetId("dirt");
+    terrain.grassBlock = m_blockRegistry->GetId("grass");
+    terrain.waterBlock = m_blockRegistry->GetId("water");
+    m_lightEngine = std::make_unique<LightEngine>(*m_world, *m_blockRegistry);
+    m_blockTicker = std::make_unique<BlockTickScheduler>(*m_world);
+    m_fluidSimulator = std::make_unique<FluidSimulator>(*m_world, *m_blockRegistry);
+    RegisterBlockBehaviors(terrain);
+
+    const int renderDistance = m_config->GetRenderDistance();
+    m_lodStore = std::make_unique<LodStore>();
+    m_worldRenderer = std::make_unique<WorldRenderer>(*m_world, *m_lodStore, *m_blockRegistry, renderDistance);
+    if (m_window && !m_worldRenderer->Initialize("assets/shaders/chunk_vert.glsl", "assets/shaders/chunk_frag.glsl"))
+    {
+        std::cerr << "Failed to initialize world renderer" << std::endl;
+        return false;
+    }
+    m_camera = Camera(glm::vec3(0.0f, terrain.baseHeight + terrain.heightAmplitude, 0.0f),
+                      glm::vec3(0.0f, 1.0f, 0.0f), YAW, -20.0f);
+    // benchmark runs start where their path does, so the world loads there first
+    if (m_cameraPath)
+        FollowCameraPath(0);
+    const ChunkCoord cameraColumn = GetCameraColumn();
+
+    // baked worlds are mapped, not read; columns are only touched once the camera nears them
+    if (const auto snapshotPath = m_config->GetValueAs<std::string>("world.snapshot");
+        !snapshotPath.empty())
+    {
+        m_worldSnapshot = std::make_unique<WorldSnapshot>();
+        if (!m_worldSnapshot->Open(snapshotPath))
+        {
+            std::cerr << "Failed to open world snapshot: " << snapshotPath << std::endl;
+            return false;
+        }
+    }
+    else
+    {
+        terrain.seed = m_config->GetValueAs<int>("world.seed", terrain.seed);
+        m_terrainGenerator = std::make_unique<TerrainGenerator>(terrain);
+    }
+    QueueColumnsAround(cameraColumn);
+
+    std::cout << "Job system running with " << m_jobSystem->GetWorkerCount() << " workers"
+              << std::endl;
 
     std::cout << "Engine systems initialized successfully" << std::endl;
     return true;
 }
 
+bool Engine::InitializeBenchmark()
+{
+    m_benchmarkPathName = m_config->GetValueAs<std::string>("benchmark.path");
+    if (m_benchmarkPathName.empty())
+        return true;
+
+    m_cameraPath = std::make_unique<CameraPath>();
+    if (m_benchmarkPathName == "default")
+        *m_cameraPath = CameraPath::CreateDefault();
+    else if (!m_cameraPath->LoadFromFile(m_benchmarkPathName))
+        return false;
+
+    // a fixed step makes the path and the simulation the same on every machine; the frame
+    // times recorded are still the real ones
+    m_benchmarkTimestep = m_config->GetValueAs<float>("benchmark.timestep", 1.0f / 60.0f);
+    if (m_benchmarkTimestep <= 0.0f)
+    {
+        std::cerr << "benchmark.timestep must be positive" << std::endl;
+        return false;
+    }
+    m_frameLimit = static_cast<std::size_t>(std::ceil(m_cameraPath->GetDuration() / m_benchmarkTimestep)) + 1;
+    m_benchmarkReportPath = m_config->GetValueAs<std::string>("benchmark.report", "benchmark.json");
+    m_pathBenchmark = std::make_unique<PathBenchmark>();
+
+    std::cout << "Benchmarking camera path " << m_benchmarkPathName << ": " << m_cameraPath->GetKeyframeCount()
+              << " keyframes, " << m_frameLimit << " frames" << std::endl;
+    return true;
+}
+
+ChunkCoord Engine::GetCameraColumn() const
+{
+    return {static_cast<int>(std::floor(m_camera.Position.x / Chunk::SIZE)), 0,
+            static_cast<int>(std::floor(m_camera.Position.z / Chunk::SIZE))};
+}
+
+bool Engine::GetTargetBlock(RaycastHit& hit, float reach) const
+{
+    const Ray ray{m_camera.Position, Vector3(m_camera.Front.x, m_camera.Front.y, m_camera.Front.z), reach};
+    return VoxelRaycaster(*m_world, nullptr).Cast(ray, hit);
+}
+
+void Engine::FollowCameraPath(std::size_t frame)
+{
+    const CameraKeyframe pose = m_cameraPath->Sample(static_cast<float>(frame) * m_benchmarkTimestep);
+    m_camera.Position = glm::dvec3(pose.position.x, pose.position.y, pose.position.z);
+    m_camera.SetOrientation(pose.yaw, pose.pitch);
+    m_deltaTime = m_benchmarkTimestep;
+}
 
 void Engine::OnWindowResize(GLFWwindow* window, const int width, const int height)
 {
@@ -208,6 +746,42 @@ void Engine::OnWindowResize(GLFWwindow* window, const int width, const int heigh
     }
 }
 
+bool Engine::IsFinished(std::size_t frame) const
+{
+    if (m_frameLimit > 0 && frame >= m_frameLimit)
+        return true;
+    return m_window && glfwWindowShouldClose(m_window);
+}
+
+HeadlessMode Engine::ParseHeadlessMode(const EngineConfig::ConfigValue& value)
+{
+    if (const bool* enabled = std::get_if<bool>(&value))
+        return *enabled ? HeadlessMode::Simulation : HeadlessMode::Off;
+
+    if (const std::string* mode = std::get_if<std::string>(&value))
+    {
+        if (*mode == "simulation")
+            return HeadlessMode::Simulation;
+        if (*mode == "offscreen")
+            return HeadlessMode::Offscreen;
+        if (!mode->empty() && *mode != "off")
+            std::cerr << "Unknown engine.headless mode " << *mode << ", running windowed" << std::endl;
+    }
+    return HeadlessMode::Off;
+}
+
+void Engine::OnKey(GLFWwindow* window, int key, int, int action, int)
+{
+    auto* engine = static_cast<Engine*>(glfwGetWindowUserPointer(window));
+    if (!engine || action != GLFW_PRESS)
+        return;
+
+    if (key == PERF_OVERLAY_KEY && engine->m_perfOverlay)
+        engine->m_perfOverlay->Toggle();
+    else if (key == PROFILE_CAPTURE_KEY)
+        engine->m_profileCaptureRequested = true;
+}
+
 void Engine::OnGLFWError(int error, const char* description)
 {
     std::cerr << "GLFW Error " << error << ": " << description << std::endl;
@@ -1,16 +1,45 @@
 #pragma once
 
+#include "Camera.hpp"
+#include "CameraPath.hpp"
 #include "EngineConfig.hpp"
+#include "JobSystem.hpp"
+#include "Profiling/FrameStats.hpp"
+#include "Profiling/PathBenchmark.hpp"
+#include "Rendering/GpuProfiler.hpp"
+#include "Rendering/PerfOverlay.hpp"
+#include "Rendering/WorldRenderer.hpp"
+#include "World/BlockRegistry.hpp"
+#include "World/BlockTickScheduler.hpp"
+#include "World/ChunkLod.hpp"
+#include "World/FluidSimulator.hpp"
+#include "World/Generation/TerrainGenerator.hpp"
+#include "World/LightEngine.hpp"
+#include "World/VoxelRaycaster.hpp"
+#include "World/World.hpp"
+#include "World/WorldSnapshot.hpp"
 // clang-format off
 #include "glad/glad.h"
 // clang-format on
 
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include <chrono>
 #include <GLFW/glfw3.h>
 
 
+/**
+ * How the engine runs without a visible window (engine.headless)
+ */
+enum class HeadlessMode
+{
+    Off,
+    Simulation, // no window and no GL; chunks are still meshed but never uploaded
+    Offscreen // hidden window with a real GL context, e.g. llvmpipe on a build machine
+};
+
 /**
  * Core engine class that manages initialization, main loop coordination,
  * and system lifecycle management for the voxel game engine.
@@ -52,6 +81,11 @@ public:
      */
     [[nodiscard]] float GetFrameRate() const { return m_frameRate; }
 
+    /**
+     * Distribution of every frame time since the loop started
+     */
+    [[nodiscard]] const FrameStats& GetFrameStats() const { return m_frameStats; }
+
     /**
      * Get the GLFW window handle
      */
@@ -62,12 +96,68 @@ public:
      */
     [[nodiscard]] bool IsRunning() const { return m_isRunning; }
 
+    [[nodiscard]] HeadlessMode GetHeadlessMode() const { return m_headless; }
+
+    /**
+     * Get the world currently loaded by the engine
+     */
+    [[nodiscard]] World* GetWorld() const { return m_world.get(); }
+
+    /**
+     * Get the camera the world is rendered from
+     */
+    [[nodiscard]] Camera& GetCamera() { return m_camera; }
+
+    /**
+     * Find the block the camera is looking at
+     * @return True if a non-air block is within reach
+     */
+    bool GetTargetBlock(RaycastHit& hit, float reach = 8.0f) const;
+
 private:
     std::unique_ptr<EngineConfig> m_config;
 
+    std::unique_ptr<JobSystem> m_jobSystem;
+    std::unique_ptr<World> m_world;
+    std::unique_ptr<WorldSnapshot> m_worldSnapshot;
+    std::unique_ptr<TerrainGenerator> m_terrainGenerator;
+    std::unique_ptr<BlockRegistry> m_blockRegistry;
+    std::unique_ptr<LightEngine> m_lightEngine;
+    std::unique_ptr<BlockTickScheduler> m_blockTicker;
+    std::unique_ptr<FluidSimulator> m_fluidSimulator;
+
+    /**
+     * A column still to generate; full detail columns keep their voxels in the world, the
+     * rest only get downsampled data in the LodStore
+     */
+    struct PendingColumn
+    {
+        ChunkCoord column;
+        bool fullDetail;
+    };
+
+    std::vector<PendingColumn> m_pendingColumns; // nearest the generation center first
+    std::size_t m_nextPendingColumn;
+    ChunkCoord m_generationCenter;
+    bool m_initialFillDone; // the first queue emptied or the camera left its starting column
+    std::unordered_map<ChunkCoord, bool, ChunkCoordHash> m_generatedColumns; // true if full detail
+    std::vector<ChunkCoord> m_evictedColumns; // reused
+    std::vector<ChunkCoord> m_generateFullDetail; // per-frame batches, reused
+    std::vector<ChunkCoord> m_generateLodOnly;
+    std::unique_ptr<LodStore> m_lodStore;
+    std::unique_ptr<WorldRenderer> m_worldRenderer;
+    std::unique_ptr<GpuProfiler> m_gpuProfiler;
+    std::unique_ptr<PerfOverlay> m_perfOverlay;
+    std::size_t m_lastDrawCalls;
+    Camera m_camera;
+
     GLFWwindow* m_window;
     bool m_isRunning;
 
+    static constexpr std::size_t DEFAULT_HEADLESS_FRAMES = 600;
+    HeadlessMode m_headless;
+    std::size_t m_frameLimit; // engine.frames; 0 runs until the window closes
+
     std::chrono::high_resolution_clock::time_point m_lastFrameTime;
     float m_deltaTime;
     float m_frameRate;
@@ -75,6 +165,27 @@ private:
     static constexpr int FRAME_RATE_SAMPLE_COUNT = 60;
     float m_frameTimeSamples[FRAME_RATE_SAMPLE_COUNT]{};
     int m_frameTimeSampleIndex;
+    FrameStats m_frameStats;
+    std::string m_frameStatsPath; // written at the end of Run; empty disables
+    std::string m_snapshotBakePath; // snapshot.bake: the world is baked here at the end of Run
+    // set by Update when the frame generated and meshed nothing; such frames should not touch
+    // the heap, and engine.checkSteadyHeap fails the run if they do
+    bool m_worldSettled;
+    bool m_checkSteadyHeap;
+
+    // benchmark.path: the camera flies a fixed path at a fixed timestep and the run ends with it
+    std::unique_ptr<CameraPath> m_cameraPath;
+    std::unique_ptr<PathBenchmark> m_pathBenchmark;
+    std::string m_benchmarkPathName;
+    std::string m_benchmarkReportPath;
+    float m_benchmarkTimestep;
+
+    static constexpr int PERF_OVERLAY_KEY = GLFW_KEY_F3;
+    static constexpr int PROFILE_CAPTURE_KEY = GLFW_KEY_F12;
+    std::size_t m_profileCaptureFrames;
+    std::size_t m_profileCaptureAtFrame; // 0 disables the automatic capture
+    std::string m_profileTracePath;
+    bool m_profileCaptureRequested;
 
     /**
      * Initialize GLFW and create the main window
@@ -91,6 +202,28 @@ private:
      */
     bool InitializeSystems();
 
+    /**
+     * Load the camera path named by benchmark.path and size the run to it
+     */
+    bool InitializeBenchmark();
+
+    /**
+     * Chunk column the camera is in (y is 0)
+     */
+    [[nodiscard]] ChunkCoord GetCameraColumn() const;
+
+    /**
+     * Move the camera to where the path is at the given frame
+     */
+    void FollowCameraPath(std::size_t frame);
+
+    /**
+     * True once the frame limit is reached or the window was closed
+     */
+    [[nodiscard]] bool IsFinished(std::size_t frame) const;
+
+    static HeadlessMode ParseHeadlessMode(const EngineConfig::ConfigValue& value);
+
     /**
      * Update engine timing information
      */
@@ -101,6 +234,28 @@ private:
      */
     void Update();
 
+    /**
+     * Generate a bounded number of missing chunk columns, nearest the camera first
+     * @return Number of columns generated
+     */
+    std::size_t UpdateWorldGeneration();
+
+    /**
+     * Rebuild the generation queue from what is still missing around a column
+     */
+    void QueueColumnsAround(const ChunkCoord& center);
+
+    /**
+     * Unload every column beyond the LOD band around a column from the world, the LodStore
+     * and the systems that keep per-column state
+     */
+    void EvictColumnsOutside(const ChunkCoord& center);
+
+    /**
+     * Hook up the tick handlers of the built-in blocks
+     */
+    void RegisterBlockBehaviors(const TerrainSettings& terrain);
+
     /**
      * Render the current frame
      */
@@ -111,6 +266,11 @@ private:
      */
     static void OnWindowResize(GLFWwindow* window, int width, int height);
 
+    /**
+     * Handle key presses; F3 toggles the perf overlay, F12 captures a profiler trace
+     */
+    static void OnKey(GLFWwindow* window, int key, int scancode, int action, int mods);
+
     /**
      * Handle GLFW error callbacks
      */
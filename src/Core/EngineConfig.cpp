@@ -3,9 +3,25 @@
 //
 
 #include "EngineConfig.hpp"
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <sstream>
+#include <utility>
+#include <vector>
+
+namespace
+{
+// read with a default where they are used instead of being stored with the defaults
+const char* const OPTIONAL_KEYS[] = {
+    "engine.headless", "engine.frames", "engine.checkSteadyHeap",
+    "profiler.captureFrames", "profiler.captureAtFrame", "profiler.tracePath",
+    "stats.frameCsv", "debug.perfOverlay",
+    "world.seed", "world.blocks", "world.snapshot", "snapshot.bake",
+    "benchmark.path", "benchmark.timestep", "benchmark.report",
+};
+} // namespace
 
 EngineConfig::EngineConfig()
 {
@@ -149,11 +165,6 @@ bool EngineConfig::LoadFromFile(const std::string& filename)
         return s.size() >= prefix.size() && s.compare(0, prefix.size(), prefix) == 0;
     };
 
-    auto endsWith = [](const std::string& s, const std::string& suffix) {
-        return s.size() >= suffix.size() &&
-               s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
-    };
-
     std::string line;
     int lineNumber = 0;
 
@@ -176,48 +187,105 @@ bool EngineConfig::LoadFromFile(const std::string& filename)
         trim(key);
         trim(valueStr);
 
-        // remove optional quotes
-        if ((startsWith(valueStr, "\"") && endsWith(valueStr, "\"")) ||
-            (startsWith(valueStr, "'") && endsWith(valueStr, "'")))
-        {
-            valueStr = valueStr.substr(1, valueStr.size() - 2);
-        }
+        m_configValues[key] = ParseValue(valueStr);
+    }
 
-        ConfigValue value;
+    SyncMemberVariables();
 
-        // try bool
-        if (valueStr == "true" || valueStr == "false")
-        {
-            value = (valueStr == "true");
-        }
-        // try int
-        else if (!valueStr.empty() &&
-                 std::all_of(valueStr.begin(), valueStr.end(), [](unsigned char c) {
-                     return std::isdigit(c) || c == '-' || c == '+'; }))
+    std::cout << "Configuration loaded successfully from: " << filename << std::endl;
+    return true;
+}
+
+bool EngineConfig::ApplyArguments(int argc, char* argv[])
+{
+    // check every argument first so a typo cannot leave the run half overridden
+    std::vector<std::pair<std::string, ConfigValue>> overrides;
+    bool valid = true;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        if (argument == "--headless")
         {
-            try { value = std::stoi(valueStr); }
-            catch (...) { value = valueStr; }
+            overrides.emplace_back("engine.headless", std::string("simulation"));
+            continue;
         }
-        // try float
-        else if (valueStr.find('.') != std::string::npos)
+
+        const std::size_t equalPos = argument.find('=');
+        if (argument.compare(0, 2, "--") != 0 || equalPos == std::string::npos || equalPos == 2)
         {
-            try { value = std::stof(valueStr); }
-            catch (...) { value = valueStr; }
+            std::cerr << "Invalid argument " << argument << " (expected --key=value or --headless)" << std::endl;
+            valid = false;
+            continue;
         }
-        else
+
+        std::string key = argument.substr(2, equalPos - 2);
+        if (!IsKnownKey(key))
         {
-            value = valueStr; // fallback to string
+            std::cerr << "Invalid argument " << argument << " (unknown key " << key << ")" << std::endl;
+            valid = false;
+            continue;
         }
-
-        m_configValues[key] = value;
+        overrides.emplace_back(std::move(key), ParseValue(argument.substr(equalPos + 1)));
     }
 
-    SyncMemberVariables();
+    if (!valid)
+        return false;
 
-    std::cout << "Configuration loaded successfully from: " << filename << std::endl;
+    for (auto& [key, value] : overrides)
+    {
+        m_configValues[key] = std::move(value);
+    }
+    SyncMemberVariables();
     return true;
 }
 
+bool EngineConfig::IsKnownKey(const std::string& key) const
+{
+    return m_configValues.count(key) != 0 ||
+           std::find(std::begin(OPTIONAL_KEYS), std::end(OPTIONAL_KEYS), key) != std::end(OPTIONAL_KEYS);
+}
+
+EngineConfig::ConfigValue EngineConfig::ParseValue(std::string valueStr)
+{
+    auto startsWith = [](const std::string& s, const std::string& prefix) {
+        return s.size() >= prefix.size() && s.compare(0, prefix.size(), prefix) == 0;
+    };
+
+    auto endsWith = [](const std::string& s, const std::string& suffix) {
+        return s.size() >= suffix.size() &&
+               s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+    };
+
+    // remove optional quotes
+    if (valueStr.size() >= 2 &&
+        ((startsWith(valueStr, "\"") && endsWith(valueStr, "\"")) ||
+         (startsWith(valueStr, "'") && endsWith(valueStr, "'"))))
+    {
+        valueStr = valueStr.substr(1, valueStr.size() - 2);
+    }
+
+    // try bool
+    if (valueStr == "true" || valueStr == "false")
+    {
+        return valueStr == "true";
+    }
+    // try int
+    if (!valueStr.empty() &&
+        std::all_of(valueStr.begin(), valueStr.end(), [](unsigned char c) {
+            return std::isdigit(c) || c == '-' || c == '+'; }))
+    {
+        try { return std::stoi(valueStr); }
+        catch (...) { return valueStr; }
+    }
+    // try float
+    if (valueStr.find('.') != std::string::npos)
+    {
+        try { return std::stof(valueStr); }
+        catch (...) { return valueStr; }
+    }
+    return valueStr; // fallback to string
+}
+
 bool EngineConfig::SaveToFile(const std::string& filename) const
 {
     std::ofstream file(filename);
@@ -64,6 +64,14 @@ public:
     }
 
     bool LoadFromFile(const std::string& filename);
+
+    /**
+     * Override values from the command line: --key=value sets a known key (parsed like the
+     * file), --headless is short for --engine.headless=simulation
+     * @return false, applying none of them, if an argument was not understood or names a key
+     *         the engine does not read
+     */
+    bool ApplyArguments(int argc, char* argv[]);
     bool SaveToFile(const std::string& filename) const;
 
     void ResetToDefaults();
@@ -95,4 +103,15 @@ private:
      * Sync member variables with config map values
      */
     void SyncMemberVariables();
+
+    /**
+     * Turn the text of a value into a bool, int, float or string
+     */
+    static ConfigValue ParseValue(std::string valueStr);
+
+    /**
+     * True for keys with a default, keys the config file set, and optional keys the engine
+     * reads with a default at their point of use
+     */
+    [[nodiscard]] bool IsKnownKey(const std::string& key) const;
 };
\ No newline at end of file
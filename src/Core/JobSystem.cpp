@@ -0,0 +1,233 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "JobSystem.hpp"
+#include "Profiling/Profiler.hpp"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+JobSystem::JobSystem(unsigned workerCount)
+    : m_queueHead(0)
+    , m_queueSize(0)
+    , m_peakQueueDepth(0)
+    , m_stopping(false)
+{
+    if (workerCount == 0)
+    {
+        const unsigned hardwareThreads = std::thread::hardware_concurrency();
+        workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+    }
+
+    m_workers.reserve(workerCount);
+    for (unsigned i = 0; i < workerCount; ++i)
+    {
+        m_workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard lock(m_queueMutex);
+        m_stopping = true;
+    }
+    m_queueCondition.notify_all();
+
+    for (std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+
+    // drain anything submitted without a waiter so counters are never left pending
+    while (TryRunOne())
+    {
+    }
+}
+
+void JobSystem::Submit(Job job, JobCounter* counter)
+{
+    if (counter)
+        counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+
+    Push({std::move(job), nullptr, counter, AllocationTracker::GetCurrentTag()});
+}
+
+void JobSystem::Push(QueuedJob queued)
+{
+    {
+        std::lock_guard lock(m_queueMutex);
+        if (m_queueSize == m_queue.size())
+        {
+            std::vector<QueuedJob> grown(std::max<std::size_t>(m_queue.size() * 2, 64));
+            for (std::size_t i = 0; i < m_queueSize; ++i)
+            {
+                grown[i] = std::move(m_queue[(m_queueHead + i) % m_queue.size()]);
+            }
+            m_queue = std::move(grown);
+            m_queueHead = 0;
+        }
+
+        m_queue[(m_queueHead + m_queueSize) % m_queue.size()] = std::move(queued);
+        ++m_queueSize;
+        m_peakQueueDepth = std::max(m_peakQueueDepth, m_queueSize);
+    }
+    m_queueCondition.notify_one();
+}
+
+void JobSystem::Wait(const JobCounter& counter)
+{
+    PROFILE_SCOPE("Wait");
+    while (!counter.IsDone())
+    {
+        if (!TryRunOne())
+            std::this_thread::yield();
+    }
+}
+
+void JobSystem::ParallelFor(std::size_t count, std::size_t grainSize, RangeJob func)
+{
+    if (count == 0)
+        return;
+
+    grainSize = std::max<std::size_t>(grainSize, 1);
+    const std::size_t rangeCount = (count + grainSize - 1) / grainSize;
+
+    if (rangeCount == 1 || m_workers.empty())
+    {
+        func(0, count);
+        return;
+    }
+
+    const std::size_t helpers = std::min<std::size_t>(m_workers.size(), rangeCount - 1);
+    RangeState* state = AcquireRangeState();
+    state->func = &func;
+    state->count = count;
+    state->grainSize = grainSize;
+    state->rangeCount = rangeCount;
+    state->nextRange.store(0, std::memory_order_relaxed);
+    state->finishedRanges.store(0, std::memory_order_relaxed);
+    state->references.store(static_cast<int>(helpers) + 1, std::memory_order_relaxed);
+
+    const MemoryTag tag = AllocationTracker::GetCurrentTag();
+    for (std::size_t i = 0; i < helpers; ++i)
+    {
+        Push({Job{}, state, nullptr, tag});
+    }
+
+    RunRanges(*state);
+
+    {
+        PROFILE_SCOPE("Wait");
+        while (state->finishedRanges.load(std::memory_order_acquire) < rangeCount)
+        {
+            if (!TryRunOne())
+                std::this_thread::yield();
+        }
+    }
+    ReleaseRangeState(state);
+}
+
+void JobSystem::RunRanges(RangeState& state)
+{
+    // func is only called while a range is unclaimed, which implies the caller is still
+    // inside ParallelFor and the callable it references is alive
+    for (std::size_t range = state.nextRange.fetch_add(1); range < state.rangeCount;
+         range = state.nextRange.fetch_add(1))
+    {
+        const std::size_t begin = range * state.grainSize;
+        (*state.func)(begin, std::min(begin + state.grainSize, state.count));
+        state.finishedRanges.fetch_add(1, std::memory_order_release);
+    }
+}
+
+JobSystem::RangeState* JobSystem::AcquireRangeState()
+{
+    std::lock_guard lock(m_rangeStateMutex);
+    if (m_freeRangeStates.empty())
+        return new RangeState();
+
+    RangeState* state = m_freeRangeStates.back().release();
+    m_freeRangeStates.pop_back();
+    return state;
+}
+
+void JobSystem::ReleaseRangeState(RangeState* state)
+{
+    if (state->references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;
+
+    std::lock_guard lock(m_rangeStateMutex);
+    m_freeRangeStates.emplace_back(state);
+}
+
+std::size_t JobSystem::GetQueueDepth() const
+{
+    std::lock_guard lock(m_queueMutex);
+    return m_queueSize;
+}
+
+std::size_t JobSystem::TakePeakQueueDepth()
+{
+    std::lock_guard lock(m_queueMutex);
+    const std::size_t peak = m_peakQueueDepth;
+    m_peakQueueDepth = m_queueSize;
+    return peak;
+}
+
+void JobSystem::WorkerLoop(unsigned index)
+{
+    const std::string threadName = "Worker " + std::to_string(index + 1);
+    Profiler::SetThreadName(threadName.c_str());
+
+    while (true)
+    {
+        QueuedJob queued;
+        {
+            std::unique_lock lock(m_queueMutex);
+            m_queueCondition.wait(lock, [this] { return m_stopping || m_queueSize > 0; });
+
+            if (m_queueSize == 0)
+                return;
+
+            queued = std::move(m_queue[m_queueHead]);
+            m_queueHead = (m_queueHead + 1) % m_queue.size();
+            --m_queueSize;
+        }
+        Execute(queued);
+    }
+}
+
+bool JobSystem::TryRunOne()
+{
+    QueuedJob queued;
+    {
+        std::lock_guard lock(m_queueMutex);
+        if (m_queueSize == 0)
+            return false;
+
+        queued = std::move(m_queue[m_queueHead]);
+        m_queueHead = (m_queueHead + 1) % m_queue.size();
+        --m_queueSize;
+    }
+    Execute(queued);
+    return true;
+}
+
+void JobSystem::Execute(QueuedJob& queued)
+{
+    const MemoryTagScope tagScope(queued.tag);
+    if (queued.range)
+    {
+        RunRanges(*queued.range);
+        ReleaseRangeState(queued.range);
+    }
+    else
+    {
+        queued.job();
+    }
+    if (queued.counter)
+        queued.counter->m_pending.fetch_sub(1, std::memory_order_release);
+}
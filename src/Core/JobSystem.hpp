@@ -0,0 +1,165 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Memory/AllocationTracker.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Tracks completion of a group of submitted jobs
+ */
+class JobCounter
+{
+public:
+    [[nodiscard]] bool IsDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+    std::atomic<int> m_pending{0};
+};
+
+/**
+ * Non-owning reference to a callable taking a range, so ParallelFor takes any lambda without
+ * the heap allocation a std::function may need for its captures. Only valid while the
+ * callable it was made from is alive.
+ */
+class RangeFunction
+{
+public:
+    template<typename Func, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Func>, RangeFunction>>>
+    RangeFunction(Func&& func)
+        : m_callable(const_cast<void*>(static_cast<const void*>(std::addressof(func))))
+        , m_invoke([](void* callable, std::size_t begin, std::size_t end) {
+            (*static_cast<std::remove_reference_t<Func>*>(callable))(begin, end);
+        })
+    {
+    }
+
+    void operator()(std::size_t begin, std::size_t end) const { m_invoke(m_callable, begin, end); }
+
+private:
+    void* m_callable;
+    void (*m_invoke)(void* callable, std::size_t begin, std::size_t end);
+};
+
+/**
+ * Fixed pool of worker threads pulling from a shared FIFO queue. Threads that wait
+ * on work help execute queued jobs, so waiting from inside a job cannot deadlock and
+ * a pool with zero workers still makes progress on the calling thread.
+ */
+class JobSystem
+{
+public:
+    using Job = std::function<void()>;
+    using RangeJob = RangeFunction;
+
+    /**
+     * Start the worker threads
+     * @param workerCount Number of workers; 0 uses one per hardware thread minus the caller
+     */
+    explicit JobSystem(unsigned workerCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * Queue a job for execution on any worker
+     * @param counter Optional counter incremented now and decremented when the job finishes
+     */
+    void Submit(Job job, JobCounter* counter = nullptr);
+
+    /**
+     * Block until every job tracked by the counter has finished, running queued jobs meanwhile
+     */
+    void Wait(const JobCounter& counter);
+
+    /**
+     * Split [0, count) into ranges of grainSize and run them across the workers and the
+     * calling thread. Returns once every range has been processed. Does not allocate once
+     * the queue and the pool of loop states have grown to the working set.
+     */
+    void ParallelFor(std::size_t count, std::size_t grainSize, RangeJob func);
+
+    /**
+     * Number of worker threads (not counting the thread that owns the system)
+     */
+    [[nodiscard]] unsigned GetWorkerCount() const { return static_cast<unsigned>(m_workers.size()); }
+
+    /**
+     * Number of jobs waiting to be picked up
+     */
+    [[nodiscard]] std::size_t GetQueueDepth() const;
+
+    /**
+     * Most jobs waiting at once since the last call; resets the peak
+     */
+    std::size_t TakePeakQueueDepth();
+
+private:
+    /**
+     * Progress of one ParallelFor, shared by the caller and its helper jobs. Helpers may start
+     * after the caller has already finished every range, so the state is reference counted
+     * and goes back to the pool when the last of them lets go.
+     */
+    struct RangeState
+    {
+        const RangeJob* func = nullptr; // the caller's, alive while any range is unclaimed
+        std::size_t count = 0;
+        std::size_t grainSize = 0;
+        std::size_t rangeCount = 0;
+        std::atomic<std::size_t> nextRange{0};
+        std::atomic<std::size_t> finishedRanges{0};
+        std::atomic<int> references{0};
+    };
+
+    struct QueuedJob
+    {
+        Job job;
+        RangeState* range; // set instead of job for ParallelFor helpers
+        JobCounter* counter;
+        MemoryTag tag; // allocations made by the job are charged to the submitter's tag
+    };
+
+    std::vector<std::thread> m_workers;
+    // ring buffer of queued jobs, doubled when full and never shrunk
+    std::vector<QueuedJob> m_queue;
+    std::size_t m_queueHead;
+    std::size_t m_queueSize;
+    mutable std::mutex m_queueMutex;
+    std::size_t m_peakQueueDepth;
+    std::condition_variable m_queueCondition;
+    bool m_stopping;
+
+    std::vector<std::unique_ptr<RangeState>> m_freeRangeStates;
+    std::mutex m_rangeStateMutex;
+
+    void WorkerLoop(unsigned index);
+
+    /**
+     * Add a job to the back of the queue and wake a worker
+     */
+    void Push(QueuedJob queued);
+
+    /**
+     * Pop and run one queued job if there is one
+     * @return true if a job was executed
+     */
+    bool TryRunOne();
+
+    void Execute(QueuedJob& queued);
+
+    RangeState* AcquireRangeState();
+    void ReleaseRangeState(RangeState* state);
+
+    static void RunRanges(RangeState& state);
+};
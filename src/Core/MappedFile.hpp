@@ -0,0 +1,54 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Read-only memory mapping of a whole file. Pages are faulted in by the OS on
+ * first access, so opening a large file costs nothing until it is touched.
+ */
+class MappedFile
+{
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * Map the given file read-only
+     * @param path File to map
+     * @return true if the file was mapped
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * Unmap the file
+     */
+    void Close();
+
+    /**
+     * Hint the OS that a byte range will be read soon so it can start paging it in
+     */
+    void Prefetch(std::size_t offset, std::size_t size) const;
+
+    [[nodiscard]] bool IsOpen() const { return m_data != nullptr; }
+    [[nodiscard]] const std::uint8_t* GetData() const { return m_data; }
+    [[nodiscard]] std::size_t GetSize() const { return m_size; }
+
+private:
+    const std::uint8_t* m_data;
+    std::size_t m_size;
+
+#ifdef _WIN32
+    void* m_fileHandle;
+    void* m_mappingHandle;
+#endif
+};
@@ -22,7 +22,7 @@ inline float ToRadians(float degree)
 
 inline float ToDegrees(float radian)
 {
-    return radian * DEG_TO_RAD;
+    return radian * RAD_TO_DEG;
 }
 
 inline float Clamp(float value, float min, float max)
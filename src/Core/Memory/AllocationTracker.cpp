@@ -0,0 +1,143 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "AllocationTracker.hpp"
+
+#include <array>
+#include <atomic>
+
+namespace
+{
+/**
+ * Live counters of one tag; the frame counters restart at every EndFrame
+ */
+struct TagCounters
+{
+    std::atomic<std::size_t> currentBytes{0};
+    std::atomic<std::size_t> peakBytes{0};
+    std::atomic<std::size_t> allocatedBytes{0};
+    std::atomic<std::size_t> allocations{0};
+    std::atomic<std::size_t> frees{0};
+};
+
+struct Counters
+{
+    std::array<TagCounters, MEMORY_TAG_COUNT> tags;
+    std::array<MemoryTagStats, MEMORY_TAG_COUNT> lastFrame;
+};
+
+// plain globals with constant initialisation: operator new may run before any dynamic
+// initialiser, so these must never need one
+Counters g_heap;
+Counters g_gpu;
+thread_local MemoryTag t_currentTag = MemoryTag::Untagged;
+
+constexpr const char* TAG_NAMES[MEMORY_TAG_COUNT] = {"Untagged", "World", "Meshes", "Textures", "Shaders", "UI"};
+
+void Add(Counters& counters, MemoryTag tag, std::size_t bytes)
+{
+    TagCounters& tagCounters = counters.tags[static_cast<std::size_t>(tag)];
+    const std::size_t current = tagCounters.currentBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    tagCounters.allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    tagCounters.allocations.fetch_add(1, std::memory_order_relaxed);
+
+    std::size_t peak = tagCounters.peakBytes.load(std::memory_order_relaxed);
+    while (current > peak &&
+           !tagCounters.peakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed))
+    {
+    }
+}
+
+void Remove(Counters& counters, MemoryTag tag, std::size_t bytes)
+{
+    TagCounters& tagCounters = counters.tags[static_cast<std::size_t>(tag)];
+    tagCounters.currentBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    tagCounters.frees.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Publish(Counters& counters)
+{
+    for (std::size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+    {
+        TagCounters& tagCounters = counters.tags[i];
+        MemoryTagStats& stats = counters.lastFrame[i];
+        stats.currentBytes = tagCounters.currentBytes.load(std::memory_order_relaxed);
+        stats.peakBytes = tagCounters.peakBytes.exchange(stats.currentBytes, std::memory_order_relaxed);
+        stats.allocatedBytes = tagCounters.allocatedBytes.exchange(0, std::memory_order_relaxed);
+        stats.allocations = tagCounters.allocations.exchange(0, std::memory_order_relaxed);
+        stats.frees = tagCounters.frees.exchange(0, std::memory_order_relaxed);
+    }
+}
+} // namespace
+
+const char* GetMemoryTagName(MemoryTag tag)
+{
+    const auto index = static_cast<std::size_t>(tag);
+    return index < MEMORY_TAG_COUNT ? TAG_NAMES[index] : "Unknown";
+}
+
+bool AllocationTracker::IsHeapTrackingEnabled()
+{
+#ifdef SILK_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+MemoryTag AllocationTracker::GetCurrentTag()
+{
+    return t_currentTag;
+}
+
+void AllocationTracker::SetCurrentTag(MemoryTag tag)
+{
+    t_currentTag = tag;
+}
+
+void AllocationTracker::RecordAllocation(MemoryTag tag, std::size_t bytes)
+{
+    Add(g_heap, tag, bytes);
+}
+
+void AllocationTracker::RecordFree(MemoryTag tag, std::size_t bytes)
+{
+    Remove(g_heap, tag, bytes);
+}
+
+void AllocationTracker::RecordGpuAllocation(MemoryTag tag, std::size_t bytes)
+{
+    Add(g_gpu, tag, bytes);
+}
+
+void AllocationTracker::RecordGpuFree(MemoryTag tag, std::size_t bytes)
+{
+    Remove(g_gpu, tag, bytes);
+}
+
+void AllocationTracker::EndFrame()
+{
+    Publish(g_heap);
+    Publish(g_gpu);
+}
+
+MemoryTagStats AllocationTracker::GetHeapStats(MemoryTag tag)
+{
+    return g_heap.lastFrame[static_cast<std::size_t>(tag)];
+}
+
+MemoryTagStats AllocationTracker::GetGpuStats(MemoryTag tag)
+{
+    return g_gpu.lastFrame[static_cast<std::size_t>(tag)];
+}
+
+std::size_t AllocationTracker::GetFrameHeapAllocations()
+{
+    std::size_t allocations = 0;
+    for (const MemoryTagStats& stats : g_heap.lastFrame)
+    {
+        allocations += stats.allocations;
+    }
+    return allocations;
+}
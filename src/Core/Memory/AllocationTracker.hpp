@@ -0,0 +1,100 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Subsystem an allocation is charged to
+ */
+enum class MemoryTag : std::uint8_t
+{
+    Untagged,
+    World,
+    Meshes,
+    Textures,
+    Shaders,
+    UI,
+    Count
+};
+
+constexpr std::size_t MEMORY_TAG_COUNT = static_cast<std::size_t>(MemoryTag::Count);
+
+[[nodiscard]] const char* GetMemoryTagName(MemoryTag tag);
+
+/**
+ * Counters of one tag over one frame
+ */
+struct MemoryTagStats
+{
+    std::size_t currentBytes = 0; // live at the end of the frame
+    std::size_t peakBytes = 0; // most live at any point in the frame
+    std::size_t allocatedBytes = 0; // allocated during the frame
+    std::size_t allocations = 0;
+    std::size_t frees = 0;
+};
+
+/**
+ * Per-subsystem memory accounting.
+ *
+ * Heap allocations are counted by the global operator new/delete replacements (built when
+ * SILK_TRACK_ALLOCATIONS is on) and charged to the calling thread's current tag, set with a
+ * MemoryTagScope. Jobs inherit the tag of the thread that submitted them. GPU memory is
+ * reported by the renderer's buffer wrappers (see GpuMemory.hpp) and counted separately.
+ *
+ * Counters are relaxed atomics; EndFrame publishes the frame's numbers and starts the next.
+ */
+class AllocationTracker
+{
+public:
+    /**
+     * True if the heap hooks are compiled in; otherwise only GPU memory is counted
+     */
+    [[nodiscard]] static bool IsHeapTrackingEnabled();
+
+    [[nodiscard]] static MemoryTag GetCurrentTag();
+    static void SetCurrentTag(MemoryTag tag);
+
+    static void RecordAllocation(MemoryTag tag, std::size_t bytes);
+    static void RecordFree(MemoryTag tag, std::size_t bytes);
+    static void RecordGpuAllocation(MemoryTag tag, std::size_t bytes);
+    static void RecordGpuFree(MemoryTag tag, std::size_t bytes);
+
+    /**
+     * Publish the counters of the frame that just ended and reset them for the next
+     */
+    static void EndFrame();
+
+    /**
+     * Heap and GPU counters of the last completed frame
+     */
+    [[nodiscard]] static MemoryTagStats GetHeapStats(MemoryTag tag);
+    [[nodiscard]] static MemoryTagStats GetGpuStats(MemoryTag tag);
+
+    /**
+     * Heap allocations of every tag in the last completed frame
+     */
+    [[nodiscard]] static std::size_t GetFrameHeapAllocations();
+};
+
+/**
+ * Charges allocations made by this thread to a tag until the scope ends
+ */
+class MemoryTagScope
+{
+public:
+    explicit MemoryTagScope(MemoryTag tag)
+        : m_previous(AllocationTracker::GetCurrentTag())
+    {
+        AllocationTracker::SetCurrentTag(tag);
+    }
+
+    ~MemoryTagScope() { AllocationTracker::SetCurrentTag(m_previous); }
+
+    MemoryTagScope(const MemoryTagScope&) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+private:
+    MemoryTag m_previous;
+};
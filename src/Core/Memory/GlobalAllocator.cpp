@@ -0,0 +1,197 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+// Replacements for the global operator new/delete that charge every heap allocation to
+// the current MemoryTag. Each block carries a small header with its size and tag, so frees
+// are charged back to the tag that allocated them whichever thread releases them.
+//
+
+#ifdef SILK_TRACK_ALLOCATIONS
+
+#include "AllocationTracker.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+struct alignas(16) AllocationHeader
+{
+    std::size_t size;
+    std::uint32_t offset; // from the start of the malloc block to the user pointer
+    MemoryTag tag;
+};
+
+static_assert(sizeof(AllocationHeader) == 16, "header must keep 16-byte alignment");
+
+/**
+ * Bytes a block needs on top of the user size: the header, and room to align the user pointer.
+ * Malloc already gives 16-byte alignment, so the default case wastes nothing beyond the header.
+ */
+std::size_t GetOverhead(std::size_t alignment)
+{
+    return sizeof(AllocationHeader) + (alignment > alignof(AllocationHeader) ? alignment : 0);
+}
+
+/**
+ * True if the request plus its overhead does not fit in a size_t, so no block can hold it
+ */
+bool IsTooLarge(std::size_t size, std::size_t alignment)
+{
+    return size > SIZE_MAX - GetOverhead(alignment);
+}
+
+void* Allocate(std::size_t size, std::size_t alignment)
+{
+    alignment = alignment < alignof(AllocationHeader) ? alignof(AllocationHeader) : alignment;
+    if (IsTooLarge(size, alignment))
+        return nullptr;
+
+    // over-allocate so an aligned user pointer with the header in front always fits
+    void* block = std::malloc(GetOverhead(alignment) + size);
+    if (!block)
+        return nullptr;
+
+    const auto start = reinterpret_cast<std::uintptr_t>(block) + sizeof(AllocationHeader);
+    const std::uintptr_t aligned = (start + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+    auto* pointer = reinterpret_cast<std::byte*>(aligned);
+    auto* header = reinterpret_cast<AllocationHeader*>(pointer) - 1;
+    header->size = size;
+    header->offset = static_cast<std::uint32_t>(aligned - reinterpret_cast<std::uintptr_t>(block));
+    header->tag = AllocationTracker::GetCurrentTag();
+
+    AllocationTracker::RecordAllocation(header->tag, size);
+    return pointer;
+}
+
+void* AllocateOrThrow(std::size_t size, std::size_t alignment)
+{
+    // freeing memory in the new handler cannot help a request this large
+    if (IsTooLarge(size, alignment))
+        throw std::bad_alloc();
+
+    while (true)
+    {
+        if (void* pointer = Allocate(size, alignment))
+            return pointer;
+
+        std::new_handler handler = std::get_new_handler();
+        if (!handler)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void Free(void* pointer)
+{
+    if (!pointer)
+        return;
+
+    const auto* header = static_cast<const AllocationHeader*>(pointer) - 1;
+    AllocationTracker::RecordFree(header->tag, header->size);
+    std::free(static_cast<std::byte*>(pointer) - header->offset);
+}
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    return AllocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size)
+{
+    return AllocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return AllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return AllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept
+{
+    Free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    Free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    Free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    Free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    Free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept
+{
+    Free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    Free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    Free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    Free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    Free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    Free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    Free(pointer);
+}
+
+#endif
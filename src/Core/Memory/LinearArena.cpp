@@ -0,0 +1,137 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "LinearArena.hpp"
+
+#include "MemoryStats.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+namespace
+{
+constexpr std::size_t BLOCK_ALIGNMENT = 64;
+
+std::size_t AlignUp(std::size_t value, std::size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+} // namespace
+
+LinearArena::LinearArena(std::size_t blockSize)
+    : m_blockSize(AlignUp(blockSize, BLOCK_ALIGNMENT))
+    , m_block(0)
+    , m_offset(0)
+    , m_peakUsed(0)
+    , m_heapAllocations(0)
+{
+}
+
+LinearArena::~LinearArena()
+{
+    for (const Block& block : m_blocks)
+    {
+        FreeBlock(block);
+    }
+}
+
+void LinearArena::Rewind(const Marker& marker)
+{
+    m_peakUsed = std::max(m_peakUsed, GetUsed());
+    m_block = marker.block;
+    m_offset = marker.offset;
+}
+
+void LinearArena::Reset()
+{
+    m_peakUsed = std::max(m_peakUsed, GetUsed());
+    m_block = 0;
+    m_offset = 0;
+    if (m_blocks.size() <= 1)
+        return;
+
+    // one block holding all of them, so the same workload fits without growing next time
+    const std::size_t size = GetCapacity();
+    for (const Block& block : m_blocks)
+    {
+        FreeBlock(block);
+    }
+    m_blocks.clear();
+    AddBlock(size);
+    m_block = 0;
+}
+
+std::size_t LinearArena::GetUsed() const
+{
+    if (m_blocks.empty())
+        return 0;
+
+    std::size_t used = m_offset;
+    for (std::size_t i = 0; i < m_block; ++i)
+    {
+        used += m_blocks[i].size;
+    }
+    return used;
+}
+
+std::size_t LinearArena::GetCapacity() const
+{
+    std::size_t capacity = 0;
+    for (const Block& block : m_blocks)
+    {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+void* LinearArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    while (true)
+    {
+        if (m_block < m_blocks.size())
+        {
+            const Block& block = m_blocks[m_block];
+            const auto base = reinterpret_cast<std::uintptr_t>(block.data);
+            const std::size_t start = AlignUp(base + m_offset, alignment) - base;
+            if (start + bytes <= block.size)
+            {
+                m_offset = start + bytes;
+                return block.data + start;
+            }
+        }
+
+        // move on to the next block, making one if there is none or it is too small
+        const bool hasBlock = m_block < m_blocks.size();
+        if (!hasBlock || m_block + 1 >= m_blocks.size() || m_blocks[m_block + 1].size < bytes + alignment)
+            AddBlock(std::max(m_blockSize, AlignUp(bytes + alignment, BLOCK_ALIGNMENT)));
+        if (hasBlock)
+            ++m_block;
+        m_offset = 0;
+    }
+}
+
+void LinearArena::do_deallocate(void*, std::size_t, std::size_t)
+{
+    // released in bulk by Rewind and Reset
+}
+
+bool LinearArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+void LinearArena::AddBlock(std::size_t size)
+{
+    Block block{static_cast<std::byte*>(::operator new(size, std::align_val_t{BLOCK_ALIGNMENT})), size};
+    const std::size_t position = m_blocks.empty() ? 0 : m_block + 1;
+    m_blocks.insert(m_blocks.begin() + static_cast<std::ptrdiff_t>(position), block);
+    ++m_heapAllocations;
+    MemoryStats::RecordHeapAllocation();
+}
+
+void LinearArena::FreeBlock(const Block& block)
+{
+    ::operator delete(block.data, std::align_val_t{BLOCK_ALIGNMENT});
+}
@@ -0,0 +1,87 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+/**
+ * Bump allocator for short-lived data, usable as a std::pmr memory resource.
+ *
+ * Allocation moves a pointer forward and deallocation does nothing; memory comes back all
+ * at once through Rewind or Reset. When a block runs out a new one is taken from the heap,
+ * and Reset merges the blocks into one big enough for everything used since the last reset,
+ * so a workload that repeats (a frame, a job) stops touching the heap after its first run.
+ *
+ * Not thread-safe: use one arena per thread.
+ */
+class LinearArena : public std::pmr::memory_resource
+{
+public:
+    /**
+     * Position to rewind to; everything allocated after it is released
+     */
+    struct Marker
+    {
+        std::size_t block = 0;
+        std::size_t offset = 0;
+    };
+
+    explicit LinearArena(std::size_t blockSize = 64 * 1024);
+    ~LinearArena() override;
+
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    [[nodiscard]] Marker GetMarker() const { return {m_block, m_offset}; }
+
+    /**
+     * Release everything allocated since a marker, keeping the blocks
+     */
+    void Rewind(const Marker& marker);
+
+    /**
+     * Release everything, and merge the blocks if more than one was needed
+     */
+    void Reset();
+
+    /**
+     * Bytes handed out since the last reset, and the most ever handed out
+     */
+    [[nodiscard]] std::size_t GetUsed() const;
+    [[nodiscard]] std::size_t GetPeakUsed() const { return m_peakUsed; }
+
+    [[nodiscard]] std::size_t GetCapacity() const;
+
+    /**
+     * Number of blocks ever taken from the heap; stays flat once the arena has warmed up
+     */
+    [[nodiscard]] std::size_t GetHeapAllocationCount() const { return m_heapAllocations; }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    struct Block
+    {
+        std::byte* data;
+        std::size_t size;
+    };
+
+    std::size_t m_blockSize;
+    std::vector<Block> m_blocks;
+    std::size_t m_block;
+    std::size_t m_offset;
+    std::size_t m_peakUsed;
+    std::size_t m_heapAllocations;
+
+    /**
+     * Insert a heap block of at least size bytes after the current one
+     */
+    void AddBlock(std::size_t size);
+
+    static void FreeBlock(const Block& block);
+};
@@ -0,0 +1,22 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "MemoryStats.hpp"
+
+#include <atomic>
+
+namespace
+{
+std::atomic<std::size_t> g_heapAllocations{0};
+} // namespace
+
+void MemoryStats::RecordHeapAllocation()
+{
+    g_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::size_t MemoryStats::GetHeapAllocationCount()
+{
+    return g_heapAllocations.load(std::memory_order_relaxed);
+}
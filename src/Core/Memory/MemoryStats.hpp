@@ -0,0 +1,23 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include <cstddef>
+
+/**
+ * Process-wide counters of the engine's own allocators
+ */
+class MemoryStats
+{
+public:
+    /**
+     * Count one trip to the heap by an arena or a pool
+     */
+    static void RecordHeapAllocation();
+
+    /**
+     * Heap allocations made by arenas and pools since startup. Once every arena has grown to
+     * its working size this stops moving, which is how a zero-malloc frame is checked.
+     */
+    [[nodiscard]] static std::size_t GetHeapAllocationCount();
+};
@@ -0,0 +1,101 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "PoolResource.hpp"
+
+#include "MemoryStats.hpp"
+
+#include <algorithm>
+#include <new>
+
+PoolResource::PoolResource(std::size_t blockSize, std::size_t blockAlignment, std::size_t blocksPerPage)
+    : m_blockAlignment(std::max(blockAlignment, alignof(FreeBlock)))
+    , m_blocksPerPage(std::max<std::size_t>(blocksPerPage, 1))
+    , m_freeList(nullptr)
+    , m_usedBlocks(0)
+{
+    // every block must hold a free list link and keep the next block aligned
+    m_blockSize = std::max(blockSize, sizeof(FreeBlock));
+    m_blockSize = (m_blockSize + m_blockAlignment - 1) / m_blockAlignment * m_blockAlignment;
+}
+
+PoolResource::~PoolResource()
+{
+    for (std::byte* page : m_pages)
+    {
+        ::operator delete(page, std::align_val_t{m_blockAlignment});
+    }
+}
+
+std::size_t PoolResource::GetUsedBlockCount() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_usedBlocks;
+}
+
+std::size_t PoolResource::GetPageCount() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_pages.size();
+}
+
+std::size_t PoolResource::GetCapacity() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_pages.size() * m_blocksPerPage * m_blockSize;
+}
+
+void* PoolResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    if (!Fits(bytes, alignment))
+    {
+        MemoryStats::RecordHeapAllocation();
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    std::lock_guard lock(m_mutex);
+    if (!m_freeList)
+        AddPage();
+
+    FreeBlock* block = m_freeList;
+    m_freeList = block->next;
+    ++m_usedBlocks;
+    return block;
+}
+
+void PoolResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment)
+{
+    if (!Fits(bytes, alignment))
+    {
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        return;
+    }
+
+    std::lock_guard lock(m_mutex);
+    auto* block = static_cast<FreeBlock*>(pointer);
+    block->next = m_freeList;
+    m_freeList = block;
+    --m_usedBlocks;
+}
+
+bool PoolResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+void PoolResource::AddPage()
+{
+    auto* page = static_cast<std::byte*>(
+        ::operator new(m_blockSize * m_blocksPerPage, std::align_val_t{m_blockAlignment}));
+    m_pages.push_back(page);
+    MemoryStats::RecordHeapAllocation();
+
+    // link back to front so blocks are handed out in address order
+    for (std::size_t i = m_blocksPerPage; i-- > 0;)
+    {
+        auto* block = reinterpret_cast<FreeBlock*>(page + i * m_blockSize);
+        block->next = m_freeList;
+        m_freeList = block;
+    }
+}
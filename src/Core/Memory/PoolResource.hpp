@@ -0,0 +1,71 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+/**
+ * Fixed-size block allocator, usable as a std::pmr memory resource.
+ *
+ * Blocks are carved from pages of blocksPerPage and recycled through a free list, so
+ * objects that come and go in large numbers (chunks, per-mesh records) reuse the same memory
+ * instead of going back to the heap. Requests bigger or more aligned than a block are passed
+ * to the default heap. Pages are only freed with the pool.
+ *
+ * Thread-safe: chunks are created on generation jobs.
+ */
+class PoolResource : public std::pmr::memory_resource
+{
+public:
+    PoolResource(std::size_t blockSize, std::size_t blockAlignment, std::size_t blocksPerPage);
+    ~PoolResource() override;
+
+    PoolResource(const PoolResource&) = delete;
+    PoolResource& operator=(const PoolResource&) = delete;
+
+    [[nodiscard]] std::size_t GetBlockSize() const { return m_blockSize; }
+
+    /**
+     * Blocks currently handed out
+     */
+    [[nodiscard]] std::size_t GetUsedBlockCount() const;
+    [[nodiscard]] std::size_t GetPageCount() const;
+
+    /**
+     * Bytes reserved from the heap for pages
+     */
+    [[nodiscard]] std::size_t GetCapacity() const;
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    std::size_t m_blockSize;
+    std::size_t m_blockAlignment;
+    std::size_t m_blocksPerPage;
+
+    mutable std::mutex m_mutex;
+    std::vector<std::byte*> m_pages;
+    FreeBlock* m_freeList;
+    std::size_t m_usedBlocks;
+
+    [[nodiscard]] bool Fits(std::size_t bytes, std::size_t alignment) const
+    {
+        return bytes <= m_blockSize && alignment <= m_blockAlignment;
+    }
+
+    /**
+     * Take a page from the heap and put its blocks on the free list
+     */
+    void AddPage();
+};
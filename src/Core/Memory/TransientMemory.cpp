@@ -0,0 +1,23 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "TransientMemory.hpp"
+
+namespace
+{
+constexpr std::size_t FRAME_ARENA_BLOCK_SIZE = 256 * 1024;
+constexpr std::size_t SCRATCH_ARENA_BLOCK_SIZE = 64 * 1024;
+} // namespace
+
+LinearArena& GetFrameArena()
+{
+    static LinearArena arena(FRAME_ARENA_BLOCK_SIZE);
+    return arena;
+}
+
+LinearArena& GetThreadScratch()
+{
+    thread_local LinearArena arena(SCRATCH_ARENA_BLOCK_SIZE);
+    return arena;
+}
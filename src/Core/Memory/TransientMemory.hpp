@@ -0,0 +1,50 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "LinearArena.hpp"
+
+/**
+ * Arena for data that lives until the end of the current frame. Main thread only; the
+ * engine resets it at the start of every frame.
+ */
+LinearArena& GetFrameArena();
+
+/**
+ * Scratch arena of the calling thread, for temporary data inside a job. Allocate from it
+ * under a ScratchScope so the memory is returned when the work is done.
+ */
+LinearArena& GetThreadScratch();
+
+/**
+ * Returns everything allocated from the thread's scratch arena during its lifetime.
+ * Scopes nest, so a job that waits and runs other jobs meanwhile stays correct, but a
+ * container from an outer scope must not grow while an inner scope is open.
+ */
+class ScratchScope
+{
+public:
+    ScratchScope()
+        : m_arena(GetThreadScratch())
+        , m_marker(m_arena.GetMarker())
+    {
+    }
+
+    ~ScratchScope()
+    {
+        // the outermost scope merges the blocks, so the thread settles on a single one
+        if (m_marker.block == 0 && m_marker.offset == 0)
+            m_arena.Reset();
+        else
+            m_arena.Rewind(m_marker);
+    }
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+
+    [[nodiscard]] LinearArena& GetArena() const { return m_arena; }
+
+private:
+    LinearArena& m_arena;
+    LinearArena::Marker m_marker;
+};
@@ -0,0 +1,222 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "FrameStats.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+namespace
+{
+constexpr std::uint64_t HALF_SUB_BUCKET_COUNT = DurationHistogram::SUB_BUCKET_COUNT / 2;
+
+int FloorLog2(std::uint64_t value)
+{
+    int log = 0;
+    while (value >>= 1)
+    {
+        ++log;
+    }
+    return log;
+}
+
+float ToMilliseconds(std::uint64_t microseconds)
+{
+    return static_cast<float>(microseconds) / 1000.0f;
+}
+
+std::string HistogramPath(const std::string& path)
+{
+    const std::string extension = ".csv";
+    if (path.size() > extension.size() && path.compare(path.size() - extension.size(), extension.size(), extension) == 0)
+        return path.substr(0, path.size() - extension.size()) + "_histogram.csv";
+    return path + "_histogram.csv";
+}
+} // namespace
+
+void DurationHistogram::Record(std::uint64_t microseconds)
+{
+    ++m_buckets[GetBucketIndex(microseconds)];
+    ++m_count;
+}
+
+void DurationHistogram::Reset()
+{
+    m_buckets.fill(0);
+    m_count = 0;
+}
+
+std::uint64_t DurationHistogram::GetValueAtPercentile(double percentile) const
+{
+    if (m_count == 0)
+        return 0;
+
+    const double clamped = std::clamp(percentile, 0.0, 100.0);
+    const auto target = std::max<std::uint64_t>(
+        static_cast<std::uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(m_count))), 1);
+
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+    {
+        seen += m_buckets[bucket];
+        if (seen >= target)
+        {
+            // report the middle of the bucket; its width is at most 1/64 of the value
+            const std::uint64_t lowest = GetBucketLowest(bucket);
+            const std::uint64_t width = bucket + 1 < BUCKET_COUNT ? GetBucketLowest(bucket + 1) - lowest : 1;
+            return lowest + width / 2;
+        }
+    }
+    return GetBucketLowest(BUCKET_COUNT - 1);
+}
+
+std::uint64_t DurationHistogram::GetBucketLowest(std::size_t bucket)
+{
+    if (bucket < SUB_BUCKET_COUNT)
+        return bucket;
+
+    const std::size_t magnitude = (bucket - SUB_BUCKET_COUNT) / HALF_SUB_BUCKET_COUNT + 1;
+    const std::uint64_t subBucket = (bucket - SUB_BUCKET_COUNT) % HALF_SUB_BUCKET_COUNT + HALF_SUB_BUCKET_COUNT;
+    return subBucket << magnitude;
+}
+
+std::size_t DurationHistogram::GetBucketIndex(std::uint64_t microseconds)
+{
+    if (microseconds < SUB_BUCKET_COUNT)
+        return static_cast<std::size_t>(microseconds);
+
+    // shift the value down until it has SUB_BUCKET_BITS bits; the shift is its magnitude
+    const int magnitude = FloorLog2(microseconds) - (SUB_BUCKET_BITS - 1);
+    if (magnitude > MAGNITUDE_COUNT)
+        return BUCKET_COUNT - 1;
+
+    const std::uint64_t subBucket = (microseconds >> magnitude) - HALF_SUB_BUCKET_COUNT;
+    return static_cast<std::size_t>(SUB_BUCKET_COUNT + (magnitude - 1) * HALF_SUB_BUCKET_COUNT + subBucket);
+}
+
+FrameStats::FrameStats(float budgetMilliseconds)
+    : m_budget(budgetMilliseconds)
+    , m_overBudget(0)
+    , m_overTwiceBudget(0)
+    , m_minMicroseconds(std::numeric_limits<std::uint64_t>::max())
+    , m_maxMicroseconds(0)
+    , m_mean(0.0)
+    , m_squaredDeviations(0.0)
+{
+}
+
+void FrameStats::Record(float seconds)
+{
+    const auto microseconds = static_cast<std::uint64_t>(std::max(seconds, 0.0f) * 1000000.0f + 0.5f);
+    m_histogram.Record(microseconds);
+    m_minMicroseconds = std::min(m_minMicroseconds, microseconds);
+    m_maxMicroseconds = std::max(m_maxMicroseconds, microseconds);
+
+    const double milliseconds = static_cast<double>(microseconds) / 1000.0;
+    if (milliseconds > m_budget)
+        ++m_overBudget;
+    if (milliseconds > 2.0 * m_budget)
+        ++m_overTwiceBudget;
+
+    const double delta = milliseconds - m_mean;
+    m_mean += delta / static_cast<double>(m_histogram.GetCount());
+    m_squaredDeviations += delta * (milliseconds - m_mean);
+}
+
+void FrameStats::Reset()
+{
+    m_histogram.Reset();
+    m_overBudget = 0;
+    m_overTwiceBudget = 0;
+    m_minMicroseconds = std::numeric_limits<std::uint64_t>::max();
+    m_maxMicroseconds = 0;
+    m_mean = 0.0;
+    m_squaredDeviations = 0.0;
+}
+
+FrameStatsSummary FrameStats::GetSummary() const
+{
+    FrameStatsSummary summary;
+    summary.frameCount = m_histogram.GetCount();
+    summary.budget = m_budget;
+    if (summary.frameCount == 0)
+        return summary;
+
+    summary.mean = static_cast<float>(m_mean);
+    summary.variance = static_cast<float>(m_squaredDeviations / static_cast<double>(summary.frameCount));
+    summary.standardDeviation = std::sqrt(summary.variance);
+    summary.min = ToMilliseconds(m_minMicroseconds);
+    summary.max = ToMilliseconds(m_maxMicroseconds);
+    // bucket midpoints can overshoot the exact extremes, which are known
+    summary.p50 = std::clamp(ToMilliseconds(m_histogram.GetValueAtPercentile(50.0)), summary.min, summary.max);
+    summary.p95 = std::clamp(ToMilliseconds(m_histogram.GetValueAtPercentile(95.0)), summary.min, summary.max);
+    summary.p99 = std::clamp(ToMilliseconds(m_histogram.GetValueAtPercentile(99.0)), summary.min, summary.max);
+    summary.overBudget = m_overBudget;
+    summary.overTwiceBudget = m_overTwiceBudget;
+    return summary;
+}
+
+bool FrameStats::WriteCsv(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open frame stats file: " << path << std::endl;
+        return false;
+    }
+
+    const FrameStatsSummary summary = GetSummary();
+    file << "metric,value\n";
+    file << "frames," << summary.frameCount << "\n";
+    file << "mean_ms," << summary.mean << "\n";
+    file << "variance_ms2," << summary.variance << "\n";
+    file << "stddev_ms," << summary.standardDeviation << "\n";
+    file << "min_ms," << summary.min << "\n";
+    file << "p50_ms," << summary.p50 << "\n";
+    file << "p95_ms," << summary.p95 << "\n";
+    file << "p99_ms," << summary.p99 << "\n";
+    file << "max_ms," << summary.max << "\n";
+    file << "budget_ms," << summary.budget << "\n";
+    file << "over_budget," << summary.overBudget << "\n";
+    file << "over_2x_budget," << summary.overTwiceBudget << "\n";
+    if (!file.good())
+    {
+        std::cerr << "Failed to write frame stats file: " << path << std::endl;
+        return false;
+    }
+
+    const std::string histogramPath = HistogramPath(path);
+    std::ofstream histogram(histogramPath, std::ios::trunc);
+    if (!histogram.is_open())
+    {
+        std::cerr << "Failed to open frame histogram file: " << histogramPath << std::endl;
+        return false;
+    }
+
+    histogram << "lower_ms,upper_ms,frames,cumulative_percent\n";
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < DurationHistogram::BUCKET_COUNT; ++bucket)
+    {
+        const std::uint64_t count = m_histogram.GetBucketCount(bucket);
+        if (count == 0)
+            continue;
+
+        seen += count;
+        const std::uint64_t upper = bucket + 1 < DurationHistogram::BUCKET_COUNT
+                                        ? DurationHistogram::GetBucketLowest(bucket + 1)
+                                        : DurationHistogram::GetBucketLowest(bucket) + 1;
+        histogram << ToMilliseconds(DurationHistogram::GetBucketLowest(bucket)) << "," << ToMilliseconds(upper)
+                  << "," << count << ","
+                  << 100.0 * static_cast<double>(seen) / static_cast<double>(summary.frameCount) << "\n";
+    }
+    if (!histogram.good())
+    {
+        std::cerr << "Failed to write frame histogram file: " << histogramPath << std::endl;
+        return false;
+    }
+    return true;
+}
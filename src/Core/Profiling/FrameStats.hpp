@@ -0,0 +1,107 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Log-linear histogram of durations in microseconds.
+ *
+ * Every power of two is split into SUB_BUCKET_COUNT / 2 equal buckets, so any recorded
+ * value is known to within 1/64 (about 1.6%) from 1us up to two minutes in a fixed 11KB table.
+ * Recording is a couple of shifts and an increment; longer values land in the last bucket.
+ */
+class DurationHistogram
+{
+public:
+    static constexpr int SUB_BUCKET_BITS = 7;
+    static constexpr std::uint64_t SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;
+    static constexpr int MAGNITUDE_COUNT = 20; // covers up to 2^27us, about two minutes
+    static constexpr std::size_t BUCKET_COUNT = SUB_BUCKET_COUNT + MAGNITUDE_COUNT * (SUB_BUCKET_COUNT / 2);
+
+    void Record(std::uint64_t microseconds);
+    void Reset();
+
+    [[nodiscard]] std::uint64_t GetCount() const { return m_count; }
+
+    /**
+     * Smallest value that at least percentile percent of the recorded values are at or below
+     * @param percentile 0 to 100
+     */
+    [[nodiscard]] std::uint64_t GetValueAtPercentile(double percentile) const;
+
+    [[nodiscard]] std::uint64_t GetBucketCount(std::size_t bucket) const { return m_buckets[bucket]; }
+
+    /**
+     * Values in [GetBucketLowest(bucket), GetBucketLowest(bucket + 1)) share a bucket
+     */
+    [[nodiscard]] static std::uint64_t GetBucketLowest(std::size_t bucket);
+    [[nodiscard]] static std::size_t GetBucketIndex(std::uint64_t microseconds);
+
+private:
+    std::array<std::uint64_t, BUCKET_COUNT> m_buckets{};
+    std::uint64_t m_count = 0;
+};
+
+/**
+ * Summary of the frames recorded so far; times in milliseconds
+ */
+struct FrameStatsSummary
+{
+    std::uint64_t frameCount = 0;
+    float mean = 0.0f;
+    float variance = 0.0f; // ms squared
+    float standardDeviation = 0.0f;
+    float min = 0.0f;
+    float p50 = 0.0f;
+    float p95 = 0.0f;
+    float p99 = 0.0f;
+    float max = 0.0f;
+    float budget = 0.0f;
+    std::uint64_t overBudget = 0;
+    std::uint64_t overTwiceBudget = 0; // hitches that drop at least one whole frame
+};
+
+/**
+ * Records every frame time for smoothness statistics. Averages hide stutter, so this keeps
+ * the whole distribution (see DurationHistogram) plus exact extremes, a running variance and
+ * counts of frames that missed the frame budget.
+ */
+class FrameStats
+{
+public:
+    /**
+     * @param budgetMilliseconds Frame time target, e.g. 16.67 for 60 FPS
+     */
+    explicit FrameStats(float budgetMilliseconds = 1000.0f / 60.0f);
+
+    void Record(float seconds);
+    void Reset();
+
+    void SetBudget(float budgetMilliseconds) { m_budget = budgetMilliseconds; }
+
+    [[nodiscard]] FrameStatsSummary GetSummary() const;
+    [[nodiscard]] const DurationHistogram& GetHistogram() const { return m_histogram; }
+
+    /**
+     * Write the summary as metric,value rows to path and the non-empty histogram buckets
+     * next to it (frame_stats.csv gives frame_stats_histogram.csv)
+     * @return true if both files were written
+     */
+    bool WriteCsv(const std::string& path) const;
+
+private:
+    DurationHistogram m_histogram;
+    float m_budget;
+    std::uint64_t m_overBudget;
+    std::uint64_t m_overTwiceBudget;
+    std::uint64_t m_minMicroseconds;
+    std::uint64_t m_maxMicroseconds;
+
+    // Welford's running mean and sum of squared deviations, in milliseconds
+    double m_mean;
+    double m_squaredDeviations;
+};
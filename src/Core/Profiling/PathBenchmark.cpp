@@ -0,0 +1,168 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "PathBenchmark.hpp"
+
+#include "FrameStats.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+double PerSecond(std::size_t count, std::uint64_t nanoseconds)
+{
+    return nanoseconds > 0 ? static_cast<double>(count) * 1e9 / static_cast<double>(nanoseconds) : 0.0;
+}
+
+double NanosecondsToMilliseconds(std::uint64_t nanoseconds)
+{
+    return static_cast<double>(nanoseconds) / 1e6;
+}
+
+void WriteString(std::ostream& out, const std::string& value)
+{
+    out << '"';
+    for (const char c : value)
+    {
+        if (c == '"' || c == '\\')
+            out << '\\';
+        out << c;
+    }
+    out << '"';
+}
+} // namespace
+
+PathBenchmark::PathBenchmark()
+    : m_generatedColumns(0)
+    , m_generationNs(0)
+    , m_streamedColumns(0)
+    , m_streamingNs(0)
+    , m_meshedChunks(0)
+    , m_meshingNs(0)
+    , m_peakHeapBytes(0)
+    , m_peakGpuBytes(0)
+{
+}
+
+void PathBenchmark::RecordGeneration(std::size_t columns, std::uint64_t nanoseconds, bool streamed)
+{
+    m_generatedColumns += columns;
+    m_generationNs += nanoseconds;
+    if (streamed)
+    {
+        m_streamedColumns += columns;
+        m_streamingNs += nanoseconds;
+    }
+}
+
+void PathBenchmark::RecordMeshing(std::size_t chunks, std::uint64_t nanoseconds)
+{
+    m_meshedChunks += chunks;
+    m_meshingNs += nanoseconds;
+}
+
+void PathBenchmark::SampleMemory()
+{
+    std::size_t heapBytes = 0;
+    std::size_t gpuBytes = 0;
+    for (std::size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+    {
+        const auto tag = static_cast<MemoryTag>(i);
+        const MemoryTagStats heap = AllocationTracker::GetHeapStats(tag);
+        heapBytes += heap.currentBytes;
+        gpuBytes += AllocationTracker::GetGpuStats(tag).currentBytes;
+        m_peakTagHeapBytes[i] = std::max(m_peakTagHeapBytes[i], heap.peakBytes);
+    }
+    m_peakHeapBytes = std::max(m_peakHeapBytes, heapBytes);
+    m_peakGpuBytes = std::max(m_peakGpuBytes, gpuBytes);
+}
+
+bool PathBenchmark::WriteJson(const std::string& path, const FrameStats& frameStats,
+                              const PathBenchmarkInfo& info) const
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open benchmark report: " << path << std::endl;
+        return false;
+    }
+
+    const FrameStatsSummary frames = frameStats.GetSummary();
+    file << "{\n";
+    file << "  \"path\": ";
+    WriteString(file, info.path);
+    file << ",\n  \"mode\": ";
+    WriteString(file, info.mode);
+    file << ",\n";
+    file << "  \"seed\": " << info.seed << ",\n";
+    file << "  \"renderDistance\": " << info.renderDistance << ",\n";
+    file << "  \"workers\": " << info.workerCount << ",\n";
+    file << "  \"timestep\": " << info.timestep << ",\n";
+    file << "  \"frames\": " << info.frames << ",\n";
+    file << "  \"wallSeconds\": " << info.wallSeconds << ",\n";
+
+    file << "  \"frameTimeMs\": {\"mean\": " << frames.mean << ", \"stddev\": " << frames.standardDeviation
+         << ", \"min\": " << frames.min << ", \"p50\": " << frames.p50 << ", \"p95\": " << frames.p95
+         << ", \"p99\": " << frames.p99 << ", \"max\": " << frames.max << ", \"budget\": " << frames.budget
+         << ", \"overBudget\": " << frames.overBudget << ", \"overTwiceBudget\": " << frames.overTwiceBudget
+         << "},\n";
+
+    file << "  \"generation\": {\"columns\": " << m_generatedColumns
+         << ", \"ms\": " << NanosecondsToMilliseconds(m_generationNs)
+         << ", \"columnsPerSecond\": " << PerSecond(m_generatedColumns, m_generationNs)
+         << ", \"initialFillColumns\": " << m_generatedColumns - m_streamedColumns
+         << ", \"initialFillMs\": " << NanosecondsToMilliseconds(m_generationNs - m_streamingNs)
+         << ", \"streamedColumns\": " << m_streamedColumns
+         << ", \"streamedMs\": " << NanosecondsToMilliseconds(m_streamingNs)
+         << ", \"streamedColumnsPerSecond\": " << PerSecond(m_streamedColumns, m_streamingNs) << "},\n";
+    file << "  \"meshing\": {\"chunks\": " << m_meshedChunks << ", \"ms\": " << NanosecondsToMilliseconds(m_meshingNs)
+         << ", \"chunksPerSecond\": " << PerSecond(m_meshedChunks, m_meshingNs) << "},\n";
+
+    file << "  \"memory\": {\"heapTracked\": " << (AllocationTracker::IsHeapTrackingEnabled() ? "true" : "false")
+         << ", \"peakResidentBytes\": " << GetPeakResidentBytes() << ", \"peakHeapBytes\": " << m_peakHeapBytes
+         << ", \"peakGpuBytes\": " << m_peakGpuBytes << ", \"peakHeapBytesByTag\": {";
+    for (std::size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+    {
+        file << (i > 0 ? ", " : "") << "\"" << GetMemoryTagName(static_cast<MemoryTag>(i))
+             << "\": " << m_peakTagHeapBytes[i];
+    }
+    file << "}}\n}\n";
+
+    if (!file.good())
+    {
+        std::cerr << "Failed to write benchmark report: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+std::size_t PathBenchmark::GetPeakResidentBytes()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.PeakWorkingSetSize;
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#ifdef __APPLE__
+    return static_cast<std::size_t>(usage.ru_maxrss); // bytes on macOS
+#else
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024; // kilobytes on Linux
+#endif
+#endif
+}
@@ -0,0 +1,75 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Core/Memory/AllocationTracker.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class FrameStats;
+
+/**
+ * What a path benchmark run was, written alongside its results so reports from different
+ * builds can be checked for being comparable
+ */
+struct PathBenchmarkInfo
+{
+    std::string path; // camera path file, or "default"
+    std::string mode; // headless mode
+    int seed = 0;
+    int renderDistance = 0;
+    unsigned workerCount = 0;
+    float timestep = 0.0f; // simulated seconds per frame
+    std::size_t frames = 0;
+    double wallSeconds = 0.0;
+};
+
+/**
+ * Totals for a camera path benchmark run: world generation and meshing throughput over the
+ * whole path and the memory high-water marks. Frame times come from the engine's FrameStats.
+ * Generation is also split into the initial fill around the start of the path and the
+ * columns streamed in after it as the camera moved.
+ */
+class PathBenchmark
+{
+public:
+    PathBenchmark();
+
+    /**
+     * Count the columns one frame generated
+     * @param streamed true once the initial fill is over
+     */
+    void RecordGeneration(std::size_t columns, std::uint64_t nanoseconds, bool streamed);
+    void RecordMeshing(std::size_t chunks, std::uint64_t nanoseconds);
+
+    /**
+     * Fold the last frame's memory counters into the peaks; call after AllocationTracker::EndFrame
+     */
+    void SampleMemory();
+
+    /**
+     * Write the run as one JSON object
+     * @return true if the file was written
+     */
+    bool WriteJson(const std::string& path, const FrameStats& frameStats, const PathBenchmarkInfo& info) const;
+
+    /**
+     * Largest resident set the process reached, in bytes, or 0 if the platform doesn't say
+     */
+    [[nodiscard]] static std::size_t GetPeakResidentBytes();
+
+private:
+    std::size_t m_generatedColumns;
+    std::uint64_t m_generationNs;
+    std::size_t m_streamedColumns; // after the initial fill
+    std::uint64_t m_streamingNs;
+    std::size_t m_meshedChunks;
+    std::uint64_t m_meshingNs;
+
+    std::size_t m_peakHeapBytes; // live heap over all tags at the end of a frame
+    std::size_t m_peakGpuBytes;
+    std::array<std::size_t, MEMORY_TAG_COUNT> m_peakTagHeapBytes{}; // within a frame
+};
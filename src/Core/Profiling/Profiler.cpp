@@ -0,0 +1,309 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * Single producer ring: only one thread writes, the trace writer reads
+ */
+struct ProfileTrack
+{
+    std::array<ProfileEvent, Profiler::EVENTS_PER_THREAD> events;
+    std::atomic<std::uint64_t> head{0}; // events ever written
+    std::uint32_t threadId = 0;
+    std::string name;
+    bool isThread = true; // false for tracks made with CreateTrack
+};
+
+namespace
+{
+constexpr std::uint64_t RING_MASK = Profiler::EVENTS_PER_THREAD - 1;
+static_assert((Profiler::EVENTS_PER_THREAD & RING_MASK) == 0, "ring size must be a power of two");
+
+/**
+ * Tracks outlive their threads so a capture still shows work from finished threads
+ */
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ProfileTrack>> tracks;
+};
+
+Registry& GetRegistry()
+{
+    static Registry registry;
+    return registry;
+}
+
+ProfileTrack* AddTrack(std::string name, bool isThread)
+{
+    Registry& registry = GetRegistry();
+    std::lock_guard lock(registry.mutex);
+    auto track = std::make_unique<ProfileTrack>();
+    track->threadId = static_cast<std::uint32_t>(registry.tracks.size());
+    track->name = name.empty() ? "Thread " + std::to_string(track->threadId) : std::move(name);
+    track->isThread = isThread;
+    registry.tracks.push_back(std::move(track));
+    return registry.tracks.back().get();
+}
+
+thread_local ProfileTrack* t_track = nullptr;
+
+ProfileTrack& GetThreadTrack()
+{
+    if (!t_track)
+        t_track = AddTrack({}, true);
+    return *t_track;
+}
+
+/**
+ * Copy the events of a ring that overlap the window. The owner keeps writing meanwhile, so
+ * whatever it may have overwritten during the copy is dropped afterwards.
+ * @return true if events inside the window had already been overwritten
+ */
+bool CopyEvents(const ProfileTrack& track, std::uint64_t beginNs, std::uint64_t endNs,
+                std::vector<ProfileEvent>& out)
+{
+    const std::uint64_t head = track.head.load(std::memory_order_acquire);
+    const std::uint64_t first = head > Profiler::EVENTS_PER_THREAD ? head - Profiler::EVENTS_PER_THREAD : 0;
+    // events land in the ring in the order their scopes end
+    const bool overflowed = first > 0 && track.events[first & RING_MASK].endNs >= beginNs;
+
+    std::vector<std::uint64_t> indices;
+    for (std::uint64_t i = first; i < head; ++i)
+    {
+        const ProfileEvent& event = track.events[i & RING_MASK];
+        if (event.endNs >= beginNs && event.beginNs <= endNs)
+        {
+            out.push_back(event);
+            indices.push_back(i);
+        }
+    }
+
+    // the writer reused the slots of every event up to EVENTS_PER_THREAD behind its head
+    const std::uint64_t after = track.head.load(std::memory_order_acquire);
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+        if (indices[i] + Profiler::EVENTS_PER_THREAD > after)
+            out[kept++] = out[i];
+    }
+    out.resize(kept);
+    return overflowed;
+}
+
+void WriteEscaped(std::ostream& out, const char* text)
+{
+    for (; *text; ++text)
+    {
+        if (*text == '"' || *text == '\\')
+            out << '\\';
+        out << *text;
+    }
+}
+
+/**
+ * Chrome traces use microseconds; keep the nanoseconds as three decimals
+ */
+void WriteMicroseconds(std::ostream& out, std::uint64_t nanoseconds)
+{
+    char text[32];
+    std::snprintf(text, sizeof(text), "%" PRIu64 ".%03" PRIu64, nanoseconds / 1000, nanoseconds % 1000);
+    out << text;
+}
+
+std::uint64_t g_frameBeginNs = 0;
+std::uint64_t g_lastFrameBeginNs = 0;
+std::uint64_t g_lastFrameEndNs = 0;
+std::uint64_t g_captureBeginNs = 0;
+std::size_t g_captureFramesLeft = 0;
+std::string g_capturePath;
+} // namespace
+
+bool Profiler::IsEnabled()
+{
+#ifdef SILK_PROFILE
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::uint64_t Profiler::Now()
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+void Profiler::SetThreadName(const char* name)
+{
+    // without the scopes there is nothing to label, so skip allocating a ring
+    if (!IsEnabled())
+        return;
+
+    ProfileTrack& track = GetThreadTrack();
+    std::lock_guard lock(GetRegistry().mutex);
+    track.name = name;
+}
+
+ProfileTrack* Profiler::CreateTrack(const char* name)
+{
+    return IsEnabled() ? AddTrack(name, false) : nullptr;
+}
+
+void Profiler::Record(const char* name, std::uint64_t beginNs, std::uint64_t endNs)
+{
+    RecordTo(GetThreadTrack(), name, beginNs, endNs);
+}
+
+void Profiler::RecordTo(ProfileTrack& track, const char* name, std::uint64_t beginNs, std::uint64_t endNs)
+{
+    const std::uint64_t head = track.head.load(std::memory_order_relaxed);
+    track.events[head & RING_MASK] = ProfileEvent{name, beginNs, endNs};
+    track.head.store(head + 1, std::memory_order_release);
+}
+
+void Profiler::RequestCapture(std::size_t frameCount, const std::string& path)
+{
+    if (!IsEnabled())
+    {
+        std::cerr << "Profiler capture requested, but the build has SILK_PROFILE off" << std::endl;
+        return;
+    }
+    if (IsCapturing() || frameCount == 0)
+        return;
+
+    g_captureBeginNs = Now();
+    g_captureFramesLeft = frameCount;
+    g_capturePath = path;
+    std::cout << "Profiler capturing " << frameCount << " frames" << std::endl;
+}
+
+bool Profiler::IsCapturing()
+{
+    return g_captureFramesLeft > 0;
+}
+
+void Profiler::EndFrame()
+{
+#ifdef SILK_PROFILE
+    // frames are recorded here rather than by a scope so they tile the main thread's timeline
+    const std::uint64_t now = Now();
+    if (g_frameBeginNs > 0)
+    {
+        Record("Frame", g_frameBeginNs, now);
+        g_lastFrameBeginNs = g_frameBeginNs;
+        g_lastFrameEndNs = now;
+    }
+    g_frameBeginNs = now;
+
+    if (g_captureFramesLeft == 0 || --g_captureFramesLeft > 0)
+        return;
+
+    if (WriteChromeTrace(g_capturePath, g_captureBeginNs, now))
+        std::cout << "Profiler capture written to " << g_capturePath << std::endl;
+#endif
+}
+
+void Profiler::GetLastFrame(std::uint64_t& beginNs, std::uint64_t& endNs)
+{
+    beginNs = g_lastFrameBeginNs;
+    endNs = g_lastFrameEndNs;
+}
+
+void Profiler::CollectRecent(std::uint64_t beginNs, std::uint64_t endNs, std::vector<ProfileEvent>& out)
+{
+    Registry& registry = GetRegistry();
+    std::lock_guard lock(registry.mutex);
+    for (const std::unique_ptr<ProfileTrack>& track : registry.tracks)
+    {
+        if (!track->isThread)
+            continue;
+
+        // a thread's events are stored in the order its scopes end
+        const std::uint64_t head = track->head.load(std::memory_order_acquire);
+        const std::uint64_t first = head > EVENTS_PER_THREAD ? head - EVENTS_PER_THREAD : 0;
+        const std::size_t start = out.size();
+        std::uint64_t oldest = head;
+        for (; oldest > first; --oldest)
+        {
+            const ProfileEvent& event = track->events[(oldest - 1) & RING_MASK];
+            if (event.endNs <= beginNs)
+                break;
+            if (event.endNs <= endNs)
+                out.push_back(event);
+        }
+
+        // a thread still running may have lapped the oldest slots read; drop its events then
+        if (oldest + EVENTS_PER_THREAD <= track->head.load(std::memory_order_acquire))
+            out.resize(start);
+    }
+}
+
+bool Profiler::WriteChromeTrace(const std::string& path, std::uint64_t beginNs, std::uint64_t endNs)
+{
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open profiler trace: " << path << std::endl;
+        return false;
+    }
+
+    Registry& registry = GetRegistry();
+    std::lock_guard lock(registry.mutex);
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    std::vector<ProfileEvent> events;
+    for (const std::unique_ptr<ProfileTrack>& track : registry.tracks)
+    {
+        events.clear();
+        if (CopyEvents(*track, beginNs, endNs, events))
+        {
+            std::cerr << "Profiler ring of " << track->name << " overflowed; the trace misses its earliest events"
+                      << std::endl;
+        }
+
+        file << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+             << track->threadId << ",\"args\":{\"name\":\"";
+        WriteEscaped(file, track->name.c_str());
+        file << "\"}}";
+        first = false;
+
+        for (const ProfileEvent& event : events)
+        {
+            // clip scopes that straddle the window so the trace starts at zero
+            const std::uint64_t begin = std::max(event.beginNs, beginNs);
+            const std::uint64_t end = std::min(event.endNs, endNs);
+            file << ",\n{\"name\":\"";
+            WriteEscaped(file, event.name);
+            file << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << track->threadId << ",\"ts\":";
+            WriteMicroseconds(file, begin - beginNs);
+            file << ",\"dur\":";
+            WriteMicroseconds(file, end - begin);
+            file << "}";
+        }
+    }
+    file << "\n]}\n";
+
+    if (!file.good())
+    {
+        std::cerr << "Failed to write profiler trace: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,139 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * One finished scope on one thread
+ */
+struct ProfileEvent
+{
+    const char* name; // string literal, stored by pointer
+    std::uint64_t beginNs;
+    std::uint64_t endNs;
+};
+
+/**
+ * Ring of events shown as one row of the trace
+ */
+struct ProfileTrack;
+
+/**
+ * Scoped CPU profiler.
+ *
+ * Every thread records its finished scopes into its own fixed ring buffer, so recording is
+ * a clock read and a store with no locks or allocation after the first event of a thread.
+ * The rings always run; a capture just remembers a time window and, once its frames have
+ * ended, writes every event inside it to a Chrome trace JSON file (chrome://tracing or
+ * ui.perfetto.dev).
+ *
+ * Instrument code with PROFILE_SCOPE("Name"); the macro expands to nothing unless the build
+ * defines SILK_PROFILE, so release builds pay nothing for it.
+ */
+class Profiler
+{
+public:
+    /**
+     * Events kept per thread; older ones are overwritten
+     */
+    static constexpr std::size_t EVENTS_PER_THREAD = 1 << 16;
+
+    /**
+     * True if PROFILE_SCOPE is compiled in
+     */
+    [[nodiscard]] static bool IsEnabled();
+
+    /**
+     * Nanoseconds on the profiler's monotonic clock
+     */
+    [[nodiscard]] static std::uint64_t Now();
+
+    /**
+     * Name the calling thread in written traces
+     */
+    static void SetThreadName(const char* name);
+
+    /**
+     * Add a row for events that do not come from a thread's own scopes, such as GPU timings
+     * read back later. Tracks live until exit and must be written to by one thread at a time.
+     * @return nullptr if the profiler is compiled out
+     */
+    [[nodiscard]] static ProfileTrack* CreateTrack(const char* name);
+
+    /**
+     * Append a finished scope to the calling thread's ring
+     */
+    static void Record(const char* name, std::uint64_t beginNs, std::uint64_t endNs);
+
+    /**
+     * Append a finished scope to a track created with CreateTrack
+     */
+    static void RecordTo(ProfileTrack& track, const char* name, std::uint64_t beginNs, std::uint64_t endNs);
+
+    /**
+     * Start a capture that is written to path once frameCount frames have ended. Ignored if
+     * a capture is already running.
+     */
+    static void RequestCapture(std::size_t frameCount, const std::string& path);
+
+    [[nodiscard]] static bool IsCapturing();
+
+    /**
+     * Mark the end of a frame and write the running capture when it is complete. Call from
+     * the main thread between frames, while no jobs are recording.
+     */
+    static void EndFrame();
+
+    /**
+     * Time window of the last frame ended by EndFrame; both zero before the second frame
+     */
+    static void GetLastFrame(std::uint64_t& beginNs, std::uint64_t& endNs);
+
+    /**
+     * Append the recent events of every thread (not of CreateTrack tracks) that ended after
+     * beginNs and no later than endNs. Walks back from the newest event, so it is cheap enough to run every
+     * frame for a live display. Call between frames, like EndFrame.
+     */
+    static void CollectRecent(std::uint64_t beginNs, std::uint64_t endNs, std::vector<ProfileEvent>& out);
+
+    /**
+     * Write the events of every thread that overlap [beginNs, endNs] as a Chrome trace
+     * @return true if the file was written
+     */
+    static bool WriteChromeTrace(const std::string& path, std::uint64_t beginNs, std::uint64_t endNs);
+};
+
+/**
+ * Records the lifetime of a scope; use through PROFILE_SCOPE
+ */
+class ProfileScope
+{
+public:
+    explicit ProfileScope(const char* name)
+        : m_name(name)
+        , m_beginNs(Profiler::Now())
+    {
+    }
+
+    ~ProfileScope() { Profiler::Record(m_name, m_beginNs, Profiler::Now()); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_name;
+    std::uint64_t m_beginNs;
+};
+
+#define SILK_PROFILE_CONCAT_INNER(a, b) a##b
+#define SILK_PROFILE_CONCAT(a, b) SILK_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef SILK_PROFILE
+#define PROFILE_SCOPE(name) const ProfileScope SILK_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name) static_cast<void>(0)
+#endif
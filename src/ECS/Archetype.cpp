@@ -0,0 +1,147 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "Archetype.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <new>
+
+namespace
+{
+std::array<ComponentInfo, MAX_COMPONENT_TYPES> g_componentInfos{};
+ComponentId g_componentCount = 0;
+std::mutex g_componentMutex;
+
+std::size_t AlignOffset(std::size_t value, std::size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+} // namespace
+
+ComponentId RegisterComponentType(std::size_t size, std::size_t alignment)
+{
+    std::lock_guard<std::mutex> lock(g_componentMutex);
+    if (g_componentCount >= MAX_COMPONENT_TYPES)
+    {
+        // a mask bit per type is what keeps archetype matching a single AND
+        std::cerr << "Too many component types (max " << MAX_COMPONENT_TYPES << ")" << std::endl;
+        std::abort();
+    }
+
+    g_componentInfos[g_componentCount] = {size, alignment};
+    return g_componentCount++;
+}
+
+const ComponentInfo& GetComponentInfo(ComponentId id)
+{
+    return g_componentInfos[id];
+}
+
+void Archetype::ChunkDeleter::operator()(std::byte* data) const
+{
+    ::operator delete(data, std::align_val_t{CHUNK_ALIGNMENT});
+}
+
+Archetype::Archetype(ComponentMask mask)
+    : m_mask(mask)
+    , m_capacity(0)
+    , m_count(0)
+{
+    std::size_t rowSize = sizeof(Entity);
+    for (ComponentId id = 0; id < MAX_COMPONENT_TYPES; ++id)
+    {
+        if (Has(id))
+        {
+            m_components.push_back(id);
+            rowSize += GetComponentInfo(id).size;
+        }
+    }
+
+    // largest capacity whose aligned columns still fit into one chunk
+    for (m_capacity = CHUNK_SIZE / rowSize; m_capacity > 0; --m_capacity)
+    {
+        std::size_t offset = sizeof(Entity) * m_capacity;
+        for (const ComponentId id : m_components)
+        {
+            const ComponentInfo& info = GetComponentInfo(id);
+            offset = AlignOffset(offset, info.alignment) + info.size * m_capacity;
+        }
+        if (offset <= CHUNK_SIZE)
+            break;
+    }
+    if (m_capacity == 0)
+    {
+        // rows never span chunks, and Allocate divides by the capacity
+        std::cerr << "Archetype row of " << rowSize << " bytes does not fit a " << CHUNK_SIZE << " byte chunk"
+                  << std::endl;
+        std::abort();
+    }
+
+    std::size_t offset = sizeof(Entity) * m_capacity;
+    for (const ComponentId id : m_components)
+    {
+        const ComponentInfo& info = GetComponentInfo(id);
+        offset = AlignOffset(offset, info.alignment);
+        m_offsets[id] = static_cast<std::uint32_t>(offset);
+        offset += info.size * m_capacity;
+    }
+}
+
+std::size_t Archetype::Allocate(Entity entity)
+{
+    const std::size_t row = m_count;
+    const std::size_t chunk = row / m_capacity;
+    if (chunk == m_chunks.size())
+    {
+        m_chunks.emplace_back(static_cast<std::byte*>(::operator new(CHUNK_SIZE, std::align_val_t{CHUNK_ALIGNMENT})));
+    }
+
+    const std::size_t index = row % m_capacity;
+    GetEntities(chunk)[index] = entity;
+    for (const ComponentId id : m_components)
+    {
+        const std::size_t size = GetComponentInfo(id).size;
+        std::memset(static_cast<std::byte*>(GetColumn(chunk, id)) + index * size, 0, size);
+    }
+
+    ++m_count;
+    return row;
+}
+
+Entity Archetype::Remove(std::size_t row)
+{
+    const std::size_t last = m_count - 1;
+    Entity moved;
+    if (row != last)
+    {
+        const std::size_t chunk = row / m_capacity;
+        const std::size_t lastChunk = last / m_capacity;
+        moved = GetEntities(lastChunk)[last % m_capacity];
+        GetEntities(chunk)[row % m_capacity] = moved;
+        for (const ComponentId id : m_components)
+        {
+            std::memcpy(GetComponent(row, id), GetComponent(last, id), GetComponentInfo(id).size);
+        }
+    }
+    --m_count;
+
+    // keep one spare chunk so an entity bouncing across a chunk border does not thrash
+    while (m_chunks.size() > GetChunkCount() + 1)
+    {
+        m_chunks.pop_back();
+    }
+    return moved;
+}
+
+void Archetype::CopyShared(std::size_t row, Archetype& source, std::size_t sourceRow)
+{
+    for (const ComponentId id : m_components)
+    {
+        if (source.Has(id))
+            std::memcpy(GetComponent(row, id), source.GetComponent(sourceRow, id), GetComponentInfo(id).size);
+    }
+}
@@ -0,0 +1,107 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Entity.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * Storage for every entity with one exact set of components.
+ *
+ * Entities live in fixed 16 KB chunks, each split into one array per component (and one of
+ * entity handles), so a query walks plain contiguous arrays. Rows are packed: removing an
+ * entity moves the archetype's last row into the hole. A global row is
+ * chunk * capacity + index within the chunk.
+ */
+class Archetype
+{
+public:
+    static constexpr std::size_t CHUNK_SIZE = 16 * 1024;
+    static constexpr std::size_t CHUNK_ALIGNMENT = 64;
+
+    explicit Archetype(ComponentMask mask);
+
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    [[nodiscard]] ComponentMask GetMask() const { return m_mask; }
+    [[nodiscard]] bool Has(ComponentId id) const { return (m_mask >> id) & 1; }
+    [[nodiscard]] const std::vector<ComponentId>& GetComponents() const { return m_components; }
+
+    [[nodiscard]] std::size_t GetEntityCount() const { return m_count; }
+    [[nodiscard]] std::size_t GetChunkCapacity() const { return m_capacity; }
+    [[nodiscard]] std::size_t GetChunkCount() const { return (m_count + m_capacity - 1) / m_capacity; }
+
+    /**
+     * Number of live rows in a chunk; every chunk but the last is full
+     */
+    [[nodiscard]] std::size_t GetChunkEntityCount(std::size_t chunk) const
+    {
+        return std::min(m_capacity, m_count - chunk * m_capacity);
+    }
+
+    [[nodiscard]] Entity* GetEntities(std::size_t chunk)
+    {
+        return reinterpret_cast<Entity*>(m_chunks[chunk].get());
+    }
+
+    /**
+     * Start of a component's array in a chunk
+     */
+    [[nodiscard]] void* GetColumn(std::size_t chunk, ComponentId id)
+    {
+        return m_chunks[chunk].get() + m_offsets[id];
+    }
+
+    template<typename T>
+    [[nodiscard]] T* GetColumn(std::size_t chunk)
+    {
+        return static_cast<T*>(GetColumn(chunk, GetComponentId<T>()));
+    }
+
+    [[nodiscard]] void* GetComponent(std::size_t row, ComponentId id)
+    {
+        return static_cast<std::byte*>(GetColumn(row / m_capacity, id)) +
+               (row % m_capacity) * GetComponentInfo(id).size;
+    }
+
+    /**
+     * Append a row for an entity; its components are zeroed
+     * @return The new row
+     */
+    std::size_t Allocate(Entity entity);
+
+    /**
+     * Remove a row by moving the last row into it
+     * @return The entity now at row, or an invalid handle if row was the last one
+     */
+    Entity Remove(std::size_t row);
+
+    /**
+     * Copy the components two archetypes share from a row of another archetype
+     */
+    void CopyShared(std::size_t row, Archetype& source, std::size_t sourceRow);
+
+    // archetype reached by adding or removing one component, filled in lazily
+    std::array<Archetype*, MAX_COMPONENT_TYPES> addEdges{};
+    std::array<Archetype*, MAX_COMPONENT_TYPES> removeEdges{};
+
+private:
+    struct ChunkDeleter
+    {
+        void operator()(std::byte* data) const;
+    };
+
+    ComponentMask m_mask;
+    std::vector<ComponentId> m_components;
+    std::array<std::uint32_t, MAX_COMPONENT_TYPES> m_offsets{};
+    std::size_t m_capacity;
+    std::size_t m_count;
+    std::vector<std::unique_ptr<std::byte[], ChunkDeleter>> m_chunks;
+};
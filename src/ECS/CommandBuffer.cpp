@@ -0,0 +1,62 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "CommandBuffer.hpp"
+
+#include "EntityManager.hpp"
+
+void CommandBuffer::Playback(EntityManager& entities)
+{
+    std::vector<ComponentId> ids;
+    std::vector<const void*> data;
+    // entity created for each deferred handle, by creation order
+    std::vector<Entity> created(m_createCount);
+    const auto resolve = [&](Entity entity) {
+        return entity.generation == DEFERRED_GENERATION && entity.index < created.size() ? created[entity.index]
+                                                                                          : entity;
+    };
+
+    for (std::size_t i = 0; i < m_commands.size(); ++i)
+    {
+        const Command& command = m_commands[i];
+        switch (command.type)
+        {
+        case CommandType::Create:
+        {
+            // build the entity in its final archetype instead of moving it once per component
+            ids.clear();
+            data.clear();
+            ComponentMask mask = 0;
+            for (; i + 1 < m_commands.size() && m_commands[i + 1].type == CommandType::Add &&
+                   m_commands[i + 1].entity == command.entity;
+                 ++i)
+            {
+                const Command& add = m_commands[i + 1];
+                ids.push_back(add.component);
+                data.push_back(m_data.data() + add.dataOffset);
+                mask |= ComponentMask{1} << add.component;
+            }
+            created[command.entity.index] = entities.CreateFromData(mask, ids.data(), data.data(), ids.size());
+            break;
+        }
+        case CommandType::Destroy:
+            entities.Destroy(resolve(command.entity));
+            break;
+        case CommandType::Add:
+            entities.AddComponent(resolve(command.entity), command.component, m_data.data() + command.dataOffset);
+            break;
+        case CommandType::Remove:
+            entities.RemoveComponent(resolve(command.entity), command.component);
+            break;
+        }
+    }
+    Clear();
+}
+
+void CommandBuffer::Clear()
+{
+    m_commands.clear();
+    m_data.clear();
+    m_createCount = 0;
+}
@@ -0,0 +1,91 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Entity.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+class EntityManager;
+
+/**
+ * Structural changes recorded during a query and applied afterwards, in order, by
+ * Playback. A buffer is not thread-safe; give each job its own.
+ */
+class CommandBuffer
+{
+public:
+    /**
+     * Record the creation of an entity. The returned handle is deferred: it can be passed to
+     * later Destroy, Add and Remove calls on this buffer, which Playback applies to the entity
+     * it creates, but it means nothing to the EntityManager or to other buffers.
+     */
+    template<typename... Ts>
+    Entity Create(const Ts&... components)
+    {
+        const Entity entity{m_createCount++, DEFERRED_GENERATION};
+        m_commands.push_back({CommandType::Create, entity, 0, 0});
+        (Record(CommandType::Add, entity, GetComponentId<Ts>(), &components, sizeof(Ts)), ...);
+        return entity;
+    }
+
+    void Destroy(Entity entity) { m_commands.push_back({CommandType::Destroy, entity, 0, 0}); }
+
+    template<typename T>
+    void Add(Entity entity, const T& component = T{})
+    {
+        Record(CommandType::Add, entity, GetComponentId<T>(), &component, sizeof(T));
+    }
+
+    template<typename T>
+    void Remove(Entity entity)
+    {
+        m_commands.push_back({CommandType::Remove, entity, GetComponentId<T>(), 0});
+    }
+
+    /**
+     * Apply every recorded change and clear the buffer
+     */
+    void Playback(EntityManager& entities);
+
+    [[nodiscard]] bool IsEmpty() const { return m_commands.empty(); }
+    [[nodiscard]] std::size_t GetCommandCount() const { return m_commands.size(); }
+
+    void Clear();
+
+private:
+    enum class CommandType : std::uint8_t
+    {
+        Create,
+        Destroy,
+        Add,
+        Remove
+    };
+
+    struct Command
+    {
+        CommandType type;
+        Entity entity;
+        ComponentId component;
+        std::size_t dataOffset;
+    };
+
+    // marks handles returned by Create; live entities never reach this generation
+    static constexpr std::uint32_t DEFERRED_GENERATION = 0xFFFFFFFF;
+
+    std::vector<Command> m_commands;
+    std::uint32_t m_createCount = 0;
+    // component values, copied out with memcpy so no alignment is kept
+    std::vector<std::byte> m_data;
+
+    void Record(CommandType type, Entity entity, ComponentId component, const void* data, std::size_t size)
+    {
+        const std::size_t offset = m_data.size();
+        m_data.resize(offset + size);
+        std::memcpy(m_data.data() + offset, data, size);
+        m_commands.push_back({type, entity, component, offset});
+    }
+};
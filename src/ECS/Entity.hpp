@@ -0,0 +1,74 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * Handle to an entity. The generation changes every time an index is reused, so stale
+ * handles to destroyed entities are detected instead of aliasing a new entity.
+ */
+struct Entity
+{
+    static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+    std::uint32_t index = INVALID_INDEX;
+    std::uint32_t generation = 0;
+
+    [[nodiscard]] bool IsValid() const { return index != INVALID_INDEX; }
+
+    bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Entity& other) const { return !(*this == other); }
+};
+
+using ComponentId = std::uint32_t;
+
+/**
+ * Bit per component type; an archetype is identified by the mask of its components
+ */
+using ComponentMask = std::uint64_t;
+
+constexpr ComponentId MAX_COMPONENT_TYPES = 64;
+
+struct ComponentInfo
+{
+    std::size_t size;
+    std::size_t alignment;
+};
+
+/**
+ * Assign the next component id. Called once per type through GetComponentId.
+ */
+ComponentId RegisterComponentType(std::size_t size, std::size_t alignment);
+
+[[nodiscard]] const ComponentInfo& GetComponentInfo(ComponentId id);
+
+/**
+ * Id of a component type, assigned on first use. Components are plain data: they are moved
+ * between chunks with memcpy and never constructed or destroyed in place.
+ */
+template<typename T>
+ComponentId GetComponentId()
+{
+    if constexpr (std::is_const_v<T>)
+    {
+        // const T shares the id of T
+        return GetComponentId<std::remove_const_t<T>>();
+    }
+    else
+    {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                      "Components must be plain data");
+
+        static const ComponentId id = RegisterComponentType(sizeof(T), alignof(T));
+        return id;
+    }
+}
+
+template<typename... Ts>
+ComponentMask GetComponentMask()
+{
+    return (ComponentMask{0} | ... | (ComponentMask{1} << GetComponentId<Ts>()));
+}
@@ -0,0 +1,153 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "EntityManager.hpp"
+
+#include <cstring>
+
+EntityManager::EntityManager()
+    : m_entityCount(0)
+{
+    GetArchetype(0);
+}
+
+EntityManager::~EntityManager() = default;
+
+Entity EntityManager::CreateFromData(ComponentMask mask, const ComponentId* ids, const void* const* data,
+                                     std::size_t count)
+{
+    Entity entity;
+    if (!m_freeIndices.empty())
+    {
+        entity.index = m_freeIndices.back();
+        m_freeIndices.pop_back();
+    }
+    else
+    {
+        entity.index = static_cast<std::uint32_t>(m_records.size());
+        m_records.emplace_back();
+    }
+    entity.generation = m_records[entity.index].generation;
+
+    Archetype& archetype = GetArchetype(mask);
+    const std::size_t row = archetype.Allocate(entity);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::memcpy(archetype.GetComponent(row, ids[i]), data[i], GetComponentInfo(ids[i]).size);
+    }
+
+    m_records[entity.index].archetype = &archetype;
+    m_records[entity.index].row = row;
+    ++m_entityCount;
+    return entity;
+}
+
+void EntityManager::Destroy(Entity entity)
+{
+    if (!IsAlive(entity))
+        return;
+
+    EntityRecord& record = m_records[entity.index];
+    const Entity moved = record.archetype->Remove(record.row);
+    if (moved.IsValid())
+        m_records[moved.index].row = record.row;
+
+    record.archetype = nullptr;
+    ++record.generation;
+    m_freeIndices.push_back(entity.index);
+    --m_entityCount;
+}
+
+bool EntityManager::IsAlive(Entity entity) const
+{
+    return entity.index < m_records.size() && m_records[entity.index].archetype &&
+           m_records[entity.index].generation == entity.generation;
+}
+
+void EntityManager::AddComponent(Entity entity, ComponentId id, const void* data)
+{
+    if (!IsAlive(entity))
+        return;
+
+    Archetype* current = m_records[entity.index].archetype;
+    if (!current->Has(id))
+    {
+        if (!current->addEdges[id])
+        {
+            Archetype& target = GetArchetype(current->GetMask() | (ComponentMask{1} << id));
+            current->addEdges[id] = &target;
+            target.removeEdges[id] = current;
+        }
+        MoveEntity(entity, *current->addEdges[id]);
+    }
+
+    const EntityRecord& record = m_records[entity.index];
+    std::memcpy(record.archetype->GetComponent(record.row, id), data, GetComponentInfo(id).size);
+}
+
+void EntityManager::RemoveComponent(Entity entity, ComponentId id)
+{
+    if (!IsAlive(entity))
+        return;
+
+    Archetype* current = m_records[entity.index].archetype;
+    if (!current->Has(id))
+        return;
+
+    if (!current->removeEdges[id])
+    {
+        Archetype& target = GetArchetype(current->GetMask() & ~(ComponentMask{1} << id));
+        current->removeEdges[id] = &target;
+        target.addEdges[id] = current;
+    }
+    MoveEntity(entity, *current->removeEdges[id]);
+}
+
+void* EntityManager::GetComponent(Entity entity, ComponentId id)
+{
+    if (!IsAlive(entity))
+        return nullptr;
+
+    const EntityRecord& record = m_records[entity.index];
+    return record.archetype->Has(id) ? record.archetype->GetComponent(record.row, id) : nullptr;
+}
+
+Archetype& EntityManager::GetArchetype(ComponentMask mask)
+{
+    auto& archetype = m_archetypes[mask];
+    if (!archetype)
+    {
+        archetype = std::make_unique<Archetype>(mask);
+        m_archetypeList.push_back(archetype.get());
+    }
+    return *archetype;
+}
+
+const std::vector<Archetype*>& EntityManager::Match(ComponentMask mask)
+{
+    QueryCache& query = m_queries[mask];
+    for (; query.checkedCount < m_archetypeList.size(); ++query.checkedCount)
+    {
+        Archetype* archetype = m_archetypeList[query.checkedCount];
+        if ((archetype->GetMask() & mask) == mask)
+            query.archetypes.push_back(archetype);
+    }
+    return query.archetypes;
+}
+
+void EntityManager::MoveEntity(Entity entity, Archetype& target)
+{
+    EntityRecord& record = m_records[entity.index];
+    Archetype& source = *record.archetype;
+
+    const std::size_t row = target.Allocate(entity);
+    target.CopyShared(row, source, record.row);
+
+    const Entity moved = source.Remove(record.row);
+    if (moved.IsValid())
+        m_records[moved.index].row = record.row;
+
+    record.archetype = &target;
+    record.row = row;
+}
@@ -0,0 +1,207 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Archetype.hpp"
+#include "Core/JobSystem.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class CommandBuffer;
+
+/**
+ * Archetype-based entity store.
+ *
+ * Entities with the same set of components share an Archetype, so queries match whole
+ * archetypes with one mask test and then walk their 16 KB chunks as plain arrays per
+ * component. Adding or removing a component moves the entity to the neighbouring archetype
+ * (the transitions are cached on the archetypes).
+ *
+ * Structural changes (create, destroy, add, remove) are not allowed while a query runs;
+ * record them in a CommandBuffer and play it back afterwards. Queries may write the
+ * components they iterate, and ParallelEach runs chunks across the job system.
+ */
+class EntityManager
+{
+public:
+    EntityManager();
+    ~EntityManager();
+
+    EntityManager(const EntityManager&) = delete;
+    EntityManager& operator=(const EntityManager&) = delete;
+
+    /**
+     * Create an entity with the given component values
+     */
+    template<typename... Ts>
+    Entity Create(const Ts&... components)
+    {
+        const ComponentId ids[] = {GetComponentId<Ts>()..., 0};
+        const void* data[] = {static_cast<const void*>(&components)..., nullptr};
+        return CreateFromData(GetComponentMask<Ts...>(), ids, data, sizeof...(Ts));
+    }
+
+    /**
+     * Destroy an entity; stale handles are ignored
+     */
+    void Destroy(Entity entity);
+
+    [[nodiscard]] bool IsAlive(Entity entity) const;
+
+    /**
+     * Add a component, or overwrite it if the entity already has one
+     */
+    template<typename T>
+    void Add(Entity entity, const T& component = T{})
+    {
+        AddComponent(entity, GetComponentId<T>(), &component);
+    }
+
+    template<typename T>
+    void Remove(Entity entity)
+    {
+        RemoveComponent(entity, GetComponentId<T>());
+    }
+
+    /**
+     * Get a component of an entity, or nullptr if it has none or is not alive. The pointer is
+     * valid until the next structural change.
+     */
+    template<typename T>
+    [[nodiscard]] T* Get(Entity entity)
+    {
+        return static_cast<T*>(GetComponent(entity, GetComponentId<T>()));
+    }
+
+    template<typename T>
+    [[nodiscard]] bool Has(Entity entity) const
+    {
+        return IsAlive(entity) && m_records[entity.index].archetype->Has(GetComponentId<T>());
+    }
+
+    /**
+     * Call func(count, entities, columns...) for every chunk holding all of Ts, where each
+     * column is a Ts* array of count elements
+     */
+    template<typename... Ts, typename Func>
+    void EachChunk(Func&& func)
+    {
+        for (Archetype* archetype : Match(GetComponentMask<Ts...>()))
+        {
+            for (std::size_t chunk = 0; chunk < archetype->GetChunkCount(); ++chunk)
+            {
+                func(archetype->GetChunkEntityCount(chunk), const_cast<const Entity*>(archetype->GetEntities(chunk)),
+                     archetype->GetColumn<std::remove_const_t<Ts>>(chunk)...);
+            }
+        }
+    }
+
+    /**
+     * Call func(Ts&...) or func(Entity, Ts&...) for every entity holding all of Ts
+     */
+    template<typename... Ts, typename Func>
+    void Each(Func&& func)
+    {
+        EachChunk<Ts...>([&](std::size_t count, const Entity* entities, std::remove_const_t<Ts>*... columns) {
+            RunChunk<Ts...>(func, count, entities, columns...);
+        });
+    }
+
+    /**
+     * Like Each, with chunks spread across the job system. func runs concurrently and must only
+     * write the components it is given; record structural changes into per-job command buffers.
+     */
+    template<typename... Ts, typename Func>
+    void ParallelEach(JobSystem& jobs, Func&& func)
+    {
+        struct ChunkRef
+        {
+            Archetype* archetype;
+            std::size_t chunk;
+        };
+        std::vector<ChunkRef> chunks;
+        for (Archetype* archetype : Match(GetComponentMask<Ts...>()))
+        {
+            for (std::size_t chunk = 0; chunk < archetype->GetChunkCount(); ++chunk)
+            {
+                chunks.push_back({archetype, chunk});
+            }
+        }
+
+        jobs.ParallelFor(chunks.size(), CHUNKS_PER_JOB, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                Archetype& archetype = *chunks[i].archetype;
+                RunChunk<Ts...>(func, archetype.GetChunkEntityCount(chunks[i].chunk),
+                                archetype.GetEntities(chunks[i].chunk),
+                                archetype.GetColumn<std::remove_const_t<Ts>>(chunks[i].chunk)...);
+            }
+        });
+    }
+
+    [[nodiscard]] std::size_t GetEntityCount() const { return m_entityCount; }
+    [[nodiscard]] std::size_t GetArchetypeCount() const { return m_archetypeList.size(); }
+
+private:
+    friend class CommandBuffer;
+
+    struct EntityRecord
+    {
+        Archetype* archetype = nullptr;
+        std::size_t row = 0;
+        std::uint32_t generation = 0;
+    };
+
+    /**
+     * Archetypes matching a query mask; new archetypes are checked once when the query
+     * next runs
+     */
+    struct QueryCache
+    {
+        std::vector<Archetype*> archetypes;
+        std::size_t checkedCount = 0;
+    };
+
+    static constexpr std::size_t CHUNKS_PER_JOB = 4;
+
+    std::vector<EntityRecord> m_records;
+    std::vector<std::uint32_t> m_freeIndices;
+    std::size_t m_entityCount;
+
+    std::unordered_map<ComponentMask, std::unique_ptr<Archetype>> m_archetypes;
+    std::vector<Archetype*> m_archetypeList;
+    std::unordered_map<ComponentMask, QueryCache> m_queries;
+
+    template<typename... Ts, typename Func>
+    static void RunChunk(Func& func, std::size_t count, const Entity* entities,
+                         std::remove_const_t<Ts>*... columns)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if constexpr (std::is_invocable_v<Func&, Entity, Ts&...>)
+                func(entities[i], columns[i]...);
+            else
+                func(columns[i]...);
+        }
+    }
+
+    Entity CreateFromData(ComponentMask mask, const ComponentId* ids, const void* const* data, std::size_t count);
+
+    void AddComponent(Entity entity, ComponentId id, const void* data);
+    void RemoveComponent(Entity entity, ComponentId id);
+    [[nodiscard]] void* GetComponent(Entity entity, ComponentId id);
+
+    Archetype& GetArchetype(ComponentMask mask);
+    const std::vector<Archetype*>& Match(ComponentMask mask);
+
+    /**
+     * Move an entity's row into another archetype, keeping the components both share
+     */
+    void MoveEntity(Entity entity, Archetype& target);
+};
@@ -0,0 +1,46 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Core/Math/Math.hpp"
+
+/**
+ * Axis-aligned bounding box in world (block) units
+ */
+struct AABB
+{
+    Vector3 min;
+    Vector3 max;
+
+    static AABB FromCenter(const Vector3& center, const Vector3& halfExtents)
+    {
+        return {center - halfExtents, center + halfExtents};
+    }
+
+    [[nodiscard]] Vector3 GetCenter() const { return (min + max) * 0.5f; }
+    [[nodiscard]] Vector3 GetHalfExtents() const { return (max - min) * 0.5f; }
+
+    [[nodiscard]] bool Intersects(const AABB& other) const
+    {
+        return min.x < other.max.x && max.x > other.min.x && min.y < other.max.y && max.y > other.min.y &&
+               min.z < other.max.z && max.z > other.min.z;
+    }
+
+    [[nodiscard]] AABB Translated(const Vector3& offset) const { return {min + offset, max + offset}; }
+
+    /**
+     * Smallest box containing this box at both ends of a motion
+     */
+    [[nodiscard]] AABB Swept(const Vector3& motion) const
+    {
+        return {Math::Min(min, min + motion), Math::Max(max, max + motion)};
+    }
+
+    /**
+     * Grow by margin on every side
+     */
+    [[nodiscard]] AABB Expanded(float margin) const
+    {
+        return {min - Vector3(margin), max + Vector3(margin)};
+    }
+};
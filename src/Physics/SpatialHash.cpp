@@ -0,0 +1,176 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "SpatialHash.hpp"
+
+#include <algorithm>
+
+namespace
+{
+int UnpackAxis(std::uint64_t key, int shift)
+{
+    // sign-extend the 21-bit field
+    const auto value = static_cast<std::uint32_t>((key >> shift) & 0x1FFFFF) << 11;
+    return static_cast<std::int32_t>(value) >> 11;
+}
+} // namespace
+
+SpatialHash::SpatialHash(float cellSize)
+    : m_cellSize(cellSize)
+    , m_inverseCellSize(1.0f / cellSize)
+    , m_cellCount(0)
+{
+}
+
+void SpatialHash::Build(const AABB* boxes, std::size_t count)
+{
+    m_boxes.assign(boxes, boxes + count);
+    m_ranges.resize(count);
+
+    std::size_t entryCount = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const CellRange range = GetCellRange(boxes[i]);
+        m_ranges[i] = range;
+        entryCount += static_cast<std::size_t>(range.max[0] - range.min[0] + 1) *
+                      static_cast<std::size_t>(range.max[1] - range.min[1] + 1) *
+                      static_cast<std::size_t>(range.max[2] - range.min[2] + 1);
+    }
+    ResizeTable(entryCount);
+
+    // count the boxes in each cell
+    for (const CellRange& range : m_ranges)
+    {
+        for (int y = range.min[1]; y <= range.max[1]; ++y)
+        {
+            for (int z = range.min[2]; z <= range.max[2]; ++z)
+            {
+                for (int x = range.min[0]; x <= range.max[0]; ++x)
+                {
+                    ++m_cellCounts[InsertCell(PackCell(x, y, z))];
+                }
+            }
+        }
+    }
+
+    std::uint32_t start = 0;
+    for (const std::uint32_t slot : m_cellSlots)
+    {
+        m_cellStarts[slot] = start;
+        start += m_cellCounts[slot];
+        m_cellCounts[slot] = 0;
+    }
+
+    // then place each box in its cells' runs
+    m_entries.resize(entryCount);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const CellRange& range = m_ranges[i];
+        for (int y = range.min[1]; y <= range.max[1]; ++y)
+        {
+            for (int z = range.min[2]; z <= range.max[2]; ++z)
+            {
+                for (int x = range.min[0]; x <= range.max[0]; ++x)
+                {
+                    const std::uint32_t slot = FindCell(PackCell(x, y, z));
+                    m_entries[m_cellStarts[slot] + m_cellCounts[slot]++] = static_cast<std::uint32_t>(i);
+                }
+            }
+        }
+    }
+}
+
+void SpatialHash::QueryRange(const AABB& range, std::vector<std::uint32_t>& out) const
+{
+    ForEachInRange(range, [&](std::uint32_t index) { out.push_back(index); });
+}
+
+void SpatialHash::QueryRadius(const Vector3& center, float radius, std::vector<std::uint32_t>& out) const
+{
+    const float radiusSquared = radius * radius;
+    ForEachInRange(AABB::FromCenter(center, Vector3(radius)), [&](std::uint32_t index) {
+        const AABB& box = m_boxes[index];
+        const Vector3 closest = Math::Min(Math::Max(center, box.min), box.max);
+        const Vector3 offset = closest - center;
+        if (offset.x * offset.x + offset.y * offset.y + offset.z * offset.z <= radiusSquared)
+            out.push_back(index);
+    });
+}
+
+void SpatialHash::QueryPairs(std::vector<std::pair<std::uint32_t, std::uint32_t>>& out) const
+{
+    for (const std::uint32_t slot : m_cellSlots)
+    {
+        const std::uint64_t key = m_cellKeys[slot];
+        const int cell[3] = {UnpackAxis(key, 42), UnpackAxis(key, 21), UnpackAxis(key, 0)};
+
+        const std::uint32_t begin = m_cellStarts[slot];
+        const std::uint32_t end = begin + m_cellCounts[slot];
+        for (std::uint32_t i = begin; i < end; ++i)
+        {
+            const std::uint32_t a = m_entries[i];
+            for (std::uint32_t j = i + 1; j < end; ++j)
+            {
+                const std::uint32_t b = m_entries[j];
+                if (m_boxes[a].Intersects(m_boxes[b]) && IsFirstSharedCell(cell, m_ranges[a], m_ranges[b]))
+                    out.emplace_back(std::min(a, b), std::max(a, b));
+            }
+        }
+    }
+}
+
+std::uint32_t SpatialHash::FindCell(std::uint64_t key) const
+{
+    const std::uint32_t mask = static_cast<std::uint32_t>(m_cellKeys.size() - 1);
+    for (std::uint32_t slot = HashCell(key) & mask;; slot = (slot + 1) & mask)
+    {
+        if (m_cellKeys[slot] == key)
+            return slot;
+        if (m_cellKeys[slot] == EMPTY_KEY)
+            return EMPTY;
+    }
+}
+
+std::uint32_t SpatialHash::InsertCell(std::uint64_t key)
+{
+    const std::uint32_t mask = static_cast<std::uint32_t>(m_cellKeys.size() - 1);
+    std::uint32_t slot = HashCell(key) & mask;
+    while (m_cellKeys[slot] != key)
+    {
+        if (m_cellKeys[slot] == EMPTY_KEY)
+        {
+            m_cellKeys[slot] = key;
+            m_cellCounts[slot] = 0;
+            m_cellSlots.push_back(slot);
+            ++m_cellCount;
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+void SpatialHash::ResizeTable(std::size_t cellEstimate)
+{
+    // there are never more cells than entries, so this keeps the table at most half full;
+    // it only grows, so a crowd size hovering around a power of two does not reallocate
+    std::size_t capacity = std::max<std::size_t>(m_cellKeys.size(), 16);
+    while (capacity < cellEstimate * 2)
+        capacity *= 2;
+
+    if (capacity != m_cellKeys.size())
+    {
+        m_cellKeys.assign(capacity, EMPTY_KEY);
+        m_cellStarts.resize(capacity);
+        m_cellCounts.resize(capacity);
+    }
+    else
+    {
+        // only the slots used last build need clearing
+        for (const std::uint32_t slot : m_cellSlots)
+            m_cellKeys[slot] = EMPTY_KEY;
+    }
+    m_cellSlots.clear();
+    m_cellCount = 0;
+}
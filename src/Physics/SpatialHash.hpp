@@ -0,0 +1,155 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "AABB.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * Uniform grid broadphase for entity boxes.
+ *
+ * Build sorts box indices into grid cells with a counting sort: cells live in an open
+ * addressing table (linear probing over flat arrays) that points at a contiguous run of
+ * indices, so there is no per-cell allocation and a rebuild reuses last tick's memory.
+ * A box overlapping several cells is listed in each, and queries report it once by only
+ * accepting it in the first cell both ranges share.
+ *
+ * Rebuild once per fixed tick after bodies move. Queries are const and can run in parallel.
+ */
+class SpatialHash
+{
+public:
+    /**
+     * @param cellSize Edge of a grid cell in blocks; about twice the typical entity size works well
+     */
+    explicit SpatialHash(float cellSize = 4.0f);
+
+    /**
+     * Replace the contents with boxes[0..count), identified by their index
+     */
+    void Build(const AABB* boxes, std::size_t count);
+
+    /**
+     * Append the indices of boxes intersecting a range to out
+     */
+    void QueryRange(const AABB& range, std::vector<std::uint32_t>& out) const;
+
+    /**
+     * Append the indices of boxes within radius of a point (tested against the closest point
+     * of each box) to out
+     */
+    void QueryRadius(const Vector3& center, float radius, std::vector<std::uint32_t>& out) const;
+
+    /**
+     * Append every intersecting pair (a < b) to out
+     */
+    void QueryPairs(std::vector<std::pair<std::uint32_t, std::uint32_t>>& out) const;
+
+    /**
+     * Call func(index) for each box intersecting a range, without collecting them
+     */
+    template<typename Func>
+    void ForEachInRange(const AABB& range, Func&& func) const
+    {
+        if (m_boxes.empty())
+            return;
+
+        const CellRange cells = GetCellRange(range);
+        for (int y = cells.min[1]; y <= cells.max[1]; ++y)
+        {
+            for (int z = cells.min[2]; z <= cells.max[2]; ++z)
+            {
+                for (int x = cells.min[0]; x <= cells.max[0]; ++x)
+                {
+                    const std::uint32_t slot = FindCell(PackCell(x, y, z));
+                    if (slot == EMPTY)
+                        continue;
+
+                    const int cell[3] = {x, y, z};
+                    for (std::uint32_t i = m_cellStarts[slot]; i < m_cellStarts[slot] + m_cellCounts[slot]; ++i)
+                    {
+                        const std::uint32_t index = m_entries[i];
+                        if (IsFirstSharedCell(cell, cells, m_ranges[index]) && m_boxes[index].Intersects(range))
+                            func(index);
+                    }
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] float GetCellSize() const { return m_cellSize; }
+    [[nodiscard]] std::size_t GetBoxCount() const { return m_boxes.size(); }
+    [[nodiscard]] std::size_t GetCellCount() const { return m_cellCount; }
+    [[nodiscard]] std::size_t GetEntryCount() const { return m_entries.size(); }
+
+private:
+    struct CellRange
+    {
+        int min[3];
+        int max[3];
+    };
+
+    static constexpr std::uint32_t EMPTY = 0xFFFFFFFF;
+    static constexpr std::uint64_t EMPTY_KEY = ~std::uint64_t{0};
+
+    float m_cellSize;
+    float m_inverseCellSize;
+
+    std::vector<AABB> m_boxes;
+    std::vector<CellRange> m_ranges;
+
+    // open addressing table, capacity a power of two kept under half full
+    std::vector<std::uint64_t> m_cellKeys;
+    std::vector<std::uint32_t> m_cellStarts;
+    std::vector<std::uint32_t> m_cellCounts;
+    std::vector<std::uint32_t> m_cellSlots; // occupied slots in insertion order
+    std::size_t m_cellCount;
+
+    // box indices grouped by cell
+    std::vector<std::uint32_t> m_entries;
+
+    [[nodiscard]] CellRange GetCellRange(const AABB& box) const
+    {
+        return {{static_cast<int>(std::floor(box.min.x * m_inverseCellSize)),
+                 static_cast<int>(std::floor(box.min.y * m_inverseCellSize)),
+                 static_cast<int>(std::floor(box.min.z * m_inverseCellSize))},
+                {static_cast<int>(std::floor(box.max.x * m_inverseCellSize)),
+                 static_cast<int>(std::floor(box.max.y * m_inverseCellSize)),
+                 static_cast<int>(std::floor(box.max.z * m_inverseCellSize))}};
+    }
+
+    /**
+     * Whether cell is the lowest cell of the overlap of two cell ranges, so a pair seen in
+     * several cells is handled in exactly one
+     */
+    static bool IsFirstSharedCell(const int cell[3], const CellRange& a, const CellRange& b)
+    {
+        return cell[0] == (a.min[0] > b.min[0] ? a.min[0] : b.min[0]) &&
+               cell[1] == (a.min[1] > b.min[1] ? a.min[1] : b.min[1]) &&
+               cell[2] == (a.min[2] > b.min[2] ? a.min[2] : b.min[2]);
+    }
+
+    static std::uint64_t PackCell(int x, int y, int z)
+    {
+        // 21 bits per axis covers +-1M cells
+        return (static_cast<std::uint64_t>(x & 0x1FFFFF) << 42) | (static_cast<std::uint64_t>(y & 0x1FFFFF) << 21) |
+               static_cast<std::uint64_t>(z & 0x1FFFFF);
+    }
+
+    static std::uint32_t HashCell(std::uint64_t key)
+    {
+        key ^= key >> 33;
+        key *= 0xFF51AFD7ED558CCDull;
+        key ^= key >> 33;
+        return static_cast<std::uint32_t>(key);
+    }
+
+    [[nodiscard]] std::uint32_t FindCell(std::uint64_t key) const;
+    std::uint32_t InsertCell(std::uint64_t key);
+    void ResizeTable(std::size_t cellEstimate);
+};
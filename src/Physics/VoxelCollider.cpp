@@ -0,0 +1,225 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "VoxelCollider.hpp"
+
+#include "Core/JobSystem.hpp"
+#include "World/World.hpp"
+
+#include <cmath>
+
+namespace
+{
+// keeps resting boxes a hair away from faces so float error never counts as overlap
+constexpr float SKIN = 1e-4f;
+
+constexpr std::size_t BODIES_PER_JOB = 64;
+
+/**
+ * Index range of the blocks overlapping the open interval (min, max)
+ */
+void BlockRange(float min, float max, int& first, int& last)
+{
+    first = static_cast<int>(std::floor(min + SKIN));
+    last = static_cast<int>(std::ceil(max - SKIN)) - 1;
+}
+} // namespace
+
+/**
+ * Solid block lookups that keep the last chunk so neighbouring reads skip the hash map
+ */
+class VoxelCollider::BlockReader
+{
+public:
+    BlockReader(const World& world, const BlockRegistry& registry)
+        : m_world(world)
+        , m_registry(registry)
+        , m_chunk(nullptr)
+        , m_coord{0, -1, 0}
+    {
+    }
+
+    bool IsSolid(int x, int y, int z)
+    {
+        if (y < 0)
+            return true;
+        if (y >= WORLD_HEIGHT)
+            return false;
+
+        const ChunkCoord coord = BlockToChunkCoord(x, y, z);
+        if (coord != m_coord)
+        {
+            m_coord = coord;
+            m_chunk = m_world.GetChunk(coord);
+        }
+        return m_chunk && m_registry.IsSolid(m_chunk->GetBlock(BlockToLocal(x), BlockToLocal(y), BlockToLocal(z)));
+    }
+
+private:
+    const World& m_world;
+    const BlockRegistry& m_registry;
+    const Chunk* m_chunk;
+    ChunkCoord m_coord;
+};
+
+VoxelCollider::VoxelCollider(const World& world, const BlockRegistry& registry)
+    : m_world(world)
+    , m_registry(registry)
+{
+}
+
+float VoxelCollider::ClipAxis(BlockReader& reader, const AABB& box, int axis, float delta) const
+{
+    if (delta == 0.0f)
+        return 0.0f;
+
+    const int u = (axis + 1) % 3;
+    const int v = (axis + 2) % 3;
+    int firstU, lastU, firstV, lastV;
+    BlockRange(box.min[u], box.max[u], firstU, lastU);
+    BlockRange(box.min[v], box.max[v], firstV, lastV);
+
+    // layers the leading face passes through, nearest first; blocks the box already
+    // overlaps are ignored so a stuck body can still move out
+    const bool positive = delta > 0.0f;
+    const float face = positive ? box.max[axis] : box.min[axis];
+    const int first = positive ? static_cast<int>(std::ceil(face - SKIN))
+                               : static_cast<int>(std::floor(face + SKIN)) - 1;
+    const int last = static_cast<int>(std::floor(face + delta));
+    const int step = positive ? 1 : -1;
+
+    int cell[3];
+    for (int layer = first; positive ? layer <= last : layer >= last; layer += step)
+    {
+        cell[axis] = layer;
+        for (int a = firstU; a <= lastU; ++a)
+        {
+            cell[u] = a;
+            for (int b = firstV; b <= lastV; ++b)
+            {
+                cell[v] = b;
+                if (!reader.IsSolid(cell[0], cell[1], cell[2]))
+                    continue;
+
+                const float limit = positive ? static_cast<float>(layer) - face - SKIN
+                                             : static_cast<float>(layer + 1) - face + SKIN;
+                return positive ? std::max(0.0f, std::min(delta, limit)) : std::min(0.0f, std::max(delta, limit));
+            }
+        }
+    }
+    return delta;
+}
+
+CollisionResult VoxelCollider::Move(AABB& box, const Vector3& motion, float stepHeight) const
+{
+    BlockReader reader(m_world, m_registry);
+    CollisionResult result;
+
+    AABB moved = box;
+    Vector3 applied;
+    for (const int axis : {1, 0, 2})
+    {
+        applied[axis] = ClipAxis(reader, moved, axis, motion[axis]);
+        moved.min[axis] += applied[axis];
+        moved.max[axis] += applied[axis];
+    }
+
+    result.hitX = applied.x != motion.x;
+    result.hitY = applied.y != motion.y;
+    result.hitZ = applied.z != motion.z;
+    result.onGround = motion.y < 0.0f && result.hitY;
+
+    // blocked sideways on the ground: retry from stepHeight up and keep it if it got further
+    if (stepHeight > 0.0f && result.onGround && (result.hitX || result.hitZ))
+    {
+        AABB raised = box;
+        const float rise = ClipAxis(reader, raised, 1, stepHeight);
+        raised.min.y += rise;
+        raised.max.y += rise;
+
+        Vector3 stepped(0.0f, rise, 0.0f);
+        for (const int axis : {0, 2})
+        {
+            stepped[axis] = ClipAxis(reader, raised, axis, motion[axis]);
+            raised.min[axis] += stepped[axis];
+            raised.max[axis] += stepped[axis];
+        }
+
+        const float drop = ClipAxis(reader, raised, 1, -rise + std::min(motion.y, 0.0f));
+        raised.min.y += drop;
+        raised.max.y += drop;
+        stepped.y += drop;
+
+        const float flatDistance = applied.x * applied.x + applied.z * applied.z;
+        const float stepDistance = stepped.x * stepped.x + stepped.z * stepped.z;
+        if (stepDistance > flatDistance + SKIN)
+        {
+            moved = raised;
+            applied = stepped;
+            result.hitX = stepped.x != motion.x;
+            result.hitZ = stepped.z != motion.z;
+            result.stepped = true;
+        }
+    }
+
+    box = moved;
+    result.motion = applied;
+    return result;
+}
+
+bool VoxelCollider::IsOnGround(const AABB& box) const
+{
+    BlockReader reader(m_world, m_registry);
+    return ClipAxis(reader, box, 1, -2.0f * SKIN) > -2.0f * SKIN;
+}
+
+bool VoxelCollider::Overlaps(const AABB& box) const
+{
+    BlockReader reader(m_world, m_registry);
+    int first[3], last[3];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        BlockRange(box.min[axis], box.max[axis], first[axis], last[axis]);
+    }
+
+    for (int y = first[1]; y <= last[1]; ++y)
+    {
+        for (int z = first[2]; z <= last[2]; ++z)
+        {
+            for (int x = first[0]; x <= last[0]; ++x)
+            {
+                if (reader.IsSolid(x, y, z))
+                    return true;
+            }
+        }
+    }
+    return false;
+}
+
+void VoxelCollider::Step(PhysicsBody* bodies, std::size_t count, float deltaTime, const Vector3& gravity) const
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        PhysicsBody& body = bodies[i];
+        body.velocity += gravity * deltaTime;
+
+        const CollisionResult result =
+            Move(body.box, body.velocity * deltaTime, body.onGround ? body.stepHeight : 0.0f);
+        if (result.hitX)
+            body.velocity.x = 0.0f;
+        if (result.hitY)
+            body.velocity.y = 0.0f;
+        if (result.hitZ)
+            body.velocity.z = 0.0f;
+        body.onGround = result.onGround;
+    }
+}
+
+void VoxelCollider::StepParallel(JobSystem& jobs, PhysicsBody* bodies, std::size_t count, float deltaTime,
+                                 const Vector3& gravity) const
+{
+    jobs.ParallelFor(count, BODIES_PER_JOB, [&](std::size_t begin, std::size_t end) {
+        Step(bodies + begin, end - begin, deltaTime, gravity);
+    });
+}
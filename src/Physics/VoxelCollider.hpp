@@ -0,0 +1,92 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "AABB.hpp"
+#include "World/BlockRegistry.hpp"
+
+#include <cstddef>
+
+class JobSystem;
+class World;
+
+/**
+ * Outcome of moving a box through the world
+ */
+struct CollisionResult
+{
+    Vector3 motion; // motion actually applied
+    bool hitX = false;
+    bool hitY = false;
+    bool hitZ = false;
+    bool onGround = false; // stopped while moving down
+    bool stepped = false; // climbed a ledge of at most the step height
+};
+
+/**
+ * A box moved by velocity and gravity, e.g. a player or a mob
+ */
+struct PhysicsBody
+{
+    AABB box;
+    Vector3 velocity;
+    float stepHeight = 0.6f;
+    bool onGround = false;
+};
+
+/**
+ * Swept AABB collision against the solid blocks of the world.
+ *
+ * Motion is resolved one axis at a time (Y, then X, then Z). Each axis walks the layers of
+ * blocks the box sweeps through, nearest first, and stops at the first layer with a solid
+ * block under the box's footprint, so only blocks inside the swept volume are read and a
+ * free move reads a single layer per axis. Blocks are read through a cached chunk pointer
+ * and nothing is allocated, so bodies can be moved in parallel while the world is not edited.
+ *
+ * Blocks below the world count as solid; missing chunks are air, as in World::GetBlock.
+ */
+class VoxelCollider
+{
+public:
+    VoxelCollider(const World& world, const BlockRegistry& registry);
+
+    /**
+     * Move a box as far as it can go along motion, sliding along the blocks it touches
+     * @param stepHeight Ledges up to this height are climbed when a horizontal move is
+     *        blocked; 0 disables stepping
+     */
+    CollisionResult Move(AABB& box, const Vector3& motion, float stepHeight = 0.0f) const;
+
+    /**
+     * Check whether the box rests on a solid block
+     */
+    [[nodiscard]] bool IsOnGround(const AABB& box) const;
+
+    /**
+     * Check whether the box overlaps any solid block
+     */
+    [[nodiscard]] bool Overlaps(const AABB& box) const;
+
+    /**
+     * Apply gravity and velocity to bodies for one fixed step. Blocked velocity components
+     * are zeroed, and bodies on the ground may step up ledges.
+     */
+    void Step(PhysicsBody* bodies, std::size_t count, float deltaTime, const Vector3& gravity) const;
+
+    /**
+     * Step bodies in parallel across the job system
+     */
+    void StepParallel(JobSystem& jobs, PhysicsBody* bodies, std::size_t count, float deltaTime,
+                      const Vector3& gravity) const;
+
+private:
+    class BlockReader;
+
+    const World& m_world;
+    const BlockRegistry& m_registry;
+
+    /**
+     * Clip a motion along one axis against the first solid layer in its way
+     */
+    float ClipAxis(BlockReader& reader, const AABB& box, int axis, float delta) const;
+};
@@ -0,0 +1,612 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "ChunkMesher.hpp"
+
+#include "World/World.hpp"
+
+#include <array>
+#include <iostream>
+
+namespace
+{
+/**
+ * Axes of each face in the same order as the lighting directions (+X, -X, +Y, -Y, +Z, -Z).
+ * u x v always points along the face normal, so corners listed (0,0), (1,0), (1,1), (0,1)
+ * in (u, v) are counter-clockwise when seen from outside.
+ */
+struct FaceAxes
+{
+    int axis;
+    int u;
+    int v;
+    int sign;
+};
+
+constexpr FaceAxes FACES[6] = {
+    {0, 1, 2, 1}, {0, 2, 1, -1}, {1, 2, 0, 1}, {1, 0, 2, -1}, {2, 0, 1, 1}, {2, 1, 0, -1},
+};
+
+constexpr int CORNERS[4][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+
+constexpr int LIGHT_SHIFT = 16;
+constexpr int AO_SHIFT = 48;
+
+/**
+ * Padded-index offsets of the three cells that shade one corner of a face, relative to
+ * the cell in front of the face: the two edge neighbours and the diagonal between them
+ */
+struct CornerOffsets
+{
+    int side1;
+    int side2;
+    int diagonal;
+};
+
+struct FaceOffsets
+{
+    int normal;
+    CornerOffsets corners[4];
+};
+
+constexpr int PaddedOffset(const int offset[3])
+{
+    return ChunkMeshInput::Index(offset[0], offset[1], offset[2]) - ChunkMeshInput::Index(0, 0, 0);
+}
+
+constexpr std::array<FaceOffsets, 6> BuildFaceOffsets()
+{
+    std::array<FaceOffsets, 6> table{};
+    for (int face = 0; face < 6; ++face)
+    {
+        const FaceAxes& axes = FACES[face];
+
+        int normal[3] = {0, 0, 0};
+        normal[axes.axis] = axes.sign;
+        table[face].normal = PaddedOffset(normal);
+
+        for (int corner = 0; corner < 4; ++corner)
+        {
+            int du[3] = {0, 0, 0};
+            int dv[3] = {0, 0, 0};
+            int dd[3] = {0, 0, 0};
+            du[axes.u] = CORNERS[corner][0] ? 1 : -1;
+            dv[axes.v] = CORNERS[corner][1] ? 1 : -1;
+            dd[axes.u] = du[axes.u];
+            dd[axes.v] = dv[axes.v];
+
+            table[face].corners[corner] = {PaddedOffset(du), PaddedOffset(dv), PaddedOffset(dd)};
+        }
+    }
+    return table;
+}
+
+constexpr std::array<FaceOffsets, 6> FACE_OFFSETS = BuildFaceOffsets();
+
+/**
+ * Classic voxel AO: 3 is fully lit, 0 is a corner enclosed by both edge neighbours
+ */
+constexpr std::uint8_t CornerAO(bool side1, bool side2, bool diagonal)
+{
+    if (side1 && side2)
+        return 0;
+    return static_cast<std::uint8_t>(3 - (side1 + side2 + diagonal));
+}
+
+std::uint8_t AverageLight(const std::uint8_t* samples, int count)
+{
+    int sky = 0;
+    int block = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        sky += samples[i] >> 4;
+        block += samples[i] & 0x0F;
+    }
+    const int half = count / 2;
+    return static_cast<std::uint8_t>((((sky + half) / count) << 4) | ((block + half) / count));
+}
+
+/**
+ * AO and smooth light of every corner of the face in front of the given padded cell
+ */
+void ShadeCorners(const ChunkMeshInput& input, const BlockRegistry& registry, const FaceOffsets& offsets,
+                  int adjacent, std::uint8_t light[4], std::uint8_t ao[4])
+{
+    for (int corner = 0; corner < 4; ++corner)
+    {
+        const CornerOffsets& corners = offsets.corners[corner];
+        const int side1 = adjacent + corners.side1;
+        const int side2 = adjacent + corners.side2;
+        const int diagonal = adjacent + corners.diagonal;
+
+        const bool side1Opaque = registry.IsOpaque(input.blocks[side1]);
+        const bool side2Opaque = registry.IsOpaque(input.blocks[side2]);
+        const bool diagonalOpaque = registry.IsOpaque(input.blocks[diagonal]);
+        ao[corner] = CornerAO(side1Opaque, side2Opaque, diagonalOpaque);
+
+        // light leaks through the diagonal only when one of the edges is open
+        std::uint8_t samples[4];
+        int count = 0;
+        samples[count++] = input.light[adjacent];
+        if (!side1Opaque)
+            samples[count++] = input.light[side1];
+        if (!side2Opaque)
+            samples[count++] = input.light[side2];
+        if (!diagonalOpaque && !(side1Opaque && side2Opaque))
+            samples[count++] = input.light[diagonal];
+        light[corner] = AverageLight(samples, count);
+    }
+}
+
+bool IsFaceVisible(const BlockRegistry& registry, BlockId block, BlockId adjacent)
+{
+    return block != BLOCK_AIR && adjacent != block && !registry.IsOpaque(adjacent);
+}
+
+/**
+ * Greedily merge a slice mask of merge keys (0 = no face) into quads, growing each
+ * rectangle first along u then along v. Cells are scale blocks wide.
+ */
+void EmitQuads(const BlockRegistry& registry, std::uint64_t* mask, int size, int scale, int face, int slice,
+               ChunkMesh& mesh)
+{
+    const FaceAxes& axes = FACES[face];
+
+    for (int j = 0; j < size; ++j)
+    {
+        for (int i = 0; i < size;)
+        {
+            const std::uint64_t key = mask[i + j * size];
+            if (key == 0)
+            {
+                ++i;
+                continue;
+            }
+
+            int width = 1;
+            while (i + width < size && mask[i + width + j * size] == key)
+            {
+                ++width;
+            }
+
+            int height = 1;
+            for (; j + height < size; ++height)
+            {
+                bool rowMatches = true;
+                for (int k = 0; k < width && rowMatches; ++k)
+                {
+                    rowMatches = mask[i + k + (j + height) * size] == key;
+                }
+                if (!rowMatches)
+                    break;
+            }
+
+            std::uint8_t ao[4];
+            const auto baseIndex = static_cast<std::uint32_t>(mesh.vertices.size());
+            for (int corner = 0; corner < 4; ++corner)
+            {
+                int pos[3];
+                pos[axes.axis] = (slice + (axes.sign > 0 ? 1 : 0)) * scale;
+                pos[axes.u] = (i + CORNERS[corner][0] * width) * scale;
+                pos[axes.v] = (j + CORNERS[corner][1] * height) * scale;
+                ao[corner] = static_cast<std::uint8_t>((key >> (AO_SHIFT + corner * 2)) & 0x3);
+
+                ChunkVertex vertex{};
+                vertex.x = static_cast<std::uint8_t>(pos[0]);
+                vertex.y = static_cast<std::uint8_t>(pos[1]);
+                vertex.z = static_cast<std::uint8_t>(pos[2]);
+                vertex.face = static_cast<std::uint8_t>(face);
+                vertex.light = static_cast<std::uint8_t>(key >> (LIGHT_SHIFT + corner * 8));
+                vertex.ao = ao[corner];
+                vertex.texture = registry.GetFaceTexture(static_cast<BlockId>(key & 0xFFFF), face);
+                mesh.vertices.push_back(vertex);
+            }
+
+            // split along the brighter diagonal so AO interpolates without a visible seam
+            static constexpr std::uint32_t REGULAR[6] = {0, 1, 2, 0, 2, 3};
+            static constexpr std::uint32_t FLIPPED[6] = {1, 2, 3, 1, 3, 0};
+            const auto& order = ao[0] + ao[2] < ao[1] + ao[3] ? FLIPPED : REGULAR;
+            for (const std::uint32_t offset : order)
+            {
+                mesh.indices.push_back(baseIndex + offset);
+            }
+
+            for (int dj = 0; dj < height; ++dj)
+            {
+                for (int di = 0; di < width; ++di)
+                {
+                    mask[i + di + (j + dj) * size] = 0;
+                }
+            }
+            i += width;
+        }
+    }
+}
+} // namespace
+
+ChunkMesher::ChunkMesher(const BlockRegistry& registry)
+    : m_registry(registry)
+{
+}
+
+void ChunkMesher::GatherInput(const World& world, const ChunkCoord& coord, ChunkMeshInput& input)
+{
+    input.coord = coord;
+
+    // the 27 chunks the padded volume can touch, looked up once
+    std::array<const Chunk*, 27> neighbors{};
+    for (int dy = -1; dy <= 1; ++dy)
+    {
+        for (int dz = -1; dz <= 1; ++dz)
+        {
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                neighbors[(dx + 1) + (dz + 1) * 3 + (dy + 1) * 9] =
+                    world.GetChunk({coord.x + dx, coord.y + dy, coord.z + dz});
+            }
+        }
+    }
+
+    auto split = [](int local, int& offset) {
+        offset = local < 0 ? -1 : local >= Chunk::SIZE ? 1 : 0;
+        return local - offset * Chunk::SIZE;
+    };
+
+    for (int y = -1; y <= Chunk::SIZE; ++y)
+    {
+        // below the world there is nothing to look at; mirroring the bottom layer hides those faces
+        const int sampleY = coord.y == 0 && y < 0 ? 0 : y;
+        for (int z = -1; z <= Chunk::SIZE; ++z)
+        {
+            for (int x = -1; x <= Chunk::SIZE; ++x)
+            {
+                int ox, oy, oz;
+                const int lx = split(x, ox);
+                const int ly = split(sampleY, oy);
+                const int lz = split(z, oz);
+
+                const int index = ChunkMeshInput::Index(x, y, z);
+                const Chunk* chunk = neighbors[(ox + 1) + (oz + 1) * 3 + (oy + 1) * 9];
+                if (!chunk)
+                {
+                    // missing chunks are air under open sky
+                    input.blocks[index] = BLOCK_AIR;
+                    input.light[index] = BlockRegistry::MAX_LIGHT << 4;
+                    continue;
+                }
+
+                const int chunkIndex = Chunk::Index(lx, ly, lz);
+                input.blocks[index] = chunk->GetBlock(chunkIndex);
+                input.light[index] = static_cast<std::uint8_t>(
+                    (chunk->GetSkyLight(chunkIndex) << 4) | chunk->GetBlockLight(chunkIndex));
+            }
+        }
+    }
+}
+
+void ChunkMesher::Mesh(const ChunkMeshInput& input, ChunkMesh& mesh) const
+{
+    mesh.Clear();
+    mesh.coord = input.coord;
+
+    std::array<std::uint64_t, Chunk::AREA> mask{};
+
+    for (int face = 0; face < 6; ++face)
+    {
+        const FaceAxes& axes = FACES[face];
+        const FaceOffsets& offsets = FACE_OFFSETS[face];
+
+        for (int slice = 0; slice < Chunk::SIZE; ++slice)
+        {
+            // 1. collect the visible faces of this slice, keyed by everything that must match
+            //    for two faces to merge: block, per-corner light and per-corner AO
+            for (int j = 0; j < Chunk::SIZE; ++j)
+            {
+                for (int i = 0; i < Chunk::SIZE; ++i)
+                {
+                    int pos[3];
+                    pos[axes.axis] = slice;
+                    pos[axes.u] = i;
+                    pos[axes.v] = j;
+
+                    const int index = ChunkMeshInput::Index(pos[0], pos[1], pos[2]);
+                    const int adjacent = index + offsets.normal;
+                    const BlockId block = input.blocks[index];
+                    if (!IsFaceVisible(m_registry, block, input.blocks[adjacent]))
+                    {
+                        mask[i + j * Chunk::SIZE] = 0;
+                        continue;
+                    }
+
+                    std::uint8_t light[4];
+                    std::uint8_t ao[4];
+                    ShadeCorners(input, m_registry, offsets, adjacent, light, ao);
+
+                    std::uint64_t key = block;
+                    for (int corner = 0; corner < 4; ++corner)
+                    {
+                        key |= static_cast<std::uint64_t>(light[corner]) << (LIGHT_SHIFT + corner * 8);
+                        key |= static_cast<std::uint64_t>(ao[corner]) << (AO_SHIFT + corner * 2);
+                    }
+                    mask[i + j * Chunk::SIZE] = key;
+                }
+            }
+
+            // 2. greedily grow rectangles of identical keys
+            EmitQuads(m_registry, mask.data(), Chunk::SIZE, 1, face, slice, mesh);
+        }
+    }
+}
+
+void ChunkMesher::GatherLodInput(const LodStore& store, const ChunkCoord& coord, int level,
+                                 LodMeshInput& input) const
+{
+    const int size = ChunkLod::GetSize(level);
+    const int padded = size + 2;
+    input.coord = coord;
+    input.level = level;
+    input.size = size;
+    input.blocks.assign(static_cast<std::size_t>(padded) * padded * padded, BLOCK_AIR);
+    input.light.assign(input.blocks.size(), 0);
+
+    std::array<const ChunkLod*, 27> neighbors{};
+    for (int dy = -1; dy <= 1; ++dy)
+    {
+        for (int dz = -1; dz <= 1; ++dz)
+        {
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                neighbors[(dx + 1) + (dz + 1) * 3 + (dy + 1) * 9] =
+                    store.Get({coord.x + dx, coord.y + dy, coord.z + dz});
+            }
+        }
+    }
+
+    auto split = [size](int local, int& offset) {
+        offset = local < 0 ? -1 : local >= size ? 1 : 0;
+        return local - offset * size;
+    };
+
+    for (int y = -1; y <= size; ++y)
+    {
+        const int sampleY = coord.y == 0 && y < 0 ? 0 : y;
+        for (int z = -1; z <= size; ++z)
+        {
+            for (int x = -1; x <= size; ++x)
+            {
+                int ox, oy, oz;
+                const int lx = split(x, ox);
+                const int ly = split(sampleY, oy);
+                const int lz = split(z, oz);
+
+                if (const ChunkLod* lod = neighbors[(ox + 1) + (oz + 1) * 3 + (oy + 1) * 9])
+                {
+                    input.blocks[input.Index(x, y, z)] = lod->GetBlock(level, lx, ly, lz);
+                }
+            }
+        }
+    }
+
+    // sky light falls straight down; anything opaque above the padded volume shadows the column
+    for (int z = -1; z <= size; ++z)
+    {
+        for (int x = -1; x <= size; ++x)
+        {
+            int ox, oz;
+            const int lx = split(x, ox);
+            const int lz = split(z, oz);
+
+            std::uint8_t sky = BlockRegistry::MAX_LIGHT;
+            for (int chunkY = WORLD_HEIGHT_CHUNKS - 1; chunkY > coord.y + 1 && sky > 0; --chunkY)
+            {
+                const ChunkLod* lod = store.Get({coord.x + ox, chunkY, coord.z + oz});
+                for (int ly = 0; lod && ly < size && sky > 0; ++ly)
+                {
+                    if (m_registry.IsOpaque(lod->GetBlock(level, lx, ly, lz)))
+                        sky = 0;
+                }
+            }
+
+            for (int y = size; y >= -1; --y)
+            {
+                const int index = input.Index(x, y, z);
+                if (m_registry.IsOpaque(input.blocks[index]))
+                    sky = 0;
+                input.light[index] = static_cast<std::uint8_t>(sky << 4);
+            }
+        }
+    }
+}
+
+void ChunkMesher::MeshLod(const LodMeshInput& input, std::uint8_t seamFaces, ChunkMesh& mesh) const
+{
+    mesh.Clear();
+    mesh.coord = input.coord;
+
+    const int size = input.size;
+    const int scale = 1 << input.level;
+    std::vector<std::uint64_t> mask(static_cast<std::size_t>(size) * size);
+
+    // coarse faces are flat shaded: every corner gets the light of the cell in front and full AO
+    constexpr std::uint64_t NO_OCCLUSION = std::uint64_t{0xFF} << AO_SHIFT;
+
+    for (int face = 0; face < 6; ++face)
+    {
+        const FaceAxes& axes = FACES[face];
+        const bool seam = (seamFaces >> face) & 1;
+
+        for (int slice = 0; slice < size; ++slice)
+        {
+            const bool borderSlice = axes.sign > 0 ? slice == size - 1 : slice == 0;
+
+            for (int j = 0; j < size; ++j)
+            {
+                for (int i = 0; i < size; ++i)
+                {
+                    int pos[3];
+                    pos[axes.axis] = slice;
+                    pos[axes.u] = i;
+                    pos[axes.v] = j;
+
+                    const BlockId block = input.blocks[input.Index(pos[0], pos[1], pos[2])];
+                    pos[axes.axis] += axes.sign;
+                    const int adjacent = input.Index(pos[0], pos[1], pos[2]);
+
+                    std::uint8_t light = input.light[adjacent];
+                    bool visible = IsFaceVisible(m_registry, block, input.blocks[adjacent]);
+                    if (!visible && seam && borderSlice && block != BLOCK_AIR)
+                    {
+                        // skirt over the step to a neighbour of another level
+                        visible = true;
+                        light = BlockRegistry::MAX_LIGHT << 4;
+                    }
+
+                    if (!visible)
+                    {
+                        mask[i + j * size] = 0;
+                        continue;
+                    }
+
+                    std::uint64_t key = block | NO_OCCLUSION;
+                    for (int corner = 0; corner < 4; ++corner)
+                    {
+                        key |= static_cast<std::uint64_t>(light) << (LIGHT_SHIFT + corner * 8);
+                    }
+                    mask[i + j * size] = key;
+                }
+            }
+
+            EmitQuads(m_registry, mask.data(), size, scale, face, slice, mesh);
+        }
+    }
+}
+
+bool ChunkMesher::Validate(const ChunkMeshInput& input, const ChunkMesh& mesh) const
+{
+    struct ExpectedFace
+    {
+        bool visible = false;
+        bool covered = false;
+        BlockId block = BLOCK_AIR;
+        std::uint8_t light[4]{};
+        std::uint8_t ao[4]{};
+    };
+
+    auto opaqueAt = [&](int x, int y, int z) {
+        return m_registry.IsOpaque(input.blocks[ChunkMeshInput::Index(x, y, z)]);
+    };
+    auto lightAt = [&](int x, int y, int z) { return input.light[ChunkMeshInput::Index(x, y, z)]; };
+
+    // brute force: shade every face of every block from coordinates, independent of the
+    // offset table and the greedy merge
+    std::vector<ExpectedFace> expected(6 * Chunk::VOLUME);
+    for (int face = 0; face < 6; ++face)
+    {
+        const FaceAxes& axes = FACES[face];
+        for (int y = 0; y < Chunk::SIZE; ++y)
+        {
+            for (int z = 0; z < Chunk::SIZE; ++z)
+            {
+                for (int x = 0; x < Chunk::SIZE; ++x)
+                {
+                    int adjacent[3] = {x, y, z};
+                    adjacent[axes.axis] += axes.sign;
+
+                    const BlockId block = input.blocks[ChunkMeshInput::Index(x, y, z)];
+                    const BlockId neighbor =
+                        input.blocks[ChunkMeshInput::Index(adjacent[0], adjacent[1], adjacent[2])];
+                    if (!IsFaceVisible(m_registry, block, neighbor))
+                        continue;
+
+                    ExpectedFace& entry = expected[face * Chunk::VOLUME + Chunk::Index(x, y, z)];
+                    entry.visible = true;
+                    entry.block = block;
+                    for (int corner = 0; corner < 4; ++corner)
+                    {
+                        int s1[3] = {adjacent[0], adjacent[1], adjacent[2]};
+                        int s2[3] = {adjacent[0], adjacent[1], adjacent[2]};
+                        s1[axes.u] += CORNERS[corner][0] ? 1 : -1;
+                        s2[axes.v] += CORNERS[corner][1] ? 1 : -1;
+                        int d[3] = {s1[0], s1[1], s1[2]};
+                        d[axes.v] = s2[axes.v];
+
+                        const bool o1 = opaqueAt(s1[0], s1[1], s1[2]);
+                        const bool o2 = opaqueAt(s2[0], s2[1], s2[2]);
+                        const bool od = opaqueAt(d[0], d[1], d[2]);
+                        entry.ao[corner] = o1 && o2 ? 0 : static_cast<std::uint8_t>(3 - o1 - o2 - od);
+
+                        int sky = 0, blockLight = 0, count = 0;
+                        auto sample = [&](const int* p) {
+                            sky += lightAt(p[0], p[1], p[2]) >> 4;
+                            blockLight += lightAt(p[0], p[1], p[2]) & 0x0F;
+                            ++count;
+                        };
+                        sample(adjacent);
+                        if (!o1)
+                            sample(s1);
+                        if (!o2)
+                            sample(s2);
+                        if (!od && !(o1 && o2))
+                            sample(d);
+                        entry.light[corner] = static_cast<std::uint8_t>(
+                            (((sky + count / 2) / count) << 4) | ((blockLight + count / 2) / count));
+                    }
+                }
+            }
+        }
+    }
+
+    if (mesh.vertices.size() % 4 != 0 || mesh.indices.size() != mesh.vertices.size() / 4 * 6)
+    {
+        std::cerr << "Chunk mesh is not made of quads" << std::endl;
+        return false;
+    }
+
+    // every unit face a quad covers must be visible, uncovered so far, and shaded like the quad
+    for (std::size_t base = 0; base < mesh.vertices.size(); base += 4)
+    {
+        const ChunkVertex* quad = &mesh.vertices[base];
+        const FaceAxes& axes = FACES[quad[0].face];
+        const int position[3] = {quad[0].x, quad[0].y, quad[0].z};
+        const int opposite[3] = {quad[2].x, quad[2].y, quad[2].z};
+        const int slice = position[axes.axis] - (axes.sign > 0 ? 1 : 0);
+
+        for (int v = position[axes.v]; v < opposite[axes.v]; ++v)
+        {
+            for (int u = position[axes.u]; u < opposite[axes.u]; ++u)
+            {
+                int cell[3];
+                cell[axes.axis] = slice;
+                cell[axes.u] = u;
+                cell[axes.v] = v;
+
+                ExpectedFace& entry =
+                    expected[quad[0].face * Chunk::VOLUME + Chunk::Index(cell[0], cell[1], cell[2])];
+                bool matches = entry.visible && !entry.covered &&
+                               m_registry.GetFaceTexture(entry.block, quad[0].face) == quad[0].texture;
+                for (int corner = 0; corner < 4 && matches; ++corner)
+                {
+                    matches = entry.light[corner] == quad[corner].light && entry.ao[corner] == quad[corner].ao;
+                }
+                if (!matches)
+                {
+                    std::cerr << "Chunk mesh mismatch at face " << static_cast<int>(quad[0].face) << " ("
+                              << cell[0] << ", " << cell[1] << ", " << cell[2] << ")" << std::endl;
+                    return false;
+                }
+                entry.covered = true;
+            }
+        }
+    }
+
+    for (const ExpectedFace& entry : expected)
+    {
+        if (entry.visible && !entry.covered)
+        {
+            std::cerr << "Chunk mesh is missing a visible face" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,127 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "World/BlockRegistry.hpp"
+#include "World/Chunk.hpp"
+#include "World/ChunkLod.hpp"
+
+#include <cstdint>
+#include <vector>
+
+class World;
+
+/**
+ * Packed chunk vertex (8 bytes). Positions are local to the chunk (0..32), so chunk
+ * placement is a per-draw offset rather than part of the vertex.
+ */
+struct ChunkVertex
+{
+    std::uint8_t x, y, z;
+    std::uint8_t face;
+    std::uint8_t light; // sky light in the high nibble, block light in the low nibble
+    std::uint8_t ao; // 0 (fully occluded) to 3 (open)
+    std::uint16_t texture; // texture layer from the block registry
+};
+
+static_assert(sizeof(ChunkVertex) == 8, "ChunkVertex is uploaded as-is");
+
+struct ChunkMesh
+{
+    ChunkCoord coord;
+    std::vector<ChunkVertex> vertices;
+    std::vector<std::uint32_t> indices;
+
+    void Clear()
+    {
+        vertices.clear();
+        indices.clear();
+    }
+};
+
+/**
+ * Snapshot of a chunk plus a one-block border from its 26 neighbours, taken on the main
+ * thread so meshing can run on a worker without touching the world.
+ */
+struct ChunkMeshInput
+{
+    static constexpr int PADDED_SIZE = Chunk::SIZE + 2;
+    static constexpr int PADDED_VOLUME = PADDED_SIZE * PADDED_SIZE * PADDED_SIZE;
+
+    ChunkCoord coord;
+    std::vector<BlockId> blocks = std::vector<BlockId>(PADDED_VOLUME);
+    std::vector<std::uint8_t> light = std::vector<std::uint8_t>(PADDED_VOLUME);
+
+    /**
+     * Index of a chunk-local position; each coordinate may range from -1 to Chunk::SIZE
+     */
+    static constexpr int Index(int x, int y, int z)
+    {
+        return (x + 1) + (z + 1) * PADDED_SIZE + (y + 1) * PADDED_SIZE * PADDED_SIZE;
+    }
+};
+
+/**
+ * Padded snapshot of one level of a downsampled chunk and its neighbours at the same level
+ */
+struct LodMeshInput
+{
+    ChunkCoord coord;
+    int level = 1;
+    int size = ChunkLod::GetSize(1);
+    std::vector<BlockId> blocks;
+    std::vector<std::uint8_t> light;
+
+    [[nodiscard]] int Index(int x, int y, int z) const
+    {
+        const int padded = size + 2;
+        return (x + 1) + (z + 1) * padded + (y + 1) * padded * padded;
+    }
+};
+
+/**
+ * Greedy mesher producing one quad per maximal rectangle of identical faces. Faces carry
+ * smooth per-vertex light (the average of the four cells touching each corner) and baked
+ * 4-sample ambient occlusion, and only faces with identical block, light and AO are merged.
+ * Quads are split along the diagonal that keeps AO interpolation free of seams.
+ */
+class ChunkMesher
+{
+public:
+    explicit ChunkMesher(const BlockRegistry& registry);
+
+    /**
+     * Copy a chunk and the border of its neighbours out of the world
+     */
+    static void GatherInput(const World& world, const ChunkCoord& coord, ChunkMeshInput& input);
+
+    /**
+     * Build the mesh for a gathered chunk. Thread-safe.
+     */
+    void Mesh(const ChunkMeshInput& input, ChunkMesh& mesh) const;
+
+    /**
+     * Check a mesh against a brute-force per-face evaluation of visibility, light and AO.
+     * Slow; meant for debug builds and benchmarks.
+     * @return True if every visible face is covered exactly once with matching shading
+     */
+    [[nodiscard]] bool Validate(const ChunkMeshInput& input, const ChunkMesh& mesh) const;
+
+    /**
+     * Copy one level of a downsampled chunk and the border of its neighbours out of the
+     * store. Sky light is approximated by casting straight down through the coarse cells.
+     */
+    void GatherLodInput(const LodStore& store, const ChunkCoord& coord, int level,
+                        LodMeshInput& input) const;
+
+    /**
+     * Build a coarse mesh with flat per-face light and no AO. Vertices use the same
+     * chunk-local block units as full resolution meshes.
+     * @param seamFaces Bit per face direction whose neighbour is drawn at another level; faces
+     *        on that chunk border are always emitted so the step between levels has no holes
+     */
+    void MeshLod(const LodMeshInput& input, std::uint8_t seamFaces, ChunkMesh& mesh) const;
+
+private:
+    const BlockRegistry& m_registry;
+};
@@ -0,0 +1,156 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "ChunkRenderer.hpp"
+
+#include "GpuMemory.hpp"
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+
+ChunkRenderer::ChunkRenderer()
+    : m_meshPool(MESH_NODE_SIZE, alignof(std::max_align_t), MESH_NODES_PER_PAGE)
+    , m_meshes(&m_meshPool)
+    , m_triangleCount(0)
+    , m_memoryUsage(0)
+{
+}
+
+ChunkRenderer::~ChunkRenderer()
+{
+    Shutdown();
+}
+
+bool ChunkRenderer::Initialize(const std::string& vertexPath, const std::string& fragmentPath,
+                               const BlockRegistry& registry)
+{
+    const MemoryTagScope shaderTag(MemoryTag::Shaders);
+    m_shader = std::make_unique<Shader>(vertexPath, fragmentPath);
+    if (m_shader->ID == 0)
+        return false;
+
+    if (registry.GetTextureCount() > MAX_TEXTURE_LAYERS)
+    {
+        std::cerr << "Warning: " << registry.GetTextureCount() << " texture layers, only the first "
+                  << MAX_TEXTURE_LAYERS << " get their own colour" << std::endl;
+    }
+
+    // uniforms keep their values in the program, so this is set once
+    std::array<glm::vec3, MAX_TEXTURE_LAYERS> colors;
+    for (std::size_t layer = 0; layer < colors.size(); ++layer)
+    {
+        const std::uint32_t color = registry.GetTextureColor(static_cast<std::uint16_t>(layer));
+        colors[layer] = glm::vec3(static_cast<float>((color >> 16) & 0xFF) / 255.0f,
+                                  static_cast<float>((color >> 8) & 0xFF) / 255.0f,
+                                  static_cast<float>(color & 0xFF) / 255.0f);
+    }
+    m_shader->use();
+    m_shader->setVec3Array("textureColors", colors.data(), static_cast<int>(colors.size()));
+    return true;
+}
+
+void ChunkRenderer::Shutdown()
+{
+    for (auto& [coord, mesh] : m_meshes)
+    {
+        Release(mesh);
+    }
+    m_meshes.clear();
+    m_triangleCount = 0;
+    m_memoryUsage = 0;
+    m_shader.reset();
+}
+
+void ChunkRenderer::Upload(const ChunkMesh& mesh)
+{
+    if (mesh.indices.empty())
+    {
+        Remove(mesh.coord);
+        return;
+    }
+
+    GpuMesh& gpuMesh = m_meshes[mesh.coord];
+    if (gpuMesh.vertexArray == 0)
+    {
+        glGenVertexArrays(1, &gpuMesh.vertexArray);
+        glGenBuffers(1, &gpuMesh.vertexBuffer);
+        glGenBuffers(1, &gpuMesh.indexBuffer);
+
+        glBindVertexArray(gpuMesh.vertexArray);
+        glBindBuffer(GL_ARRAY_BUFFER, gpuMesh.vertexBuffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gpuMesh.indexBuffer);
+
+        // integer attributes: (x, y, z, face), (light, ao), texture
+        constexpr auto stride = static_cast<GLsizei>(sizeof(ChunkVertex));
+        glVertexAttribIPointer(0, 4, GL_UNSIGNED_BYTE, stride,
+                               reinterpret_cast<const void*>(offsetof(ChunkVertex, x)));
+        glEnableVertexAttribArray(0);
+        glVertexAttribIPointer(1, 2, GL_UNSIGNED_BYTE, stride,
+                               reinterpret_cast<const void*>(offsetof(ChunkVertex, light)));
+        glEnableVertexAttribArray(1);
+        glVertexAttribIPointer(2, 1, GL_UNSIGNED_SHORT, stride,
+                               reinterpret_cast<const void*>(offsetof(ChunkVertex, texture)));
+        glEnableVertexAttribArray(2);
+    }
+    else
+    {
+        glBindVertexArray(gpuMesh.vertexArray);
+        glBindBuffer(GL_ARRAY_BUFFER, gpuMesh.vertexBuffer);
+        m_triangleCount -= static_cast<std::size_t>(gpuMesh.indexCount) / 3;
+        m_memoryUsage -= gpuMesh.vertexBytes + gpuMesh.indexBytes;
+    }
+
+    UploadBufferData(GL_ARRAY_BUFFER, mesh.vertices.size() * sizeof(ChunkVertex), mesh.vertices.data(),
+                     GL_STATIC_DRAW, MemoryTag::Meshes, gpuMesh.vertexBytes);
+    UploadBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(std::uint32_t), mesh.indices.data(),
+                     GL_STATIC_DRAW, MemoryTag::Meshes, gpuMesh.indexBytes);
+    glBindVertexArray(0);
+
+    gpuMesh.indexCount = static_cast<GLsizei>(mesh.indices.size());
+    m_triangleCount += mesh.indices.size() / 3;
+    m_memoryUsage += gpuMesh.vertexBytes + gpuMesh.indexBytes;
+}
+
+void ChunkRenderer::Remove(const ChunkCoord& coord)
+{
+    const auto it = m_meshes.find(coord);
+    if (it == m_meshes.end())
+        return;
+
+    m_triangleCount -= static_cast<std::size_t>(it->second.indexCount) / 3;
+    m_memoryUsage -= it->second.vertexBytes + it->second.indexBytes;
+    Release(it->second);
+    m_meshes.erase(it);
+}
+
+std::size_t ChunkRenderer::Render(const glm::mat4& view, const glm::mat4& projection,
+                                  const glm::dvec3& cameraPosition) const
+{
+    if (!m_shader || m_meshes.empty())
+        return 0;
+
+    m_shader->use();
+    m_shader->setMat4("view", view);
+    m_shader->setMat4("projection", projection);
+
+    for (const auto& [coord, mesh] : m_meshes)
+    {
+        const glm::dvec3 origin(static_cast<double>(coord.x) * Chunk::SIZE, static_cast<double>(coord.y) * Chunk::SIZE,
+                                static_cast<double>(coord.z) * Chunk::SIZE);
+        m_shader->setVec3("chunkOffset", glm::vec3(origin - cameraPosition));
+        glBindVertexArray(mesh.vertexArray);
+        glDrawElements(GL_TRIANGLES, mesh.indexCount, GL_UNSIGNED_INT, nullptr);
+    }
+    glBindVertexArray(0);
+    return m_meshes.size();
+}
+
+void ChunkRenderer::Release(GpuMesh& mesh)
+{
+    DeleteBuffer(mesh.vertexBuffer, MemoryTag::Meshes, mesh.vertexBytes);
+    DeleteBuffer(mesh.indexBuffer, MemoryTag::Meshes, mesh.indexBytes);
+    glDeleteVertexArrays(1, &mesh.vertexArray);
+    mesh = GpuMesh{};
+}
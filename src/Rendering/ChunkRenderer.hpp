@@ -0,0 +1,92 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "ChunkMesher.hpp"
+#include "Core/Memory/PoolResource.hpp"
+#include "Shader.hpp"
+#include "World/BlockRegistry.hpp"
+#include "World/Chunk.hpp"
+
+#include "glad/glad.h"
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+
+/**
+ * GPU side of chunk meshes: one vertex array per chunk holding the packed 8-byte
+ * ChunkVertex format, drawn with a per-chunk offset uniform. Offsets are computed in
+ * double precision relative to the camera, so vertices stay chunk-local bytes and
+ * precision does not depend on how far the camera is from the world origin.
+ */
+class ChunkRenderer
+{
+public:
+    ChunkRenderer();
+    ~ChunkRenderer();
+
+    ChunkRenderer(const ChunkRenderer&) = delete;
+    ChunkRenderer& operator=(const ChunkRenderer&) = delete;
+
+    /**
+     * Texture layers with their own colour in the chunk shader; later layers share the last
+     */
+    static constexpr std::size_t MAX_TEXTURE_LAYERS = 128;
+
+    /**
+     * Load the chunk shader and give it the registry's texture colours. Requires a current
+     * GL context.
+     */
+    bool Initialize(const std::string& vertexPath, const std::string& fragmentPath, const BlockRegistry& registry);
+
+    /**
+     * Release every buffer and the shader
+     */
+    void Shutdown();
+
+    /**
+     * Upload a mesh, replacing the previous one of the same chunk. Empty meshes just remove it.
+     */
+    void Upload(const ChunkMesh& mesh);
+
+    void Remove(const ChunkCoord& coord);
+
+    /**
+     * Draw every chunk
+     * @param view Camera-relative (rotation only) view matrix, see Camera::GetViewMatrix
+     * @return Number of draw calls issued
+     */
+    std::size_t Render(const glm::mat4& view, const glm::mat4& projection, const glm::dvec3& cameraPosition) const;
+
+    [[nodiscard]] std::size_t GetMeshCount() const { return m_meshes.size(); }
+    [[nodiscard]] std::size_t GetTriangleCount() const { return m_triangleCount; }
+    [[nodiscard]] std::size_t GetMemoryUsage() const { return m_memoryUsage; }
+
+private:
+    struct GpuMesh
+    {
+        GLuint vertexArray = 0;
+        GLuint vertexBuffer = 0;
+        GLuint indexBuffer = 0;
+        GLsizei indexCount = 0;
+        std::size_t vertexBytes = 0;
+        std::size_t indexBytes = 0;
+    };
+
+    // map nodes come from a pool, so chunks streaming in and out do not churn the heap
+    static constexpr std::size_t MESH_NODE_SIZE = sizeof(std::pair<const ChunkCoord, GpuMesh>) + 2 * sizeof(void*);
+    static constexpr std::size_t MESH_NODES_PER_PAGE = 256;
+
+    std::unique_ptr<Shader> m_shader;
+    PoolResource m_meshPool;
+    std::pmr::unordered_map<ChunkCoord, GpuMesh, ChunkCoordHash> m_meshes;
+    std::size_t m_triangleCount;
+    std::size_t m_memoryUsage;
+
+    void Release(GpuMesh& mesh);
+};
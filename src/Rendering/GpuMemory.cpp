@@ -0,0 +1,27 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "GpuMemory.hpp"
+
+void UploadBufferData(GLenum target, std::size_t bytes, const void* data, GLenum usage, MemoryTag tag,
+                      std::size_t& trackedBytes)
+{
+    glBufferData(target, static_cast<GLsizeiptr>(bytes), data, usage);
+
+    if (trackedBytes > 0)
+        AllocationTracker::RecordGpuFree(tag, trackedBytes);
+    AllocationTracker::RecordGpuAllocation(tag, bytes);
+    trackedBytes = bytes;
+}
+
+void DeleteBuffer(GLuint& buffer, MemoryTag tag, std::size_t& trackedBytes)
+{
+    if (buffer != 0)
+        glDeleteBuffers(1, &buffer);
+    if (trackedBytes > 0)
+        AllocationTracker::RecordGpuFree(tag, trackedBytes);
+
+    buffer = 0;
+    trackedBytes = 0;
+}
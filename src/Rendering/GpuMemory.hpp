@@ -0,0 +1,22 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Core/Memory/AllocationTracker.hpp"
+
+#include "glad/glad.h"
+
+#include <cstddef>
+
+/**
+ * glBufferData on the buffer bound to target, reporting the change in size to the
+ * AllocationTracker under tag
+ * @param trackedBytes Size the buffer was last reported at; updated to bytes
+ */
+void UploadBufferData(GLenum target, std::size_t bytes, const void* data, GLenum usage, MemoryTag tag,
+                      std::size_t& trackedBytes);
+
+/**
+ * Delete a buffer and report its memory as freed
+ */
+void DeleteBuffer(GLuint& buffer, MemoryTag tag, std::size_t& trackedBytes);
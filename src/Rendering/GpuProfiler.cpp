@@ -0,0 +1,155 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "GpuProfiler.hpp"
+
+GpuProfiler::GpuProfiler()
+    : m_frameIndex(0)
+    , m_initialized(false)
+    , m_frameOpen(false)
+    , m_openScopeCount(0)
+    , m_skippedScopes(0)
+    , m_lastFrameTime(0.0f)
+    , m_droppedFrames(0)
+    , m_track(nullptr)
+{
+}
+
+GpuProfiler::~GpuProfiler()
+{
+    Shutdown();
+}
+
+bool GpuProfiler::Initialize()
+{
+    if (m_initialized)
+        return true;
+
+    for (Frame& frame : m_frames)
+    {
+        glGenQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+    }
+    m_lastResults.reserve(MAX_SCOPES_PER_FRAME);
+    m_track = Profiler::CreateTrack("GPU");
+    m_initialized = true;
+    return glGetError() == GL_NO_ERROR;
+}
+
+void GpuProfiler::Shutdown()
+{
+    if (!m_initialized)
+        return;
+
+    for (Frame& frame : m_frames)
+    {
+        glDeleteQueries(static_cast<GLsizei>(frame.queries.size()), frame.queries.data());
+        frame = Frame{};
+    }
+    m_initialized = false;
+}
+
+void GpuProfiler::BeginFrame()
+{
+    if (!m_initialized || m_frameOpen)
+        return;
+
+    Frame& frame = m_frames[m_frameIndex % FRAME_LATENCY];
+    if (!Resolve(frame))
+        ++m_droppedFrames;
+
+    frame.scopeCount = 0;
+    frame.queryCount = 0;
+    GLint64 gpuNow = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+    frame.clockOffsetNs = static_cast<std::int64_t>(Profiler::Now()) - static_cast<std::int64_t>(gpuNow);
+
+    m_frameOpen = true;
+    m_openScopeCount = 0;
+    m_skippedScopes = 0;
+    BeginScope("Frame");
+}
+
+void GpuProfiler::EndFrame()
+{
+    if (!m_frameOpen)
+        return;
+
+    // close whatever the frame left open, the frame scope last
+    while (m_openScopeCount > 0)
+    {
+        EndScope();
+    }
+    m_frameOpen = false;
+    ++m_frameIndex;
+}
+
+void GpuProfiler::BeginScope(const char* name)
+{
+    if (!m_frameOpen)
+        return;
+
+    Frame& frame = m_frames[m_frameIndex % FRAME_LATENCY];
+    if (m_skippedScopes > 0 || m_openScopeCount == MAX_DEPTH || frame.scopeCount == MAX_SCOPES_PER_FRAME)
+    {
+        ++m_skippedScopes;
+        return;
+    }
+
+    Scope& scope = frame.scopes[frame.scopeCount];
+    scope.name = name;
+    scope.depth = static_cast<int>(m_openScopeCount);
+    scope.beginQuery = frame.queryCount++;
+    glQueryCounter(frame.queries[scope.beginQuery], GL_TIMESTAMP);
+    m_openScopes[m_openScopeCount++] = frame.scopeCount++;
+}
+
+void GpuProfiler::EndScope()
+{
+    if (!m_frameOpen)
+        return;
+    if (m_skippedScopes > 0)
+    {
+        --m_skippedScopes;
+        return;
+    }
+    if (m_openScopeCount == 0)
+        return;
+
+    Frame& frame = m_frames[m_frameIndex % FRAME_LATENCY];
+    Scope& scope = frame.scopes[m_openScopes[--m_openScopeCount]];
+    scope.endQuery = frame.queryCount++;
+    glQueryCounter(frame.queries[scope.endQuery], GL_TIMESTAMP);
+}
+
+bool GpuProfiler::Resolve(Frame& frame)
+{
+    if (frame.queryCount == 0)
+        return true;
+
+    // queries complete in order, so the last one issued being ready means they all are
+    GLint available = GL_FALSE;
+    glGetQueryObjectiv(frame.queries[frame.queryCount - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available == GL_FALSE)
+        return false;
+
+    m_lastResults.clear();
+    for (std::size_t i = 0; i < frame.scopeCount; ++i)
+    {
+        const Scope& scope = frame.scopes[i];
+        GLuint64 begin = 0;
+        GLuint64 end = 0;
+        glGetQueryObjectui64v(frame.queries[scope.beginQuery], GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(frame.queries[scope.endQuery], GL_QUERY_RESULT, &end);
+        end = end < begin ? begin : end;
+
+        m_lastResults.push_back({scope.name, scope.depth, static_cast<float>(end - begin) / 1000000.0f});
+        if (m_track)
+        {
+            const auto cpuBegin = static_cast<std::uint64_t>(frame.clockOffsetNs + static_cast<std::int64_t>(begin));
+            Profiler::RecordTo(*m_track, scope.name, cpuBegin, cpuBegin + (end - begin));
+        }
+    }
+    m_lastFrameTime = m_lastResults.empty() ? 0.0f : m_lastResults.front().milliseconds;
+    return true;
+}
@@ -0,0 +1,152 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Core/Profiling/Profiler.hpp"
+
+#include "glad/glad.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * GPU time of one pass in a resolved frame
+ */
+struct GpuScopeTiming
+{
+    const char* name;
+    int depth;
+    float milliseconds;
+};
+
+/**
+ * Times render passes on the GPU with timestamp queries.
+ *
+ * Each frame writes its queries into one of FRAME_LATENCY slots and the slot is read back
+ * when it comes round again, so results arrive a few frames late and reading them never
+ * waits on the GPU; a frame whose queries are still not done by then is dropped. Resolved
+ * scopes go onto a "GPU" track of the CPU Profiler, shifted onto its clock, so a captured
+ * trace shows both sides of every frame on one timeline.
+ */
+class GpuProfiler
+{
+public:
+    static constexpr std::size_t FRAME_LATENCY = 4;
+    static constexpr std::size_t MAX_SCOPES_PER_FRAME = 32;
+    static constexpr std::size_t MAX_DEPTH = 8;
+
+    GpuProfiler();
+    ~GpuProfiler();
+
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+    /**
+     * Create the query objects. Requires a current GL context.
+     */
+    bool Initialize();
+
+    void Shutdown();
+
+    /**
+     * Resolve the oldest frame in flight if its queries are done, then start timing a new
+     * frame in its slot. Opens a "Frame" scope that EndFrame closes.
+     */
+    void BeginFrame();
+
+    void EndFrame();
+
+    /**
+     * Scopes nest; ones past MAX_SCOPES_PER_FRAME or MAX_DEPTH are not timed
+     */
+    void BeginScope(const char* name);
+    void EndScope();
+
+    /**
+     * Scopes of the most recently resolved frame, in the order they began
+     */
+    [[nodiscard]] const std::vector<GpuScopeTiming>& GetLastResults() const { return m_lastResults; }
+
+    /**
+     * GPU time of the most recently resolved frame in milliseconds
+     */
+    [[nodiscard]] float GetLastFrameTime() const { return m_lastFrameTime; }
+
+    /**
+     * Frames whose queries were not ready when their slot was reused
+     */
+    [[nodiscard]] std::size_t GetDroppedFrameCount() const { return m_droppedFrames; }
+
+private:
+    struct Scope
+    {
+        const char* name;
+        int depth;
+        std::size_t beginQuery;
+        std::size_t endQuery;
+    };
+
+    struct Frame
+    {
+        std::array<GLuint, MAX_SCOPES_PER_FRAME * 2> queries{};
+        std::array<Scope, MAX_SCOPES_PER_FRAME> scopes{};
+        std::size_t scopeCount = 0;
+        std::size_t queryCount = 0;
+        std::int64_t clockOffsetNs = 0; // Profiler::Now() minus the GPU timestamp at BeginFrame
+    };
+
+    std::array<Frame, FRAME_LATENCY> m_frames;
+    std::size_t m_frameIndex;
+    bool m_initialized;
+    bool m_frameOpen;
+
+    std::array<std::size_t, MAX_DEPTH> m_openScopes{};
+    std::size_t m_openScopeCount;
+    std::size_t m_skippedScopes; // opened past the limits; their EndScope is ignored
+
+    std::vector<GpuScopeTiming> m_lastResults;
+    float m_lastFrameTime;
+    std::size_t m_droppedFrames;
+    ProfileTrack* m_track;
+
+    /**
+     * Read a frame's queries back if they are all available
+     * @return false if the GPU has not finished the frame yet
+     */
+    bool Resolve(Frame& frame);
+};
+
+/**
+ * Times the GPU work issued in a scope; use through GPU_PROFILE_SCOPE
+ */
+class GpuProfileScope
+{
+public:
+    GpuProfileScope(GpuProfiler* profiler, const char* name)
+        : m_profiler(profiler)
+    {
+        if (m_profiler)
+            m_profiler->BeginScope(name);
+    }
+
+    ~GpuProfileScope()
+    {
+        if (m_profiler)
+            m_profiler->EndScope();
+    }
+
+    GpuProfileScope(const GpuProfileScope&) = delete;
+    GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+
+private:
+    GpuProfiler* m_profiler;
+};
+
+#ifdef SILK_PROFILE
+#define GPU_PROFILE_SCOPE(profiler, name) \
+    const GpuProfileScope SILK_PROFILE_CONCAT(gpuProfileScope, __LINE__)(profiler, name)
+#else
+#define GPU_PROFILE_SCOPE(profiler, name) static_cast<void>(0)
+#endif
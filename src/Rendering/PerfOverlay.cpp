@@ -0,0 +1,238 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "PerfOverlay.hpp"
+
+#include "Core/Memory/AllocationTracker.hpp"
+#include "Core/Profiling/FrameStats.hpp"
+#include "GpuProfiler.hpp"
+
+#include "backends/imgui_impl_glfw.h"
+#include "backends/imgui_impl_opengl3.h"
+#include "imgui.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+const ImVec4 WARNING_COLOR(1.0f, 0.4f, 0.3f, 1.0f);
+
+bool SameName(const char* a, const char* b)
+{
+    // literals are usually merged, so the pointer check settles most lookups
+    return a == b || std::strcmp(a, b) == 0;
+}
+} // namespace
+
+PerfOverlay::PerfOverlay()
+    : m_initialized(false)
+    , m_visible(false)
+    , m_lastCost(0.0f)
+    , m_frameTimeIndex(0)
+    , m_scopeRowCount(0)
+{
+}
+
+PerfOverlay::~PerfOverlay()
+{
+    Shutdown();
+}
+
+bool PerfOverlay::Initialize(GLFWwindow* window)
+{
+    if (m_initialized)
+        return true;
+
+    const MemoryTagScope uiTag(MemoryTag::UI);
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    ImGui::StyleColorsDark();
+
+    if (!ImGui_ImplGlfw_InitForOpenGL(window, true))
+    {
+        std::cerr << "Failed to initialize ImGui GLFW backend" << std::endl;
+        ImGui::DestroyContext();
+        return false;
+    }
+    if (!ImGui_ImplOpenGL3_Init("#version 330"))
+    {
+        std::cerr << "Failed to initialize ImGui OpenGL backend" << std::endl;
+        ImGui_ImplGlfw_Shutdown();
+        ImGui::DestroyContext();
+        return false;
+    }
+
+    m_events.reserve(4096);
+    m_initialized = true;
+    return true;
+}
+
+void PerfOverlay::Shutdown()
+{
+    if (!m_initialized)
+        return;
+
+    const MemoryTagScope uiTag(MemoryTag::UI);
+    ImGui_ImplOpenGL3_Shutdown();
+    ImGui_ImplGlfw_Shutdown();
+    ImGui::DestroyContext();
+    m_initialized = false;
+}
+
+void PerfOverlay::AddFrameTime(float seconds)
+{
+    m_frameTimes[m_frameTimeIndex] = seconds * 1000.0f;
+    m_frameTimeIndex = (m_frameTimeIndex + 1) % FRAME_HISTORY;
+}
+
+void PerfOverlay::Render(const PerfOverlayStats& stats, const FrameStats& frameStats, GpuProfiler* gpuProfiler)
+{
+    if (!m_initialized || !m_visible)
+        return;
+
+    const std::uint64_t start = Profiler::Now();
+    PROFILE_SCOPE("PerfOverlay");
+    GPU_PROFILE_SCOPE(gpuProfiler, "UI");
+    const MemoryTagScope uiTag(MemoryTag::UI);
+
+    GatherCpuScopes();
+
+    ImGui_ImplOpenGL3_NewFrame();
+    ImGui_ImplGlfw_NewFrame();
+    ImGui::NewFrame();
+
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowBgAlpha(0.75f);
+    ImGui::Begin("Performance", nullptr,
+                 ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav);
+
+    // frame times
+    const FrameStatsSummary summary = frameStats.GetSummary();
+    const std::size_t newest = (m_frameTimeIndex + FRAME_HISTORY - 1) % FRAME_HISTORY;
+    const float frameTime = m_frameTimes[newest];
+    ImGui::Text("Frame %.2f ms (%.0f FPS)", frameTime, frameTime > 0.0f ? 1000.0f / frameTime : 0.0f);
+    ImGui::Text("p50 %.2f  p95 %.2f  p99 %.2f  max %.2f ms", summary.p50, summary.p95, summary.p99, summary.max);
+    ImGui::Text("Over %.1f ms budget: %llu of %llu", summary.budget,
+                static_cast<unsigned long long>(summary.overBudget),
+                static_cast<unsigned long long>(summary.frameCount));
+    ImGui::PlotLines("##frameTimes", m_frameTimes.data(), static_cast<int>(FRAME_HISTORY),
+                     static_cast<int>(m_frameTimeIndex), nullptr, 0.0f, summary.budget * 2.0f, ImVec2(320.0f, 60.0f));
+
+    // CPU and GPU breakdown
+    if (ImGui::CollapsingHeader("CPU scopes (last frame)", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        if (!Profiler::IsEnabled())
+            ImGui::TextDisabled("Build with SILK_PROFILE to see scopes");
+        for (std::size_t i = 0; i < m_scopeRowCount; ++i)
+        {
+            const ScopeRow& row = m_scopeRows[i];
+            ImGui::Text("%-20s %7.3f ms  x%u", row.name, row.milliseconds, row.calls);
+        }
+    }
+
+    if (gpuProfiler && ImGui::CollapsingHeader("GPU passes", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        for (const GpuScopeTiming& timing : gpuProfiler->GetLastResults())
+        {
+            ImGui::Text("%*s%-*s %7.3f ms", timing.depth * 2, "", 20 - timing.depth * 2, timing.name,
+                        timing.milliseconds);
+        }
+
+        // time the CPU spends blocked in the swap is time it waits on the GPU or vsync
+        const float cpuTime = GetScopeTime("Frame") - GetScopeTime("SwapBuffers");
+        const float gpuTime = gpuProfiler->GetLastFrameTime();
+        if (cpuTime > 0.0f)
+            ImGui::Text("CPU %.2f ms / GPU %.2f ms: %s-bound", cpuTime, gpuTime, gpuTime > cpuTime ? "GPU" : "CPU");
+        if (gpuProfiler->GetDroppedFrameCount() > 0)
+            ImGui::Text("Dropped GPU frames: %zu", gpuProfiler->GetDroppedFrameCount());
+    }
+
+    // renderer, world and jobs
+    if (ImGui::CollapsingHeader("Rendering", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        ImGui::Text("Draw calls %zu, triangles %zu", stats.drawCalls, stats.triangles);
+        ImGui::Text("Chunks: %zu loaded, %zu meshed, %zu drawn", stats.loadedChunks, stats.meshedChunks,
+                    stats.drawCalls);
+        ImGui::Text("Meshing: %zu chunks this frame, %zu columns queued", stats.meshTasks, stats.pendingColumns);
+        ImGui::Text("Jobs: %u workers, peak queue %zu", stats.workerCount, stats.peakQueueDepth);
+        if (stats.targetBlock)
+            ImGui::Text("Target: %s at (%d, %d, %d)", stats.targetBlock, stats.targetX, stats.targetY, stats.targetZ);
+        else
+            ImGui::Text("Target: none in reach");
+    }
+
+    if (ImGui::CollapsingHeader("Memory"))
+    {
+        if (!AllocationTracker::IsHeapTrackingEnabled())
+            ImGui::TextDisabled("Build with SILK_TRACK_ALLOCATIONS for heap numbers");
+        for (std::size_t i = 0; i < MEMORY_TAG_COUNT; ++i)
+        {
+            const auto tag = static_cast<MemoryTag>(i);
+            const MemoryTagStats heap = AllocationTracker::GetHeapStats(tag);
+            const MemoryTagStats gpu = AllocationTracker::GetGpuStats(tag);
+            ImGui::Text("%-9s heap %8zu KB (%4zu allocs)  GPU %8zu KB", GetMemoryTagName(tag), heap.currentBytes / 1024,
+                        heap.allocations, gpu.currentBytes / 1024);
+        }
+    }
+
+    if (m_lastCost > COST_BUDGET_MS)
+        ImGui::TextColored(WARNING_COLOR, "Overlay %.3f ms CPU", m_lastCost);
+    else
+        ImGui::TextDisabled("Overlay %.3f ms CPU", m_lastCost);
+
+    ImGui::End();
+    ImGui::Render();
+    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+    m_lastCost = static_cast<float>(Profiler::Now() - start) / 1000000.0f;
+}
+
+void PerfOverlay::GatherCpuScopes()
+{
+    m_scopeRowCount = 0;
+    std::uint64_t frameBegin = 0;
+    std::uint64_t frameEnd = 0;
+    Profiler::GetLastFrame(frameBegin, frameEnd);
+    if (frameEnd == 0)
+        return;
+
+    m_events.clear();
+    Profiler::CollectRecent(frameBegin, frameEnd, m_events);
+    for (const ProfileEvent& event : m_events)
+    {
+        const float milliseconds = static_cast<float>(event.endNs - std::max(event.beginNs, frameBegin)) / 1000000.0f;
+        ScopeRow* row = nullptr;
+        for (std::size_t i = 0; i < m_scopeRowCount && !row; ++i)
+        {
+            if (SameName(m_scopeRows[i].name, event.name))
+                row = &m_scopeRows[i];
+        }
+        if (!row)
+        {
+            if (m_scopeRowCount == MAX_SCOPE_ROWS)
+                continue;
+            row = &m_scopeRows[m_scopeRowCount++];
+            *row = ScopeRow{event.name, 0.0f, 0};
+        }
+        row->milliseconds += milliseconds;
+        ++row->calls;
+    }
+
+    std::sort(m_scopeRows.begin(), m_scopeRows.begin() + static_cast<std::ptrdiff_t>(m_scopeRowCount),
+              [](const ScopeRow& a, const ScopeRow& b) { return a.milliseconds > b.milliseconds; });
+}
+
+float PerfOverlay::GetScopeTime(const char* name) const
+{
+    for (std::size_t i = 0; i < m_scopeRowCount; ++i)
+    {
+        if (SameName(m_scopeRows[i].name, name))
+            return m_scopeRows[i].milliseconds;
+    }
+    return 0.0f;
+}
@@ -0,0 +1,111 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Core/Profiling/Profiler.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct GLFWwindow;
+class FrameStats;
+class GpuProfiler;
+
+/**
+ * Engine counters shown by the overlay, gathered once per frame
+ */
+struct PerfOverlayStats
+{
+    std::size_t drawCalls = 0;
+    std::size_t triangles = 0;
+    std::size_t loadedChunks = 0;
+    std::size_t meshedChunks = 0; // chunks with a mesh on the GPU
+    std::size_t meshTasks = 0; // chunks meshed this frame
+    std::size_t pendingColumns = 0; // columns still waiting to be meshed
+    unsigned workerCount = 0;
+    std::size_t peakQueueDepth = 0;
+    const char* targetBlock = nullptr; // block the camera is looking at, null if none in reach
+    int targetX = 0, targetY = 0, targetZ = 0;
+};
+
+/**
+ * ImGui window with the frame time graph and percentiles, the CPU scopes of the last frame,
+ * the GPU passes, draw and chunk counts, memory by tag and job queue depth.
+ *
+ * Drawing it costs a few hundred draw-list vertices and one pass over the last frame's
+ * profiler events; its own CPU time is measured every frame and shown at the bottom, and
+ * its GPU time appears as the "UI" pass. Nothing is drawn or gathered while it is hidden.
+ */
+class PerfOverlay
+{
+public:
+    static constexpr std::size_t FRAME_HISTORY = 240;
+    static constexpr std::size_t MAX_SCOPE_ROWS = 24;
+
+    /**
+     * Overlay CPU cost above which its cost line turns red
+     */
+    static constexpr float COST_BUDGET_MS = 0.3f;
+
+    PerfOverlay();
+    ~PerfOverlay();
+
+    PerfOverlay(const PerfOverlay&) = delete;
+    PerfOverlay& operator=(const PerfOverlay&) = delete;
+
+    /**
+     * Create the ImGui context and its GLFW and OpenGL backends. Install the window's own
+     * input callbacks first; the backend forwards events to them.
+     */
+    bool Initialize(GLFWwindow* window);
+
+    void Shutdown();
+
+    [[nodiscard]] bool IsVisible() const { return m_visible; }
+    void SetVisible(bool visible) { m_visible = visible; }
+    void Toggle() { m_visible = !m_visible; }
+
+    /**
+     * Add a frame to the graph; call every frame, even while hidden
+     */
+    void AddFrameTime(float seconds);
+
+    /**
+     * Build and draw the overlay if it is visible
+     * @param gpuProfiler May be null if GPU timing is off
+     */
+    void Render(const PerfOverlayStats& stats, const FrameStats& frameStats, GpuProfiler* gpuProfiler);
+
+    /**
+     * CPU time of the last Render in milliseconds
+     */
+    [[nodiscard]] float GetLastCost() const { return m_lastCost; }
+
+private:
+    struct ScopeRow
+    {
+        const char* name;
+        float milliseconds;
+        std::uint32_t calls;
+    };
+
+    bool m_initialized;
+    bool m_visible;
+    float m_lastCost;
+
+    std::array<float, FRAME_HISTORY> m_frameTimes{}; // milliseconds, oldest at m_frameTimeIndex
+    std::size_t m_frameTimeIndex;
+
+    std::vector<ProfileEvent> m_events;
+    std::array<ScopeRow, MAX_SCOPE_ROWS> m_scopeRows{};
+    std::size_t m_scopeRowCount;
+
+    /**
+     * Sum the last frame's profiler events by name across threads, slowest first
+     */
+    void GatherCpuScopes();
+
+    [[nodiscard]] float GetScopeTime(const char* name) const;
+};
@@ -122,6 +122,11 @@ void Shader::setVec3(const std::string& name, const float x, const float y, cons
     glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z);
 }
 
+void Shader::setVec3Array(const std::string& name, const glm::vec3* values, const int count) const
+{
+    glUniform3fv(glGetUniformLocation(ID, name.c_str()), count, &values[0][0]);
+}
+
 void Shader::setVec4(const std::string& name, const glm::vec4& value) const
 {
     glUniform4fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]);
@@ -21,6 +21,7 @@ public:
     void setVec2(const std::string& name, float x, float y) const;
     void setVec3(const std::string& name, const glm::vec3& value) const;
     void setVec3(const std::string& name, float x, float y, float z) const;
+    void setVec3Array(const std::string& name, const glm::vec3* values, int count) const;
     void setVec4(const std::string& name, const glm::vec4& value) const;
     void setVec4(const std::string& name, float x, float y, float z, float w) const;
 
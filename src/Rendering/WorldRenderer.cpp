@@ -0,0 +1,304 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "WorldRenderer.hpp"
+
+#include "Core/JobSystem.hpp"
+#include "Core/Memory/TransientMemory.hpp"
+#include "Core/Profiling/Profiler.hpp"
+#include "World/World.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory_resource>
+
+namespace
+{
+// horizontal neighbours with the bit of the mesh face that looks at them (+X, -X, +Z, -Z)
+constexpr int NEIGHBOR_OFFSETS[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+constexpr std::uint8_t NEIGHBOR_FACE_BITS[4] = {1 << 0, 1 << 1, 1 << 4, 1 << 5};
+} // namespace
+
+WorldRenderer::WorldRenderer(World& world, LodStore& lodStore, const BlockRegistry& registry, int renderDistance)
+    : m_world(world)
+    , m_lodStore(lodStore)
+    , m_registry(registry)
+    , m_mesher(registry)
+    , m_renderDistance(renderDistance)
+    , m_cameraColumn{}
+    , m_cameraPosition(0.0, 0.0, 0.0)
+    , m_levelsDirty(true)
+    , m_meshTaskCount(0)
+    , m_pendingColumnCount(0)
+    , m_hasGpu(false)
+{
+}
+
+bool WorldRenderer::Initialize(const std::string& vertexPath, const std::string& fragmentPath)
+{
+    m_hasGpu = m_renderer.Initialize(vertexPath, fragmentPath, m_registry);
+    return m_hasGpu;
+}
+
+void WorldRenderer::Shutdown()
+{
+    m_renderer.Shutdown();
+    m_hasGpu = false;
+    m_columns.clear();
+    m_tasks.clear();
+}
+
+void WorldRenderer::AddColumns(const std::vector<ChunkCoord>& columns, bool fullDetail)
+{
+    for (const ChunkCoord& coord : columns)
+    {
+        const ChunkCoord column{coord.x, 0, coord.z};
+        ColumnState& state = m_columns[column];
+        state.fullDetail = fullDetail;
+        state.contentDirty = true;
+        state.targetLevel = SelectTargetLevel(column, state);
+        UpdateSeamsAround(column);
+
+        // their border faces were built against a missing neighbour
+        MarkNeighborsDirty(column, false);
+    }
+}
+
+void WorldRenderer::RemoveColumns(const std::vector<ChunkCoord>& columns)
+{
+    for (const ChunkCoord& coord : columns)
+    {
+        if (m_columns.erase(ChunkCoord{coord.x, 0, coord.z}) == 0)
+            continue;
+
+        for (int y = 0; y < WORLD_HEIGHT_CHUNKS; ++y)
+        {
+            m_renderer.Remove(ChunkCoord{coord.x, y, coord.z});
+        }
+        // seams towards the removed column go away
+        UpdateSeamsAround(ChunkCoord{coord.x, 0, coord.z});
+    }
+}
+
+void WorldRenderer::Update(JobSystem& jobs, const glm::dvec3& cameraPosition)
+{
+    PROFILE_SCOPE("Meshing");
+    const ChunkCoord cameraColumn{static_cast<int>(std::floor(cameraPosition.x / Chunk::SIZE)), 0,
+                                  static_cast<int>(std::floor(cameraPosition.z / Chunk::SIZE))};
+    if (m_levelsDirty || cameraColumn != m_cameraColumn)
+    {
+        m_cameraColumn = cameraColumn;
+        m_cameraPosition = cameraPosition;
+        UpdateTargetLevels();
+        m_levelsDirty = false;
+    }
+
+    // edits and relighting since the last frame; chunks still waiting for light stay listed
+    m_world.TakeDirtyChunks(m_dirtyChunks);
+    std::size_t waiting = 0;
+    for (const ChunkCoord& coord : m_dirtyChunks)
+    {
+        const Chunk* chunk = m_world.GetChunk(coord);
+        if (!chunk || !chunk->IsDirty())
+            continue;
+
+        if (!chunk->IsLightReady())
+        {
+            m_dirtyChunks[waiting++] = coord;
+            continue;
+        }
+
+        const auto it = m_columns.find(ChunkCoord{coord.x, 0, coord.z});
+        if (it != m_columns.end())
+            it->second.contentDirty = true;
+    }
+    m_dirtyChunks.resize(waiting);
+
+    struct Candidate
+    {
+        ChunkCoord column;
+        int distanceSquared;
+    };
+    std::pmr::vector<Candidate> candidates(&GetFrameArena());
+    for (const auto& [column, state] : m_columns)
+    {
+        if (state.contentDirty || state.level != state.targetLevel || state.seams != state.targetSeams)
+        {
+            const int dx = column.x - m_cameraColumn.x;
+            const int dz = column.z - m_cameraColumn.z;
+            candidates.push_back({column, dx * dx + dz * dz});
+        }
+    }
+    m_meshTaskCount = 0;
+    m_pendingColumnCount = 0;
+    if (candidates.empty())
+        return;
+
+    const std::size_t budget =
+        std::min(candidates.size(), MESH_COLUMNS_PER_THREAD * (jobs.GetWorkerCount() + 1));
+    std::partial_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(budget),
+                      candidates.end(),
+                      [](const Candidate& a, const Candidate& b) { return a.distanceSquared < b.distanceSquared; });
+
+    m_pendingColumnCount = candidates.size() - budget;
+
+    // gather on this thread: the world and the store are not safe to read while they change
+    std::size_t taskCount = 0;
+    for (std::size_t c = 0; c < budget; ++c)
+    {
+        ColumnState& state = m_columns[candidates[c].column];
+        for (int y = 0; y < WORLD_HEIGHT_CHUNKS; ++y)
+        {
+            const ChunkCoord coord{candidates[c].column.x, y, candidates[c].column.z};
+            Chunk* chunk = m_world.GetChunk(coord);
+
+            if (state.targetLevel > 0 && chunk && (chunk->IsDirty() || !m_lodStore.Get(coord)))
+            {
+                m_lodStore.Insert(std::make_unique<ChunkLod>(*chunk));
+                chunk->SetDirty(false);
+                MarkNeighborsDirty(candidates[c].column, true);
+            }
+
+            const bool hasData = state.targetLevel == 0 ? chunk != nullptr : m_lodStore.Get(coord) != nullptr;
+            if (!hasData)
+            {
+                m_renderer.Remove(coord);
+                continue;
+            }
+
+            if (m_tasks.size() <= taskCount)
+                m_tasks.emplace_back();
+            MeshTask& task = m_tasks[taskCount++];
+            task.coord = coord;
+            task.level = state.targetLevel;
+            task.seams = state.targetSeams;
+            task.rebuildLod = nullptr;
+
+            if (task.level == 0)
+            {
+                ChunkMesher::GatherInput(m_world, coord, task.input);
+                if (chunk->IsDirty() || !m_lodStore.Get(coord))
+                    task.rebuildLod = chunk;
+                chunk->SetDirty(false);
+            }
+            else
+            {
+                m_mesher.GatherLodInput(m_lodStore, coord, task.level, task.lodInput);
+            }
+        }
+
+        state.level = state.targetLevel;
+        state.seams = state.targetSeams;
+        state.contentDirty = false;
+    }
+
+    m_meshTaskCount = taskCount;
+    jobs.ParallelFor(taskCount, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            PROFILE_SCOPE("Mesh");
+            MeshTask& task = m_tasks[i];
+            if (task.level == 0)
+            {
+                m_mesher.Mesh(task.input, task.mesh);
+                if (task.rebuildLod)
+                    task.lod = std::make_unique<ChunkLod>(*task.rebuildLod);
+            }
+            else
+            {
+                m_mesher.MeshLod(task.lodInput, task.seams, task.mesh);
+            }
+        }
+    });
+
+    PROFILE_SCOPE("Upload");
+    for (std::size_t i = 0; i < taskCount; ++i)
+    {
+        MeshTask& task = m_tasks[i];
+        if (m_hasGpu)
+            m_renderer.Upload(task.mesh);
+        if (task.lod)
+        {
+            m_lodStore.Insert(std::move(task.lod));
+            MarkNeighborsDirty(ChunkCoord{task.coord.x, 0, task.coord.z}, true);
+        }
+    }
+}
+
+std::size_t WorldRenderer::Render(const glm::mat4& view, const glm::mat4& projection,
+                                  const glm::dvec3& cameraPosition) const
+{
+    return m_renderer.Render(view, projection, cameraPosition);
+}
+
+std::size_t WorldRenderer::GetColumnCount(int level) const
+{
+    return static_cast<std::size_t>(std::count_if(m_columns.begin(), m_columns.end(),
+                                                  [level](const auto& entry) { return entry.second.level == level; }));
+}
+
+int WorldRenderer::SelectTargetLevel(const ChunkCoord& column, const ColumnState& state) const
+{
+    const double dx = static_cast<double>(column.x) + 0.5 - m_cameraPosition.x / Chunk::SIZE;
+    const double dz = static_cast<double>(column.z) + 0.5 - m_cameraPosition.z / Chunk::SIZE;
+    const auto distance = static_cast<float>(std::sqrt(dx * dx + dz * dz));
+
+    const int level = ChunkLod::SelectLevel(distance, m_renderDistance, state.level);
+    return level == 0 && !state.fullDetail ? 1 : level;
+}
+
+void WorldRenderer::UpdateTargetLevels()
+{
+    m_changedColumns.clear();
+    for (auto& [column, state] : m_columns)
+    {
+        const int level = SelectTargetLevel(column, state);
+        if (level != state.targetLevel)
+        {
+            state.targetLevel = level;
+            m_changedColumns.push_back(column);
+        }
+    }
+
+    for (const ChunkCoord& column : m_changedColumns)
+    {
+        UpdateSeamsAround(column);
+    }
+}
+
+void WorldRenderer::UpdateSeamsAround(const ChunkCoord& column)
+{
+    UpdateSeams(column);
+    for (const auto& offset : NEIGHBOR_OFFSETS)
+    {
+        UpdateSeams(ChunkCoord{column.x + offset[0], 0, column.z + offset[1]});
+    }
+}
+
+void WorldRenderer::UpdateSeams(const ChunkCoord& column)
+{
+    const auto it = m_columns.find(column);
+    if (it == m_columns.end())
+        return;
+
+    ColumnState& state = it->second;
+    state.targetSeams = 0;
+    for (int n = 0; n < 4; ++n)
+    {
+        const auto neighbor =
+            m_columns.find(ChunkCoord{column.x + NEIGHBOR_OFFSETS[n][0], 0, column.z + NEIGHBOR_OFFSETS[n][1]});
+        if (neighbor != m_columns.end() && neighbor->second.targetLevel != state.targetLevel)
+            state.targetSeams |= NEIGHBOR_FACE_BITS[n];
+    }
+}
+
+void WorldRenderer::MarkNeighborsDirty(const ChunkCoord& column, bool coarseOnly)
+{
+    for (const auto& offset : NEIGHBOR_OFFSETS)
+    {
+        const auto it = m_columns.find(ChunkCoord{column.x + offset[0], 0, column.z + offset[1]});
+        if (it != m_columns.end() && (!coarseOnly || it->second.level > 0))
+            it->second.contentDirty = true;
+    }
+}
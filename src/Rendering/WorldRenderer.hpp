@@ -0,0 +1,156 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "ChunkMesher.hpp"
+#include "ChunkRenderer.hpp"
+#include "World/ChunkLod.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class JobSystem;
+class World;
+
+/**
+ * Keeps chunk meshes in sync with the world and the camera.
+ *
+ * Columns near the camera are meshed at full resolution from the world; further out they
+ * are meshed from the LodStore at 2x, 4x and 8x (see ChunkLod::SelectLevel), so pushing the
+ * view distance to 4x the render distance costs roughly 2x the triangles of the full
+ * resolution area instead of 16x. Where neighbouring columns are drawn at different levels
+ * the coarser meshes add skirts on the shared border to hide the cracks.
+ */
+class WorldRenderer
+{
+public:
+    WorldRenderer(World& world, LodStore& lodStore, const BlockRegistry& registry, int renderDistance);
+
+    WorldRenderer(const WorldRenderer&) = delete;
+    WorldRenderer& operator=(const WorldRenderer&) = delete;
+
+    /**
+     * Load the chunk shaders. Requires a current GL context. Without it (headless runs)
+     * Update still meshes everything but drops the meshes instead of uploading them.
+     */
+    bool Initialize(const std::string& vertexPath, const std::string& fragmentPath);
+
+    void Shutdown();
+
+    /**
+     * Register generated or loaded columns (chunk y ignored)
+     * @param fullDetail True if the chunks of these columns are resident in the world,
+     *        false if only their downsampled data is in the LodStore
+     */
+    void AddColumns(const std::vector<ChunkCoord>& columns, bool fullDetail);
+
+    /**
+     * Stop drawing columns that are about to be unloaded (chunk y ignored) and free their meshes
+     */
+    void RemoveColumns(const std::vector<ChunkCoord>& columns);
+
+    /**
+     * Choose a level for every column from the camera position and remesh the columns that
+     * changed, nearest first, within a per-frame budget
+     */
+    void Update(JobSystem& jobs, const glm::dvec3& cameraPosition);
+
+    /**
+     * Draw the world around the camera; view must be camera-relative (rotation only)
+     * @return Number of draw calls issued
+     */
+    std::size_t Render(const glm::mat4& view, const glm::mat4& projection, const glm::dvec3& cameraPosition) const;
+
+    [[nodiscard]] std::size_t GetTriangleCount() const { return m_renderer.GetTriangleCount(); }
+    [[nodiscard]] std::size_t GetGpuMemoryUsage() const { return m_renderer.GetMemoryUsage(); }
+    [[nodiscard]] std::size_t GetMeshCount() const { return m_renderer.GetMeshCount(); }
+
+    /**
+     * Chunks meshed by the last Update, and columns still waiting to be remeshed after it
+     */
+    [[nodiscard]] std::size_t GetMeshTaskCount() const { return m_meshTaskCount; }
+    [[nodiscard]] std::size_t GetPendingColumnCount() const { return m_pendingColumnCount; }
+
+    /**
+     * Number of columns currently drawn at a level (0 = full resolution)
+     */
+    [[nodiscard]] std::size_t GetColumnCount(int level) const;
+
+private:
+    /**
+     * Per column (x, z) drawing state; level -1 means not drawn yet
+     */
+    struct ColumnState
+    {
+        bool fullDetail = false;
+        bool contentDirty = true;
+        int level = -1;
+        std::uint8_t seams = 0;
+        int targetLevel = 0;
+        std::uint8_t targetSeams = 0;
+    };
+
+    struct MeshTask
+    {
+        ChunkCoord coord;
+        int level = 0;
+        std::uint8_t seams = 0;
+        const Chunk* rebuildLod = nullptr;
+        ChunkMeshInput input;
+        LodMeshInput lodInput;
+        ChunkMesh mesh;
+        std::unique_ptr<ChunkLod> lod;
+    };
+
+    static constexpr std::size_t MESH_COLUMNS_PER_THREAD = 2;
+
+    World& m_world;
+    LodStore& m_lodStore;
+    const BlockRegistry& m_registry;
+    ChunkMesher m_mesher;
+    ChunkRenderer m_renderer;
+    int m_renderDistance;
+
+    std::unordered_map<ChunkCoord, ColumnState, ChunkCoordHash> m_columns;
+    ChunkCoord m_cameraColumn;
+    glm::dvec3 m_cameraPosition; // the levels were last chosen from here
+    bool m_levelsDirty; // until the first Update has seen the camera
+    std::vector<ChunkCoord> m_changedColumns; // reused; columns whose target level changed
+    std::vector<ChunkCoord> m_dirtyChunks; // reused; dirty chunks waiting for their light
+
+    // reused across frames; a full resolution input is over 100 KB
+    std::vector<MeshTask> m_tasks;
+    std::size_t m_meshTaskCount;
+    std::size_t m_pendingColumnCount;
+    bool m_hasGpu;
+
+    /**
+     * Level a column should be drawn at from the last camera position, with hysteresis
+     * around its current level
+     */
+    [[nodiscard]] int SelectTargetLevel(const ChunkCoord& column, const ColumnState& state) const;
+
+    /**
+     * Recompute the target level of every column after the camera changed column, and the
+     * seam masks around the columns whose level changed
+     */
+    void UpdateTargetLevels();
+
+    /**
+     * Recompute the seam masks of a column and its 4 horizontal neighbours
+     */
+    void UpdateSeamsAround(const ChunkCoord& column);
+    void UpdateSeams(const ChunkCoord& column);
+
+    /**
+     * Flag the 4 horizontal neighbours of a column whose meshes read across the shared border
+     * @param coarseOnly Only flag neighbours drawn from the LodStore
+     */
+    void MarkNeighborsDirty(const ChunkCoord& column, bool coarseOnly);
+};
@@ -0,0 +1,290 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "BlockRegistry.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+namespace
+{
+BlockDefinition MakeUnknownBlock()
+{
+    BlockDefinition unknown;
+    unknown.name = "unknown";
+    return unknown;
+}
+
+/**
+ * Faces a texture or color key applies to, as a bit per face; 0 if the key is unknown
+ * @param suffix Part of the key after the property name: "", ".top", ".side", ".+x", ...
+ */
+int ParseFaceMask(const std::string& suffix)
+{
+    if (suffix.empty())
+        return 0x3F;
+    if (suffix == ".top")
+        return 1 << 2;
+    if (suffix == ".bottom")
+        return 1 << 3;
+    if (suffix == ".side")
+        return (1 << 0) | (1 << 1) | (1 << 4) | (1 << 5);
+    if (suffix.size() == 3 && suffix[0] == '.' && (suffix[1] == '+' || suffix[1] == '-'))
+    {
+        const int axis = suffix[2] - 'x';
+        if (axis >= 0 && axis < 3)
+            return 1 << (axis * 2 + (suffix[1] == '-' ? 1 : 0));
+    }
+    return 0;
+}
+
+/**
+ * Parse "#RRGGBB" into 0xRRGGBB
+ */
+bool ParseColor(const std::string& value, std::uint32_t& color)
+{
+    if (value.size() != 7 || value[0] != '#' || value.find_first_not_of("0123456789abcdefABCDEF", 1) != std::string::npos)
+        return false;
+    color = static_cast<std::uint32_t>(std::stoul(value.substr(1), nullptr, 16));
+    return true;
+}
+
+/**
+ * Stand-in colour for a texture layer nothing gave a colour to
+ */
+std::uint32_t HashColor(std::size_t layer)
+{
+    return static_cast<std::uint32_t>((layer + 1) * 2654435761u) & 0xFFFFFF;
+}
+} // namespace
+
+BlockRegistry::BlockRegistry()
+    : m_frozen(false)
+    , m_unknownIndex(0)
+{
+    BlockDefinition air;
+    air.name = "air";
+    air.opaque = false;
+    air.solid = false;
+    m_definitions.push_back(air);
+    m_definitions.push_back(MakeUnknownBlock());
+    m_ids[air.name] = BLOCK_AIR;
+    BuildTables();
+}
+
+bool BlockRegistry::LoadFromFile(const std::string& filename)
+{
+    if (m_frozen)
+    {
+        std::cerr << "Block registry is frozen, cannot load " << filename << std::endl;
+        return false;
+    }
+
+    std::ifstream file(filename);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open block definitions: " << filename << std::endl;
+        return false;
+    }
+
+    auto trim = [](std::string& s) {
+        s.erase(0, s.find_first_not_of(" \t\r\n"));
+        s.erase(s.find_last_not_of(" \t\r\n") + 1);
+    };
+
+    // definitions are collected in order of first appearance, then registered together
+    std::vector<BlockDefinition> definitions;
+    std::unordered_map<std::string, std::size_t> indices;
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        ++lineNumber;
+        trim(line);
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        const std::size_t equalPos = line.find('=');
+        const std::size_t dotPos = line.find('.');
+        if (equalPos == std::string::npos || dotPos == std::string::npos || dotPos > equalPos)
+        {
+            std::cerr << "Warning: Skipping invalid block line " << lineNumber << ": " << line << "\n";
+            continue;
+        }
+
+        std::string name = line.substr(0, dotPos);
+        std::string property = line.substr(dotPos + 1, equalPos - dotPos - 1);
+        std::string value = line.substr(equalPos + 1);
+        trim(name);
+        trim(property);
+        trim(value);
+
+        auto [it, inserted] = indices.try_emplace(name, definitions.size());
+        if (inserted)
+        {
+            definitions.emplace_back();
+            definitions.back().name = name;
+        }
+        BlockDefinition& definition = definitions[it->second];
+
+        if (property == "opaque")
+        {
+            definition.opaque = value == "true";
+        }
+        else if (property == "solid")
+        {
+            definition.solid = value == "true";
+        }
+        else if (property == "light")
+        {
+            definition.lightEmission = static_cast<std::uint8_t>(std::clamp(std::atoi(value.c_str()), 0, 15));
+        }
+        else if (property == "layer")
+        {
+            definition.renderLayer = value == "translucent" ? RenderLayer::Translucent
+                                     : value == "cutout"    ? RenderLayer::Cutout
+                                                            : RenderLayer::Opaque;
+        }
+        else if (property.compare(0, 7, "texture") == 0 && ParseFaceMask(property.substr(7)) != 0)
+        {
+            const int faces = ParseFaceMask(property.substr(7));
+            for (int face = 0; face < 6; ++face)
+            {
+                if (faces & (1 << face))
+                    definition.faceTextures[face] = value;
+            }
+        }
+        else if (property.compare(0, 5, "color") == 0 && ParseFaceMask(property.substr(5)) != 0)
+        {
+            std::uint32_t color = 0;
+            if (!ParseColor(value, color))
+            {
+                std::cerr << "Warning: Invalid block color on line " << lineNumber << ": " << value << "\n";
+                continue;
+            }
+            const int faces = ParseFaceMask(property.substr(5));
+            for (int face = 0; face < 6; ++face)
+            {
+                if (faces & (1 << face))
+                    definition.faceColors[face] = color;
+            }
+        }
+        else
+        {
+            std::cerr << "Warning: Unknown block property on line " << lineNumber << ": " << property << "\n";
+        }
+    }
+
+    for (const BlockDefinition& definition : definitions)
+    {
+        Register(definition);
+    }
+
+    std::cout << "Loaded " << definitions.size() << " block types from: " << filename << std::endl;
+    return true;
+}
+
+BlockId BlockRegistry::Register(const BlockDefinition& definition)
+{
+    if (m_frozen)
+    {
+        std::cerr << "Block registry is frozen, cannot register " << definition.name << std::endl;
+        return BLOCK_AIR;
+    }
+    if (m_ids.count(definition.name) != 0)
+    {
+        std::cerr << "Block already registered: " << definition.name << std::endl;
+        return BLOCK_AIR;
+    }
+    if (GetBlockCount() >= std::numeric_limits<BlockId>::max())
+    {
+        std::cerr << "Too many block types, cannot register " << definition.name << std::endl;
+        return BLOCK_AIR;
+    }
+
+    // the unknown entry always stays last
+    const auto id = static_cast<BlockId>(m_definitions.size() - 1);
+    m_definitions.insert(m_definitions.end() - 1, definition);
+    m_ids[definition.name] = id;
+    return id;
+}
+
+void BlockRegistry::Freeze()
+{
+    BuildTables();
+    m_frozen = true;
+}
+
+BlockId BlockRegistry::GetId(const std::string& name) const
+{
+    const auto it = m_ids.find(name);
+    return it != m_ids.end() ? it->second : BLOCK_AIR;
+}
+
+void BlockRegistry::BuildTables()
+{
+    const std::size_t count = m_definitions.size();
+    const std::size_t words = (count + 63) / 64;
+
+    m_unknownIndex = count - 1;
+    m_textureNames.clear();
+    m_textureColors.clear();
+    m_opaque.assign(words, 0);
+    m_solid.assign(words, 0);
+    m_lightEmission.assign(count, 0);
+    m_renderLayers.assign(count, RenderLayer::Opaque);
+    m_faceTextures.assign(count * 6, 0);
+
+    for (std::size_t id = 0; id < count; ++id)
+    {
+        const BlockDefinition& definition = m_definitions[id];
+        if (definition.opaque)
+            m_opaque[id >> 6] |= std::uint64_t{1} << (id & 63);
+        if (definition.solid)
+            m_solid[id >> 6] |= std::uint64_t{1} << (id & 63);
+        m_lightEmission[id] = std::min(definition.lightEmission, MAX_LIGHT);
+        m_renderLayers[id] = definition.renderLayer;
+
+        for (int face = 0; face < 6; ++face)
+        {
+            if (definition.faceTextures[face].empty())
+                continue;
+
+            const std::uint16_t layer = GetTextureLayer(definition.faceTextures[face]);
+            m_faceTextures[id * 6 + face] = layer;
+            if (m_textureColors[layer] == BlockDefinition::NO_COLOR)
+                m_textureColors[layer] = definition.faceColors[face];
+        }
+    }
+
+    for (std::size_t layer = 0; layer < m_textureColors.size(); ++layer)
+    {
+        if (m_textureColors[layer] == BlockDefinition::NO_COLOR)
+            m_textureColors[layer] = HashColor(layer);
+    }
+}
+
+const std::string& BlockRegistry::GetTextureName(std::uint16_t layer) const
+{
+    static const std::string none;
+    return layer < m_textureNames.size() ? m_textureNames[layer] : none;
+}
+
+std::uint32_t BlockRegistry::GetTextureColor(std::uint16_t layer) const
+{
+    return layer < m_textureColors.size() ? m_textureColors[layer] : HashColor(layer);
+}
+
+std::uint16_t BlockRegistry::GetTextureLayer(const std::string& name)
+{
+    const auto it = std::find(m_textureNames.begin(), m_textureNames.end(), name);
+    if (it != m_textureNames.end())
+        return static_cast<std::uint16_t>(it - m_textureNames.begin());
+
+    m_textureNames.push_back(name);
+    m_textureColors.push_back(BlockDefinition::NO_COLOR);
+    return static_cast<std::uint16_t>(m_textureNames.size() - 1);
+}
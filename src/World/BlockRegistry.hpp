@@ -0,0 +1,149 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Chunk.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Which pass a block's faces are drawn in
+ */
+enum class RenderLayer : std::uint8_t
+{
+    Opaque,
+    Cutout,
+    Translucent
+};
+
+/**
+ * Everything the registry knows about a block type. Face textures and colours are in the
+ * mesher's face order (+X, -X, +Y, -Y, +Z, -Z).
+ */
+struct BlockDefinition
+{
+    static constexpr std::uint32_t NO_COLOR = 0xFFFFFFFF;
+
+    std::string name;
+    bool opaque = true;
+    bool solid = true;
+    std::uint8_t lightEmission = 0;
+    RenderLayer renderLayer = RenderLayer::Opaque;
+    std::array<std::string, 6> faceTextures;
+    std::array<std::uint32_t, 6> faceColors{NO_COLOR, NO_COLOR, NO_COLOR, NO_COLOR, NO_COLOR, NO_COLOR}; // 0xRRGGBB
+};
+
+/**
+ * Dense block ids and their properties.
+ *
+ * Blocks are registered at startup (usually from a definitions file), then the registry is
+ * frozen. Each property lives in its own flat array indexed by id (bitsets for the flags),
+ * so the mesher, lighting and physics hot loops read one word per lookup and never touch
+ * names. Ids past the last registered block read as one extra "unknown" entry that is
+ * opaque and solid, so corrupt data cannot index out of bounds.
+ *
+ * Air is always id 0, transparent and not solid.
+ */
+class BlockRegistry
+{
+public:
+    static constexpr std::uint8_t MAX_LIGHT = 15;
+
+    BlockRegistry();
+
+    /**
+     * Register every block of a definitions file. Lines are "name.property = value" with
+     * properties opaque, solid, light (0-15), layer (opaque, cutout, translucent), texture
+     * (all faces) and texture.top, texture.bottom, texture.side or texture.+x ... texture.-z,
+     * and the same face keys for color (#RRGGBB). Blocks get ids in order of first appearance.
+     * @return False if the file cannot be read or the registry is frozen
+     */
+    bool LoadFromFile(const std::string& filename);
+
+    /**
+     * Register one block
+     * @return Its id, or BLOCK_AIR if the name is taken, the registry is frozen or full
+     */
+    BlockId Register(const BlockDefinition& definition);
+
+    /**
+     * Build the lookup tables; no block can be registered afterwards
+     */
+    void Freeze();
+
+    [[nodiscard]] bool IsFrozen() const { return m_frozen; }
+
+    /**
+     * Id of a block by name, or BLOCK_AIR if it is not registered
+     */
+    [[nodiscard]] BlockId GetId(const std::string& name) const;
+
+    [[nodiscard]] const std::string& GetName(BlockId block) const
+    {
+        return m_definitions[std::min<std::size_t>(block, m_definitions.size() - 1)].name;
+    }
+    [[nodiscard]] std::size_t GetBlockCount() const { return m_definitions.size() - 1; }
+
+    /**
+     * Texture layers are assigned in order of first use; the name is the texture file stem.
+     * Layers past the last one have an empty name.
+     */
+    [[nodiscard]] std::size_t GetTextureCount() const { return m_textureNames.size(); }
+    [[nodiscard]] const std::string& GetTextureName(std::uint16_t layer) const;
+
+    /**
+     * Flat colour of a texture layer (0xRRGGBB): the first colour given for a face using it,
+     * else one derived from the layer so untinted textures still tell apart
+     */
+    [[nodiscard]] std::uint32_t GetTextureColor(std::uint16_t layer) const;
+
+    [[nodiscard]] bool IsOpaque(BlockId block) const { return TestBit(m_opaque, block); }
+    [[nodiscard]] bool IsSolid(BlockId block) const { return TestBit(m_solid, block); }
+    [[nodiscard]] std::uint8_t GetLightEmission(BlockId block) const { return m_lightEmission[Clamp(block)]; }
+    [[nodiscard]] RenderLayer GetRenderLayer(BlockId block) const { return m_renderLayers[Clamp(block)]; }
+
+    [[nodiscard]] std::uint16_t GetFaceTexture(BlockId block, int face) const
+    {
+        return m_faceTextures[Clamp(block) * 6 + face];
+    }
+
+private:
+    // the last definition is the "unknown block" every out of range id maps to
+    std::vector<BlockDefinition> m_definitions;
+    std::unordered_map<std::string, BlockId> m_ids;
+    std::vector<std::string> m_textureNames;
+    std::vector<std::uint32_t> m_textureColors;
+    bool m_frozen;
+
+    // lookup tables, built from the definitions on Freeze
+    std::size_t m_unknownIndex;
+    std::vector<std::uint64_t> m_opaque;
+    std::vector<std::uint64_t> m_solid;
+    std::vector<std::uint8_t> m_lightEmission;
+    std::vector<RenderLayer> m_renderLayers;
+    std::vector<std::uint16_t> m_faceTextures;
+
+    [[nodiscard]] std::size_t Clamp(BlockId block) const
+    {
+        return std::min<std::size_t>(block, m_unknownIndex);
+    }
+
+    [[nodiscard]] bool TestBit(const std::vector<std::uint64_t>& bits, BlockId block) const
+    {
+        const std::size_t index = Clamp(block);
+        return (bits[index >> 6] >> (index & 63)) & 1;
+    }
+
+    /**
+     * Rebuild the flat tables from the definitions
+     */
+    void BuildTables();
+
+    std::uint16_t GetTextureLayer(const std::string& name);
+};
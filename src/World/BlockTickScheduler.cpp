@@ -0,0 +1,368 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "BlockTickScheduler.hpp"
+
+#include "Core/JobSystem.hpp"
+#include "Core/Memory/TransientMemory.hpp"
+#include "Core/Profiling/Profiler.hpp"
+#include "World.hpp"
+
+#include <algorithm>
+
+namespace
+{
+/**
+ * 28 bits each for x and z, 8 for y (WORLD_HEIGHT is 256)
+ */
+std::uint64_t PositionKey(int x, int y, int z)
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x) & 0xFFFFFFF) << 36) |
+           (static_cast<std::uint64_t>(static_cast<std::uint32_t>(z) & 0xFFFFFFF) << 8) |
+           static_cast<std::uint64_t>(y & 0xFF);
+}
+
+std::uint32_t SeedRandom(const ChunkCoord& coord)
+{
+    // xorshift must not start at zero
+    const auto seed = static_cast<std::uint32_t>(ChunkCoordHash{}(coord) * 0x9E3779B97F4A7C15ull >> 32);
+    return seed != 0 ? seed : 0x6D2B79F5u;
+}
+} // namespace
+
+Chunk* BlockTickContext::Locate(int x, int y, int z) const
+{
+    const int dx = BlockToChunk(x) - m_column.x + 1;
+    const int dz = BlockToChunk(z) - m_column.z + 1;
+    const int cy = BlockToChunk(y);
+    if (static_cast<unsigned>(dx) >= NEIGHBORHOOD || static_cast<unsigned>(dz) >= NEIGHBORHOOD ||
+        static_cast<unsigned>(cy) >= WORLD_HEIGHT_CHUNKS)
+        return nullptr;
+
+    return m_chunks[(dx * NEIGHBORHOOD + dz) * WORLD_HEIGHT_CHUNKS + cy];
+}
+
+BlockId BlockTickContext::GetBlock(int x, int y, int z) const
+{
+    const Chunk* chunk = Locate(x, y, z);
+    return chunk ? chunk->GetBlock(BlockToLocal(x), BlockToLocal(y), BlockToLocal(z)) : BLOCK_AIR;
+}
+
+bool BlockTickContext::SetBlock(int x, int y, int z, BlockId block)
+{
+    Chunk* chunk = Locate(x, y, z);
+    if (!chunk)
+        return false;
+
+    const int index = Chunk::Index(BlockToLocal(x), BlockToLocal(y), BlockToLocal(z));
+    const BlockId oldBlock = chunk->GetBlock(index);
+    if (oldBlock != block)
+    {
+        chunk->SetBlock(index, block);
+        m_changes.push_back({x, y, z, oldBlock, block});
+    }
+    return true;
+}
+
+void BlockTickContext::ScheduleTick(int x, int y, int z, std::uint32_t delay)
+{
+    m_requests.push_back({x, y, z, delay});
+}
+
+std::uint32_t BlockTickContext::NextRandom()
+{
+    std::uint32_t state = *m_random;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    *m_random = state;
+    return state;
+}
+
+BlockTickScheduler::BlockTickScheduler(World& world)
+    : m_world(world)
+    , m_hasRandomHandlers(false)
+    , m_tick(0)
+    , m_accumulator(0.0f)
+{
+}
+
+void BlockTickScheduler::SetScheduledHandler(BlockId block, TickHandler handler)
+{
+    if (m_scheduledHandlers.size() <= block)
+        m_scheduledHandlers.resize(static_cast<std::size_t>(block) + 1);
+    m_scheduledHandlers[block] = std::move(handler);
+}
+
+void BlockTickScheduler::SetRandomHandler(BlockId block, TickHandler handler)
+{
+    if (m_randomHandlers.size() <= block)
+        m_randomHandlers.resize(static_cast<std::size_t>(block) + 1);
+    m_randomHandlers[block] = std::move(handler);
+    m_hasRandomHandlers = std::any_of(m_randomHandlers.begin(), m_randomHandlers.end(),
+                                      [](const TickHandler& h) { return static_cast<bool>(h); });
+}
+
+void BlockTickScheduler::AddColumns(const std::vector<ChunkCoord>& columns)
+{
+    for (const ChunkCoord& coord : columns)
+    {
+        const std::uint64_t key = ColumnKey(coord.x, coord.z);
+        if (const auto [it, inserted] = m_columns.try_emplace(key); inserted)
+        {
+            for (int y = 0; y < WORLD_HEIGHT_CHUNKS; ++y)
+            {
+                it->second.random[y] = SeedRandom({coord.x, y, coord.z});
+            }
+        }
+
+        // overdue ticks fire on the next step
+        if (const auto parked = m_parked.find(key); parked != m_parked.end())
+        {
+            for (ScheduledTick tick : parked->second)
+            {
+                tick.dueTick = std::max(tick.dueTick, m_tick + 1);
+                InsertIntoWheel(tick);
+            }
+            m_parked.erase(parked);
+        }
+    }
+}
+
+void BlockTickScheduler::RemoveColumns(const std::vector<ChunkCoord>& columns)
+{
+    for (const ChunkCoord& coord : columns)
+    {
+        m_columns.erase(ColumnKey(coord.x, coord.z));
+    }
+}
+
+void BlockTickScheduler::ScheduleTick(int x, int y, int z, std::uint32_t delay)
+{
+    if (y < 0 || y >= WORLD_HEIGHT)
+        return;
+    if (!m_pendingPositions.insert(PositionKey(x, y, z)).second)
+        return;
+
+    InsertIntoWheel({x, y, z, m_world.GetBlock(x, y, z), m_tick + std::max<std::uint32_t>(delay, 1)});
+}
+
+std::size_t BlockTickScheduler::GetParkedTickCount() const
+{
+    std::size_t count = 0;
+    for (const auto& [key, ticks] : m_parked)
+    {
+        count += ticks.size();
+    }
+    return count;
+}
+
+int BlockTickScheduler::Update(JobSystem& jobs, float deltaTime)
+{
+    constexpr float STEP = 1.0f / TICKS_PER_SECOND;
+
+    m_changes.clear();
+    m_accumulator += deltaTime;
+
+    int steps = 0;
+    while (m_accumulator >= STEP && steps < MAX_TICKS_PER_UPDATE)
+    {
+        Step(jobs);
+        m_accumulator -= STEP;
+        ++steps;
+    }
+
+    // drop the backlog rather than falling further behind every frame
+    if (steps == MAX_TICKS_PER_UPDATE)
+        m_accumulator = std::min(m_accumulator, STEP);
+    return steps;
+}
+
+void BlockTickScheduler::Tick(JobSystem& jobs)
+{
+    m_changes.clear();
+    Step(jobs);
+}
+
+void BlockTickScheduler::InsertIntoWheel(const ScheduledTick& tick)
+{
+    const std::uint64_t difference = tick.dueTick ^ m_tick;
+
+    int level = 0;
+    while (level < WHEEL_LEVELS - 1 && (difference >> (WHEEL_BITS * (level + 1))) != 0)
+    {
+        ++level;
+    }
+
+    std::uint64_t slot = tick.dueTick >> (WHEEL_BITS * level);
+    if ((difference >> (WHEEL_BITS * WHEEL_LEVELS)) != 0)
+    {
+        // due after the top level wraps around (however close): wait in top slot 0, which
+        // cascades exactly at the wrap, and pick the level again from there
+        slot = 0;
+    }
+    m_wheel[level][slot & (WHEEL_SLOTS - 1)].push_back(tick);
+}
+
+void BlockTickScheduler::Cascade(int level)
+{
+    const std::size_t slot = (m_tick >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1);
+    m_cascading.swap(m_wheel[level][slot]);
+    for (const ScheduledTick& tick : m_cascading)
+    {
+        InsertIntoWheel(tick);
+    }
+    m_cascading.clear();
+}
+
+BlockTickScheduler::ColumnTask& BlockTickScheduler::GetTask(TaskIndex& taskIndex, std::uint64_t columnKey,
+                                                            ColumnState& state, std::size_t& taskCount)
+{
+    const auto [it, inserted] = taskIndex.try_emplace(columnKey, taskCount);
+    if (inserted)
+    {
+        if (m_tasks.size() <= taskCount)
+            m_tasks.emplace_back();
+
+        ColumnTask& task = m_tasks[taskCount++];
+        task.column = {static_cast<int>(columnKey >> 32), 0, static_cast<int>(columnKey & 0xFFFFFFFF)};
+        task.state = &state;
+        task.due.clear();
+    }
+    return m_tasks[it->second];
+}
+
+void BlockTickScheduler::Step(JobSystem& jobs)
+{
+    ++m_tick;
+
+    // higher levels first so a tick can fall through several levels in one step
+    for (int level = WHEEL_LEVELS - 1; level > 0; --level)
+    {
+        if ((m_tick & ((std::uint64_t{1} << (WHEEL_BITS * level)) - 1)) == 0)
+            Cascade(level);
+    }
+    m_firing.swap(m_wheel[0][m_tick & (WHEEL_SLOTS - 1)]);
+
+    // bucket due ticks by column; ticks of unloaded columns wait until the column is back
+    ScratchScope scratch;
+    TaskIndex taskIndex(&scratch.GetArena());
+    std::size_t taskCount = 0;
+    for (const ScheduledTick& tick : m_firing)
+    {
+        const std::uint64_t key = ColumnKey(BlockToChunk(tick.x), BlockToChunk(tick.z));
+        const auto column = m_columns.find(key);
+        if (column == m_columns.end())
+        {
+            m_parked[key].push_back(tick);
+            continue;
+        }
+        m_pendingPositions.erase(PositionKey(tick.x, tick.y, tick.z));
+        GetTask(taskIndex, key, column->second, taskCount).due.push_back(tick);
+    }
+    m_firing.clear();
+
+    if (m_hasRandomHandlers)
+    {
+        for (auto& [key, state] : m_columns)
+        {
+            GetTask(taskIndex, key, state, taskCount);
+        }
+    }
+    if (taskCount == 0)
+        return;
+
+    // sorted within a colour so results do not depend on hash map order
+    std::pmr::vector<std::pmr::vector<std::size_t>> buckets(9, &scratch.GetArena());
+    for (std::size_t i = 0; i < taskCount; ++i)
+    {
+        buckets[ColumnColor(m_tasks[i].column.x, m_tasks[i].column.z)].push_back(i);
+    }
+
+    for (std::pmr::vector<std::size_t>& bucket : buckets)
+    {
+        std::sort(bucket.begin(), bucket.end(), [&](std::size_t a, std::size_t b) {
+            const ChunkCoord& ca = m_tasks[a].column;
+            const ChunkCoord& cb = m_tasks[b].column;
+            return ca.x != cb.x ? ca.x < cb.x : ca.z < cb.z;
+        });
+
+        jobs.ParallelFor(bucket.size(), 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                RunColumn(m_tasks[bucket[i]]);
+            }
+        });
+    }
+
+    for (const std::pmr::vector<std::size_t>& bucket : buckets)
+    {
+        for (const std::size_t i : bucket)
+        {
+            BlockTickContext& context = m_tasks[i].context;
+            m_changes.insert(m_changes.end(), context.m_changes.begin(), context.m_changes.end());
+            for (const BlockTickContext::TickRequest& request : context.m_requests)
+            {
+                ScheduleTick(request.x, request.y, request.z, request.delay);
+            }
+            context.m_changes.clear();
+            context.m_requests.clear();
+        }
+    }
+}
+
+void BlockTickScheduler::RunColumn(ColumnTask& task)
+{
+    PROFILE_SCOPE("TickColumn");
+    BlockTickContext& context = task.context;
+    context.m_column = task.column;
+    context.m_tick = m_tick;
+    for (int dx = 0; dx < BlockTickContext::NEIGHBORHOOD; ++dx)
+    {
+        for (int dz = 0; dz < BlockTickContext::NEIGHBORHOOD; ++dz)
+        {
+            for (int y = 0; y < WORLD_HEIGHT_CHUNKS; ++y)
+            {
+                context.m_chunks[(dx * BlockTickContext::NEIGHBORHOOD + dz) * WORLD_HEIGHT_CHUNKS + y] =
+                    m_world.GetChunk({task.column.x + dx - 1, y, task.column.z + dz - 1});
+            }
+        }
+    }
+
+    for (const ScheduledTick& tick : task.due)
+    {
+        const BlockId block = context.GetBlock(tick.x, tick.y, tick.z);
+        if (block != tick.block || block >= m_scheduledHandlers.size() || !m_scheduledHandlers[block])
+            continue;
+
+        context.m_random = &task.state->random[BlockToChunk(tick.y)];
+        m_scheduledHandlers[block](context, tick.x, tick.y, tick.z, block);
+    }
+
+    if (!m_hasRandomHandlers)
+        return;
+
+    const int baseX = task.column.x * Chunk::SIZE;
+    const int baseZ = task.column.z * Chunk::SIZE;
+    for (int cy = 0; cy < WORLD_HEIGHT_CHUNKS; ++cy)
+    {
+        const Chunk* chunk = context.m_chunks[(1 * BlockTickContext::NEIGHBORHOOD + 1) * WORLD_HEIGHT_CHUNKS + cy];
+        if (!chunk)
+            continue;
+
+        context.m_random = &task.state->random[cy];
+        for (int i = 0; i < RANDOM_TICKS_PER_CHUNK; ++i)
+        {
+            const int index = static_cast<int>(context.NextRandom() & (Chunk::VOLUME - 1));
+            const BlockId block = chunk->GetBlock(index);
+            if (block >= m_randomHandlers.size() || !m_randomHandlers[block])
+                continue;
+
+            const int x = baseX + (index & Chunk::MASK);
+            const int z = baseZ + ((index >> Chunk::SIZE_BITS) & Chunk::MASK);
+            const int y = cy * Chunk::SIZE + (index >> (2 * Chunk::SIZE_BITS));
+            m_randomHandlers[block](context, x, y, z, block);
+        }
+    }
+}
@@ -0,0 +1,218 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Chunk.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class JobSystem;
+class World;
+
+/**
+ * A block edit made by a simulation step, for systems that react to changes (lighting)
+ */
+struct BlockChange
+{
+    int x, y, z;
+    BlockId oldBlock;
+    BlockId newBlock;
+};
+
+/**
+ * What a tick handler may do. A handler runs on a worker thread and owns the 3x3 columns
+ * around the column being ticked; reads outside them see air and writes are dropped.
+ */
+class BlockTickContext
+{
+public:
+    [[nodiscard]] BlockId GetBlock(int x, int y, int z) const;
+
+    /**
+     * Change a block in the world
+     * @return False if the block is outside the owned area or not loaded
+     */
+    bool SetBlock(int x, int y, int z, BlockId block);
+
+    /**
+     * Request a scheduled tick for the block at a position after delay ticks (at least 1)
+     */
+    void ScheduleTick(int x, int y, int z, std::uint32_t delay);
+
+    [[nodiscard]] std::uint64_t GetTick() const { return m_tick; }
+
+    /**
+     * Next value of the ticked column's random generator
+     */
+    std::uint32_t NextRandom();
+
+private:
+    friend class BlockTickScheduler;
+
+    struct TickRequest
+    {
+        int x, y, z;
+        std::uint32_t delay;
+    };
+
+    static constexpr int NEIGHBORHOOD = 3;
+
+    // chunks of the owned columns, indexed [dx + 1][dz + 1][y]
+    std::array<Chunk*, NEIGHBORHOOD * NEIGHBORHOOD * WORLD_HEIGHT_CHUNKS> m_chunks{};
+    ChunkCoord m_column;
+    std::uint64_t m_tick = 0;
+    std::uint32_t* m_random = nullptr;
+    std::vector<BlockChange> m_changes;
+    std::vector<TickRequest> m_requests;
+
+    [[nodiscard]] Chunk* Locate(int x, int y, int z) const;
+};
+
+/**
+ * Fixed-step block updates: scheduled ticks (falling blocks, crops, fluid steps) and random
+ * ticks.
+ *
+ * Scheduled ticks live in a 4 level hierarchical timing wheel of 64 slots per level, so
+ * scheduling and firing are O(1) however far ahead a tick is. Due ticks are bucketed per
+ * column; ticks whose column is not loaded are parked by column until it is added again,
+ * so unloaded parts of the world cost nothing per tick. Every loaded chunk also gets a few
+ * random ticks per step from its own xorshift generator.
+ *
+ * Columns are processed in 9 colour phases (x mod 3, z mod 3), like the light engine: a
+ * handler may touch the columns next to its own and same-coloured columns never share one,
+ * so each phase runs in parallel without locks. Edits are applied to the world right away
+ * and collected for GetChanges.
+ */
+class BlockTickScheduler
+{
+public:
+    using TickHandler = std::function<void(BlockTickContext& context, int x, int y, int z, BlockId block)>;
+
+    static constexpr int TICKS_PER_SECOND = 20;
+    static constexpr int RANDOM_TICKS_PER_CHUNK = 3;
+    // caps the catch-up after a long frame instead of stalling further
+    static constexpr int MAX_TICKS_PER_UPDATE = 4;
+
+    explicit BlockTickScheduler(World& world);
+
+    BlockTickScheduler(const BlockTickScheduler&) = delete;
+    BlockTickScheduler& operator=(const BlockTickScheduler&) = delete;
+
+    /**
+     * Set the handler run when a scheduled tick fires on a block of this type
+     */
+    void SetScheduledHandler(BlockId block, TickHandler handler);
+
+    /**
+     * Set the handler run when a random tick lands on a block of this type
+     */
+    void SetRandomHandler(BlockId block, TickHandler handler);
+
+    /**
+     * Register loaded columns (chunk y ignored); ticks parked for them are resumed
+     */
+    void AddColumns(const std::vector<ChunkCoord>& columns);
+
+    /**
+     * Stop ticking columns that are about to be unloaded; their pending ticks are parked
+     */
+    void RemoveColumns(const std::vector<ChunkCoord>& columns);
+
+    /**
+     * Schedule a tick for the block at a position. The tick only fires if the block there is
+     * still the same type, and a position has at most one pending tick.
+     * @param delay Ticks from now, at least 1
+     */
+    void ScheduleTick(int x, int y, int z, std::uint32_t delay);
+
+    /**
+     * Advance by the fixed steps that fit into the elapsed time
+     * @return Number of steps run
+     */
+    int Update(JobSystem& jobs, float deltaTime);
+
+    /**
+     * Run exactly one step, regardless of elapsed time
+     */
+    void Tick(JobSystem& jobs);
+
+    /**
+     * Block edits made by the steps of the last Update or Tick call
+     */
+    [[nodiscard]] const std::vector<BlockChange>& GetChanges() const { return m_changes; }
+
+    [[nodiscard]] std::uint64_t GetCurrentTick() const { return m_tick; }
+    [[nodiscard]] std::size_t GetPendingTickCount() const { return m_pendingPositions.size(); }
+    [[nodiscard]] std::size_t GetParkedTickCount() const;
+
+private:
+    struct ScheduledTick
+    {
+        int x, y, z;
+        BlockId block;
+        std::uint64_t dueTick;
+    };
+
+    struct ColumnState
+    {
+        std::array<std::uint32_t, WORLD_HEIGHT_CHUNKS> random{};
+    };
+
+    /**
+     * Work for one column in one step
+     */
+    struct ColumnTask
+    {
+        ChunkCoord column;
+        ColumnState* state = nullptr;
+        std::vector<ScheduledTick> due;
+        BlockTickContext context;
+    };
+
+    // column key to index in m_tasks, rebuilt every step in scratch memory
+    using TaskIndex = std::pmr::unordered_map<std::uint64_t, std::size_t>;
+
+    static constexpr int WHEEL_BITS = 6;
+    static constexpr int WHEEL_SLOTS = 1 << WHEEL_BITS;
+    static constexpr int WHEEL_LEVELS = 4;
+
+    World& m_world;
+    std::vector<TickHandler> m_scheduledHandlers;
+    std::vector<TickHandler> m_randomHandlers;
+    bool m_hasRandomHandlers;
+
+    std::uint64_t m_tick;
+    float m_accumulator;
+    std::array<std::array<std::vector<ScheduledTick>, WHEEL_SLOTS>, WHEEL_LEVELS> m_wheel;
+    std::unordered_set<std::uint64_t> m_pendingPositions;
+    std::unordered_map<std::uint64_t, std::vector<ScheduledTick>> m_parked;
+
+    std::unordered_map<std::uint64_t, ColumnState> m_columns;
+
+    // reused across steps
+    std::vector<ColumnTask> m_tasks;
+    std::vector<ScheduledTick> m_firing;
+    std::vector<ScheduledTick> m_cascading;
+    std::vector<BlockChange> m_changes;
+
+    /**
+     * Put a tick into the wheel slot of the highest level whose digit differs from the
+     * current tick; cascading moves it down a level each time that digit comes up
+     */
+    void InsertIntoWheel(const ScheduledTick& tick);
+
+    void Cascade(int level);
+
+    void Step(JobSystem& jobs);
+
+    ColumnTask& GetTask(TaskIndex& taskIndex, std::uint64_t columnKey, ColumnState& state, std::size_t& taskCount);
+
+    void RunColumn(ColumnTask& task);
+};
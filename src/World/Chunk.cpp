@@ -0,0 +1,90 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "Chunk.hpp"
+
+#include <algorithm>
+
+namespace
+{
+// about 3 MB per page
+constexpr std::size_t CHUNKS_PER_PAGE = 32;
+
+PoolResource& ChunkPool()
+{
+    static PoolResource pool(sizeof(Chunk), alignof(Chunk), CHUNKS_PER_PAGE);
+    return pool;
+}
+} // namespace
+
+Chunk::Chunk(ChunkCoord coord)
+    : m_coord(coord)
+    , m_dirty(true)
+    , m_dirtyList(nullptr)
+    , m_lightReady(false)
+{
+}
+
+void* Chunk::operator new(std::size_t size)
+{
+    return ChunkPool().allocate(size, alignof(Chunk));
+}
+
+void Chunk::operator delete(void* pointer, std::size_t size)
+{
+    ChunkPool().deallocate(pointer, size, alignof(Chunk));
+}
+
+const PoolResource& Chunk::GetPool()
+{
+    return ChunkPool();
+}
+
+void Chunk::SetBlock(int x, int y, int z, BlockId block)
+{
+    SetBlock(Index(x, y, z), block);
+}
+
+void Chunk::SetBlock(int index, BlockId block)
+{
+    if (m_blocks[index] == block)
+        return;
+
+    m_blocks[index] = block;
+    SetDirty(true);
+}
+
+void Chunk::Fill(BlockId block)
+{
+    m_blocks.fill(block);
+    SetDirty(true);
+}
+
+void Chunk::SetDirty(bool dirty)
+{
+    if (!dirty)
+    {
+        m_dirty.store(false, std::memory_order_relaxed);
+        return;
+    }
+
+    // edits land here once per block; only the first one since the last drain does any work
+    if (m_dirty.load(std::memory_order_relaxed))
+        return;
+    if (!m_dirty.exchange(true, std::memory_order_relaxed) && m_dirtyList)
+        m_dirtyList->Push(m_coord);
+}
+
+void Chunk::SetDirtyList(DirtyChunkList* list)
+{
+    m_dirtyList = list;
+    if (m_dirtyList && IsDirty())
+        m_dirtyList->Push(m_coord);
+}
+
+bool Chunk::IsEmpty() const
+{
+    return std::all_of(m_blocks.begin(), m_blocks.end(),
+                       [](BlockId block) { return block == BLOCK_AIR; });
+}
@@ -0,0 +1,238 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Core/Memory/PoolResource.hpp"
+#include "NibbleArray.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+using BlockId = std::uint16_t;
+
+constexpr BlockId BLOCK_AIR = 0;
+
+/**
+ * Height of the world in chunks; chunk y coordinates run from 0 to WORLD_HEIGHT_CHUNKS - 1
+ */
+constexpr int WORLD_HEIGHT_CHUNKS = 8;
+
+/**
+ * Integer coordinate of a chunk in chunk space (block coordinate / Chunk::SIZE).
+ */
+struct ChunkCoord
+{
+    int x{}, y{}, z{};
+
+    bool operator==(const ChunkCoord& other) const
+    {
+        return x == other.x && y == other.y && z == other.z;
+    }
+
+    bool operator!=(const ChunkCoord& other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator<(const ChunkCoord& other) const
+    {
+        if (x != other.x)
+            return x < other.x;
+        if (y != other.y)
+            return y < other.y;
+        return z < other.z;
+    }
+};
+
+struct ChunkCoordHash
+{
+    std::size_t operator()(const ChunkCoord& coord) const
+    {
+        // large primes from the classic spatial hashing paper (Teschner et al.)
+        const auto h = static_cast<std::uint64_t>(coord.x) * 73856093ull ^
+                       static_cast<std::uint64_t>(coord.y) * 19349663ull ^
+                       static_cast<std::uint64_t>(coord.z) * 83492791ull;
+        return static_cast<std::size_t>(h);
+    }
+};
+
+/**
+ * Coordinates of chunks that became dirty, pushed from any thread (lighting jobs flag chunks
+ * too) and drained by whoever consumes the changes. A chunk is pushed when its flag goes
+ * from clean to dirty, so repeated edits between drains list it once.
+ */
+class DirtyChunkList
+{
+public:
+    void Push(const ChunkCoord& coord)
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_coords.push_back(coord);
+    }
+
+    /**
+     * Append every listed coordinate to coords and empty the list
+     */
+    void TakeAll(std::vector<ChunkCoord>& coords)
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        coords.insert(coords.end(), m_coords.begin(), m_coords.end());
+        m_coords.clear();
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<ChunkCoord> m_coords;
+};
+
+/**
+ * Dense cubic block storage. Blocks are laid out x-fastest, then z, then y so that
+ * horizontal slices are contiguous, which is what both terrain generation and
+ * meshing walk over.
+ */
+class Chunk
+{
+public:
+    static constexpr int SIZE_BITS = 5;
+    static constexpr int SIZE = 1 << SIZE_BITS;
+    static constexpr int MASK = SIZE - 1;
+    static constexpr int AREA = SIZE * SIZE;
+    static constexpr int VOLUME = SIZE * SIZE * SIZE;
+
+    explicit Chunk(ChunkCoord coord = {});
+
+    /**
+     * Chunks are allocated from a shared pool, so columns that unload and regenerate reuse
+     * the same memory instead of going back to the heap
+     */
+    static void* operator new(std::size_t size);
+    static void operator delete(void* pointer, std::size_t size);
+
+    [[nodiscard]] static const PoolResource& GetPool();
+
+    [[nodiscard]] const ChunkCoord& GetCoord() const { return m_coord; }
+
+    static constexpr int Index(int x, int y, int z)
+    {
+        return x | (z << SIZE_BITS) | (y << (2 * SIZE_BITS));
+    }
+
+    static constexpr bool InBounds(int x, int y, int z)
+    {
+        return static_cast<unsigned>(x) < SIZE && static_cast<unsigned>(y) < SIZE &&
+               static_cast<unsigned>(z) < SIZE;
+    }
+
+    [[nodiscard]] BlockId GetBlock(int x, int y, int z) const { return m_blocks[Index(x, y, z)]; }
+    [[nodiscard]] BlockId GetBlock(int index) const { return m_blocks[index]; }
+
+    void SetBlock(int x, int y, int z, BlockId block);
+    void SetBlock(int index, BlockId block);
+
+    /**
+     * Overwrite every block in the chunk with a single value
+     */
+    void Fill(BlockId block);
+
+    /**
+     * Check whether the chunk contains only air
+     */
+    [[nodiscard]] bool IsEmpty() const;
+
+    [[nodiscard]] const BlockId* GetData() const { return m_blocks.data(); }
+    [[nodiscard]] BlockId* GetData() { return m_blocks.data(); }
+
+    /**
+     * 4-bit sky and block light, indexed like the blocks. Light is meaningless until the
+     * light engine has lit the chunk (IsLightReady).
+     */
+    [[nodiscard]] std::uint8_t GetSkyLight(int index) const { return m_skyLight.Get(index); }
+    [[nodiscard]] std::uint8_t GetBlockLight(int index) const { return m_blockLight.Get(index); }
+
+    void SetSkyLight(int index, std::uint8_t level) { m_skyLight.Set(index, level); }
+    void SetBlockLight(int index, std::uint8_t level) { m_blockLight.Set(index, level); }
+
+    void FillSkyLight(std::uint8_t level) { m_skyLight.Fill(level); }
+    void FillBlockLight(std::uint8_t level) { m_blockLight.Fill(level); }
+
+    [[nodiscard]] bool IsLightReady() const { return m_lightReady; }
+    void SetLightReady(bool ready) { m_lightReady = ready; }
+
+    /**
+     * Dirty flag set by every edit, cleared by whoever consumes the change (e.g. the mesher).
+     * Atomic because lighting jobs may flag a neighbouring chunk they do not own.
+     */
+    [[nodiscard]] bool IsDirty() const { return m_dirty.load(std::memory_order_relaxed); }
+    void SetDirty(bool dirty);
+
+    /**
+     * List to push the chunk onto when it becomes dirty; set by the owning World. A chunk
+     * that is already dirty is pushed right away.
+     */
+    void SetDirtyList(DirtyChunkList* list);
+
+private:
+    ChunkCoord m_coord;
+    std::array<BlockId, VOLUME> m_blocks{};
+    NibbleArray<VOLUME> m_skyLight;
+    NibbleArray<VOLUME> m_blockLight;
+    std::atomic<bool> m_dirty;
+    DirtyChunkList* m_dirtyList;
+    bool m_lightReady;
+};
+
+/**
+ * Height of the world in blocks
+ */
+constexpr int WORLD_HEIGHT = WORLD_HEIGHT_CHUNKS * Chunk::SIZE;
+
+/**
+ * Floor division of a block coordinate into chunk space (works for negative values)
+ */
+constexpr int BlockToChunk(int blockCoord)
+{
+    return blockCoord >> Chunk::SIZE_BITS;
+}
+
+/**
+ * Position of a block coordinate inside its chunk
+ */
+constexpr int BlockToLocal(int blockCoord)
+{
+    return blockCoord & Chunk::MASK;
+}
+
+constexpr ChunkCoord BlockToChunkCoord(int x, int y, int z)
+{
+    return {BlockToChunk(x), BlockToChunk(y), BlockToChunk(z)};
+}
+
+/**
+ * The six face neighbours as {dx, dy, dz}; index 3 is straight down
+ */
+constexpr int NEIGHBOR_DIRECTIONS[6][3] = {
+    {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1},
+};
+
+/**
+ * Packs a chunk column's x and z into one hash map key
+ */
+constexpr std::uint64_t ColumnKey(int chunkX, int chunkZ)
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(chunkX)) << 32) |
+           static_cast<std::uint32_t>(chunkZ);
+}
+
+/**
+ * One of nine colours in a 3x3 tiling of columns; columns of the same colour are never
+ * neighbours, so their updates can run in parallel
+ */
+constexpr int ColumnColor(int chunkX, int chunkZ)
+{
+    return (((chunkX % 3) + 3) % 3) * 3 + ((chunkZ % 3) + 3) % 3;
+}
@@ -0,0 +1,135 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "ChunkLod.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+/**
+ * Halve a cubic grid of size sourceSize (x fastest, then z, then y) into dest
+ */
+void Downsample(const BlockId* source, int sourceSize, BlockId* dest)
+{
+    const int destSize = sourceSize / 2;
+    auto at = [&](int x, int y, int z) { return source[x + z * sourceSize + y * sourceSize * sourceSize]; };
+
+    for (int y = 0; y < destSize; ++y)
+    {
+        for (int z = 0; z < destSize; ++z)
+        {
+            for (int x = 0; x < destSize; ++x)
+            {
+                int solid = 0;
+                BlockId surface[4];
+                int surfaceCount = 0;
+
+                for (int dz = 0; dz < 2; ++dz)
+                {
+                    for (int dx = 0; dx < 2; ++dx)
+                    {
+                        const BlockId top = at(2 * x + dx, 2 * y + 1, 2 * z + dz);
+                        const BlockId bottom = at(2 * x + dx, 2 * y, 2 * z + dz);
+                        solid += (top != BLOCK_AIR) + (bottom != BLOCK_AIR);
+
+                        if (top != BLOCK_AIR)
+                            surface[surfaceCount++] = top;
+                        else if (bottom != BLOCK_AIR)
+                            surface[surfaceCount++] = bottom;
+                    }
+                }
+
+                BlockId block = BLOCK_AIR;
+                if (solid >= 4)
+                {
+                    int bestCount = 0;
+                    for (int i = 0; i < surfaceCount; ++i)
+                    {
+                        const int count = static_cast<int>(std::count(surface, surface + surfaceCount, surface[i]));
+                        if (count > bestCount)
+                        {
+                            bestCount = count;
+                            block = surface[i];
+                        }
+                    }
+                }
+                dest[x + z * destSize + y * destSize * destSize] = block;
+            }
+        }
+    }
+}
+} // namespace
+
+ChunkLod::ChunkLod(const Chunk& chunk)
+    : m_coord(chunk.GetCoord())
+{
+    const BlockId* source = chunk.GetData();
+    for (int level = 1; level <= MAX_LEVEL; ++level)
+    {
+        const int size = GetSize(level);
+        std::vector<BlockId>& dest = m_levels[level - 1];
+        dest.resize(static_cast<std::size_t>(size) * size * size);
+        Downsample(source, GetSize(level - 1), dest.data());
+        source = dest.data();
+    }
+}
+
+std::size_t ChunkLod::GetMemoryUsage() const
+{
+    std::size_t bytes = sizeof(ChunkLod);
+    for (const std::vector<BlockId>& level : m_levels)
+    {
+        bytes += level.capacity() * sizeof(BlockId);
+    }
+    return bytes;
+}
+
+int ChunkLod::SelectLevel(float distance, int renderDistance, int currentLevel)
+{
+    constexpr float HYSTERESIS = 0.5f;
+    const auto bandWidth = static_cast<float>(std::max(renderDistance, 1));
+
+    int level = 0;
+    while (level < MAX_LEVEL && distance > bandWidth * static_cast<float>(level + 1))
+    {
+        ++level;
+    }
+
+    if (currentLevel >= 0 && std::abs(level - currentLevel) == 1)
+    {
+        const float boundary = bandWidth * static_cast<float>(std::max(level, currentLevel));
+        if (std::abs(distance - boundary) < HYSTERESIS)
+            return currentLevel;
+    }
+    return level;
+}
+
+const ChunkLod* LodStore::Get(const ChunkCoord& coord) const
+{
+    const auto it = m_chunks.find(coord);
+    return it != m_chunks.end() ? it->second.get() : nullptr;
+}
+
+void LodStore::Insert(std::unique_ptr<ChunkLod> lod)
+{
+    const ChunkCoord coord = lod->GetCoord();
+    m_chunks[coord] = std::move(lod);
+}
+
+void LodStore::Remove(const ChunkCoord& coord)
+{
+    m_chunks.erase(coord);
+}
+
+std::size_t LodStore::GetMemoryUsage() const
+{
+    std::size_t bytes = 0;
+    for (const auto& [coord, lod] : m_chunks)
+    {
+        bytes += lod->GetMemoryUsage();
+    }
+    return bytes;
+}
@@ -0,0 +1,84 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Chunk.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Downsampled copies of a chunk at 2x, 4x and 8x (16^3, 8^3 and 4^3 cells), about 9 KB in
+ * total against 96 KB for the full chunk, so far terrain can be kept without its voxels.
+ *
+ * Each level halves the previous one. A coarse cell is solid when at least half of its 8
+ * children are (so one-block floors and walls survive), and takes the most common block
+ * among the topmost solid child of each of its 4 sub-columns, which keeps surface blocks
+ * such as grass from being replaced by the stone underneath.
+ */
+class ChunkLod
+{
+public:
+    static constexpr int MAX_LEVEL = 3;
+
+    /**
+     * Build every level from a full resolution chunk
+     */
+    explicit ChunkLod(const Chunk& chunk);
+
+    [[nodiscard]] const ChunkCoord& GetCoord() const { return m_coord; }
+
+    /**
+     * Cells per axis at a level (level 0 is the full chunk)
+     */
+    static constexpr int GetSize(int level) { return Chunk::SIZE >> level; }
+
+    /**
+     * Get a cell of a level in 1..MAX_LEVEL
+     */
+    [[nodiscard]] BlockId GetBlock(int level, int x, int y, int z) const
+    {
+        const int size = GetSize(level);
+        return m_levels[level - 1][x + z * size + y * size * size];
+    }
+
+    [[nodiscard]] std::size_t GetMemoryUsage() const;
+
+    /**
+     * Pick the level for a chunk at the given horizontal distance (in chunks) from the
+     * camera. Level l covers distances up to (l + 1) * renderDistance; a chunk keeps its
+     * current level until it is half a chunk past a boundary so levels do not flicker.
+     * @param currentLevel Level the chunk is drawn at now, or -1 if it is not drawn yet
+     */
+    static int SelectLevel(float distance, int renderDistance, int currentLevel);
+
+private:
+    ChunkCoord m_coord;
+    std::array<std::vector<BlockId>, MAX_LEVEL> m_levels;
+};
+
+/**
+ * Downsampled chunks by coordinate. Holds every generated chunk, including the ones whose
+ * full data was discarded because they are only ever drawn at a coarse level.
+ */
+class LodStore
+{
+public:
+    [[nodiscard]] const ChunkLod* Get(const ChunkCoord& coord) const;
+
+    /**
+     * Add or replace the downsampled data of a chunk
+     */
+    void Insert(std::unique_ptr<ChunkLod> lod);
+
+    void Remove(const ChunkCoord& coord);
+
+    [[nodiscard]] std::size_t GetCount() const { return m_chunks.size(); }
+    [[nodiscard]] std::size_t GetMemoryUsage() const;
+
+private:
+    std::unordered_map<ChunkCoord, std::unique_ptr<ChunkLod>, ChunkCoordHash> m_chunks;
+};
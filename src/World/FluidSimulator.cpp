@@ -0,0 +1,462 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "FluidSimulator.hpp"
+
+#include "Core/JobSystem.hpp"
+#include "Core/Memory/TransientMemory.hpp"
+#include "Core/Profiling/Profiler.hpp"
+#include "World.hpp"
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <iostream>
+
+namespace
+{
+constexpr int HORIZONTAL[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+
+int KeyX(std::uint64_t key)
+{
+    return static_cast<int>(static_cast<std::uint32_t>(key >> 32));
+}
+
+int KeyZ(std::uint64_t key)
+{
+    return static_cast<int>(static_cast<std::uint32_t>(key));
+}
+
+std::uint32_t CellIndex(int x, int y, int z)
+{
+    return static_cast<std::uint32_t>(BlockToLocal(x) | (BlockToLocal(z) << Chunk::SIZE_BITS) |
+                                      (y << (2 * Chunk::SIZE_BITS)));
+}
+} // namespace
+
+/**
+ * The 3x3 columns a job may touch, with their chunks and fluid state looked up once
+ */
+class FluidSimulator::Region
+{
+public:
+    Region(World& world, std::unordered_map<std::uint64_t, ColumnFluid>& columns, int chunkX, int chunkZ,
+           std::vector<BlockChange>& changes)
+        : m_chunkX(chunkX)
+        , m_chunkZ(chunkZ)
+        , m_changes(changes)
+    {
+        for (int dx = 0; dx < 3; ++dx)
+        {
+            for (int dz = 0; dz < 3; ++dz)
+            {
+                const auto it = columns.find(ColumnKey(chunkX + dx - 1, chunkZ + dz - 1));
+                m_fluid[dx * 3 + dz] = it != columns.end() ? &it->second : nullptr;
+                for (int y = 0; y < WORLD_HEIGHT_CHUNKS; ++y)
+                {
+                    m_chunks[(dx * 3 + dz) * WORLD_HEIGHT_CHUNKS + y] =
+                        world.GetChunk({chunkX + dx - 1, y, chunkZ + dz - 1});
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] BlockId GetBlock(int x, int y, int z) const
+    {
+        const Chunk* chunk = LocateChunk(x, y, z);
+        return chunk ? chunk->GetBlock(BlockToLocal(x), BlockToLocal(y), BlockToLocal(z)) : BLOCK_AIR;
+    }
+
+    [[nodiscard]] bool IsLoaded(int x, int y, int z) const { return LocateChunk(x, y, z) != nullptr; }
+
+    void SetBlock(int x, int y, int z, BlockId block)
+    {
+        Chunk* chunk = LocateChunk(x, y, z);
+        const int index = Chunk::Index(BlockToLocal(x), BlockToLocal(y), BlockToLocal(z));
+        const BlockId oldBlock = chunk->GetBlock(index);
+        if (oldBlock == block)
+            return;
+
+        chunk->SetBlock(index, block);
+        m_changes.push_back({x, y, z, oldBlock, block});
+    }
+
+    [[nodiscard]] int GetLevel(int x, int y, int z) const
+    {
+        const ColumnFluid* fluid = LocateFluid(x, z);
+        if (!fluid)
+            return 0;
+        const auto it = fluid->levels.find(CellIndex(x, y, z));
+        return it != fluid->levels.end() ? it->second : 0;
+    }
+
+    void SetLevel(int x, int y, int z, int level)
+    {
+        ColumnFluid* fluid = LocateFluid(x, z);
+        if (level == 0)
+            fluid->levels.erase(CellIndex(x, y, z));
+        else
+            fluid->levels[CellIndex(x, y, z)] = static_cast<std::uint8_t>(level);
+    }
+
+    void Activate(int x, int y, int z)
+    {
+        if (y >= 0 && y < WORLD_HEIGHT)
+            LocateFluid(x, z)->active.insert(CellIndex(x, y, z));
+    }
+
+    void ActivateAround(int x, int y, int z)
+    {
+        Activate(x, y, z);
+        for (const auto& direction : NEIGHBOR_DIRECTIONS)
+        {
+            Activate(x + direction[0], y + direction[1], z + direction[2]);
+        }
+    }
+
+private:
+    int m_chunkX, m_chunkZ;
+    std::array<Chunk*, 9 * WORLD_HEIGHT_CHUNKS> m_chunks{};
+    std::array<ColumnFluid*, 9> m_fluid{};
+    std::vector<BlockChange>& m_changes;
+
+    [[nodiscard]] Chunk* LocateChunk(int x, int y, int z) const
+    {
+        const int column = (BlockToChunk(x) - m_chunkX + 1) * 3 + (BlockToChunk(z) - m_chunkZ + 1);
+        const int cy = BlockToChunk(y);
+        if (static_cast<unsigned>(cy) >= WORLD_HEIGHT_CHUNKS)
+            return nullptr;
+        return m_chunks[column * WORLD_HEIGHT_CHUNKS + cy];
+    }
+
+    [[nodiscard]] ColumnFluid* LocateFluid(int x, int z) const
+    {
+        return m_fluid[(BlockToChunk(x) - m_chunkX + 1) * 3 + (BlockToChunk(z) - m_chunkZ + 1)];
+    }
+};
+
+FluidSimulator::FluidSimulator(World& world, const BlockRegistry& registry)
+    : m_world(world)
+    , m_registry(registry)
+    , m_step(0)
+    , m_accumulator(0.0f)
+{
+}
+
+bool FluidSimulator::AddFluid(const FluidType& type)
+{
+    // falling fluid starts at level 1, so it needs a maxDistance of at least 1 to exist at all
+    if (type.block == BLOCK_AIR || type.stepInterval < 1 || type.maxDistance < 1 ||
+        type.maxDistance > MAX_FLOW_DISTANCE)
+    {
+        std::cerr << "Invalid fluid for block " << type.block << ": maxDistance " << type.maxDistance
+                  << " (1-" << MAX_FLOW_DISTANCE << "), stepInterval " << type.stepInterval << " (at least 1)"
+                  << std::endl;
+        return false;
+    }
+
+    if (m_fluidIndex.size() <= type.block)
+        m_fluidIndex.resize(static_cast<std::size_t>(type.block) + 1, -1);
+    m_fluidIndex[type.block] = static_cast<int>(m_fluids.size());
+    m_fluids.push_back(type);
+    return true;
+}
+
+void FluidSimulator::OnBlockChanged(int x, int y, int z)
+{
+    Activate(x, y, z);
+    for (const auto& direction : NEIGHBOR_DIRECTIONS)
+    {
+        Activate(x + direction[0], y + direction[1], z + direction[2]);
+    }
+}
+
+void FluidSimulator::RemoveColumns(const std::vector<ChunkCoord>& columns)
+{
+    for (const ChunkCoord& coord : columns)
+    {
+        m_columns.erase(ColumnKey(coord.x, coord.z));
+    }
+}
+
+void FluidSimulator::Activate(int x, int y, int z)
+{
+    if (y < 0 || y >= WORLD_HEIGHT)
+        return;
+    m_columns[ColumnKey(BlockToChunk(x), BlockToChunk(z))].active.insert(CellIndex(x, y, z));
+}
+
+int FluidSimulator::GetLevel(int x, int y, int z) const
+{
+    const BlockId block = m_world.GetBlock(x, y, z);
+    if (block >= m_fluidIndex.size() || m_fluidIndex[block] < 0)
+        return -1;
+
+    const auto column = m_columns.find(ColumnKey(BlockToChunk(x), BlockToChunk(z)));
+    if (column == m_columns.end())
+        return 0;
+    const auto it = column->second.levels.find(CellIndex(x, y, z));
+    return it != column->second.levels.end() ? it->second : 0;
+}
+
+std::size_t FluidSimulator::GetActiveCellCount() const
+{
+    std::size_t count = 0;
+    for (const auto& [key, fluid] : m_columns)
+    {
+        count += fluid.active.size();
+    }
+    return count;
+}
+
+int FluidSimulator::Update(JobSystem& jobs, float deltaTime)
+{
+    constexpr float STEP = 1.0f / STEPS_PER_SECOND;
+
+    m_updateChanges.clear();
+    m_accumulator += deltaTime;
+
+    int steps = 0;
+    while (m_accumulator >= STEP && steps < MAX_STEPS_PER_UPDATE)
+    {
+        Step(jobs);
+        m_updateChanges.insert(m_updateChanges.end(), m_changes.begin(), m_changes.end());
+        m_accumulator -= STEP;
+        ++steps;
+    }
+
+    // drop the backlog rather than falling further behind every frame
+    if (steps == MAX_STEPS_PER_UPDATE)
+        m_accumulator = std::min(m_accumulator, STEP);
+
+    m_changes.swap(m_updateChanges);
+    return steps;
+}
+
+void FluidSimulator::Step(JobSystem& jobs)
+{
+    ++m_step;
+    m_changes.clear();
+
+    // columns with active cells whose chunks are loaded; the rest keep their cells for later
+    m_activeColumns.clear();
+    for (auto& [key, fluid] : m_columns)
+    {
+        if (fluid.active.empty() || !m_world.HasChunk({KeyX(key), 0, KeyZ(key)}))
+            continue;
+
+        fluid.processing.assign(fluid.active.begin(), fluid.active.end());
+        std::sort(fluid.processing.begin(), fluid.processing.end());
+        fluid.active.clear();
+        m_activeColumns.push_back(key);
+    }
+    if (m_activeColumns.empty())
+        return;
+
+    // jobs look up their neighbours' state but must never insert into the column map
+    ScratchScope scratch;
+    std::pmr::vector<std::pmr::vector<std::size_t>> buckets(9, &scratch.GetArena());
+    for (std::size_t i = 0; i < m_activeColumns.size(); ++i)
+    {
+        const int chunkX = KeyX(m_activeColumns[i]);
+        const int chunkZ = KeyZ(m_activeColumns[i]);
+        for (int dx = -1; dx <= 1; ++dx)
+        {
+            for (int dz = -1; dz <= 1; ++dz)
+            {
+                m_columns.try_emplace(ColumnKey(chunkX + dx, chunkZ + dz));
+            }
+        }
+        buckets[ColumnColor(chunkX, chunkZ)].push_back(i);
+    }
+
+    if (m_columnChanges.size() < m_activeColumns.size())
+        m_columnChanges.resize(m_activeColumns.size());
+
+    for (std::pmr::vector<std::size_t>& bucket : buckets)
+    {
+        // same results whatever order the hash map hands the columns out in
+        std::sort(bucket.begin(), bucket.end(),
+                  [&](std::size_t a, std::size_t b) { return m_activeColumns[a] < m_activeColumns[b]; });
+
+        jobs.ParallelFor(bucket.size(), 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                ProcessColumn(m_activeColumns[bucket[i]], m_columnChanges[bucket[i]]);
+            }
+        });
+    }
+
+    for (const std::pmr::vector<std::size_t>& bucket : buckets)
+    {
+        for (const std::size_t i : bucket)
+        {
+            m_changes.insert(m_changes.end(), m_columnChanges[i].begin(), m_columnChanges[i].end());
+            m_columnChanges[i].clear();
+        }
+    }
+    RequestRemesh(m_changes);
+
+    // drop the columns this step made room for, or emptied, that hold no fluid state
+    for (const std::uint64_t key : m_activeColumns)
+    {
+        for (int dx = -1; dx <= 1; ++dx)
+        {
+            for (int dz = -1; dz <= 1; ++dz)
+            {
+                const auto it = m_columns.find(ColumnKey(KeyX(key) + dx, KeyZ(key) + dz));
+                if (it != m_columns.end() && it->second.active.empty() && it->second.levels.empty())
+                    m_columns.erase(it);
+            }
+        }
+    }
+}
+
+void FluidSimulator::ProcessColumn(std::uint64_t columnKey, std::vector<BlockChange>& changes)
+{
+    PROFILE_SCOPE("FluidColumn");
+    const int chunkX = KeyX(columnKey);
+    const int chunkZ = KeyZ(columnKey);
+    Region region(m_world, m_columns, chunkX, chunkZ, changes);
+    ColumnFluid& column = m_columns.find(columnKey)->second;
+
+    auto fluidOf = [&](BlockId block) { return block < m_fluidIndex.size() ? m_fluidIndex[block] : -1; };
+    auto isReplaceable = [&](int x, int y, int z) {
+        const BlockId block = region.GetBlock(x, y, z);
+        return region.IsLoaded(x, y, z) && !m_registry.IsSolid(block) && fluidOf(block) < 0;
+    };
+
+    const int baseX = chunkX * Chunk::SIZE;
+    const int baseZ = chunkZ * Chunk::SIZE;
+    for (const std::uint32_t cell : column.processing)
+    {
+        const int x = baseX + static_cast<int>(cell & Chunk::MASK);
+        const int z = baseZ + static_cast<int>((cell >> Chunk::SIZE_BITS) & Chunk::MASK);
+        const int y = static_cast<int>(cell >> (2 * Chunk::SIZE_BITS));
+
+        const BlockId block = region.GetBlock(x, y, z);
+        const int fluidIndex = fluidOf(block);
+        if (fluidIndex < 0)
+        {
+            // the fluid was replaced; forget its level
+            region.SetLevel(x, y, z, 0);
+            continue;
+        }
+
+        const FluidType& type = m_fluids[fluidIndex];
+        if (m_step % static_cast<std::uint64_t>(type.stepInterval) != 0)
+        {
+            region.Activate(x, y, z);
+            continue;
+        }
+
+        // meeting another fluid turns this one solid (lava next to water)
+        if (type.solidifiesInto != BLOCK_AIR)
+        {
+            bool touching = false;
+            for (const auto& direction : NEIGHBOR_DIRECTIONS)
+            {
+                const int other = fluidOf(region.GetBlock(x + direction[0], y + direction[1], z + direction[2]));
+                touching = touching || (other >= 0 && other != fluidIndex);
+            }
+            if (touching)
+            {
+                region.SetBlock(x, y, z, type.solidifiesInto);
+                region.SetLevel(x, y, z, 0);
+                region.ActivateAround(x, y, z);
+                continue;
+            }
+        }
+
+        int level = region.GetLevel(x, y, z);
+        if (level > 0)
+        {
+            // flowing fluid is fed from above or by its lowest neighbour; unfed fluid drains away
+            int expected = INT_MAX;
+            if (region.GetBlock(x, y + 1, z) == block)
+            {
+                expected = 1;
+            }
+            else
+            {
+                for (const auto& offset : HORIZONTAL)
+                {
+                    if (region.GetBlock(x + offset[0], y, z + offset[1]) == block)
+                        expected = std::min(expected, region.GetLevel(x + offset[0], y, z + offset[1]) + 1);
+                }
+            }
+
+            if (expected > type.maxDistance)
+            {
+                region.SetBlock(x, y, z, BLOCK_AIR);
+                region.SetLevel(x, y, z, 0);
+                region.ActivateAround(x, y, z);
+                continue;
+            }
+            if (expected != level)
+            {
+                level = expected;
+                region.SetLevel(x, y, z, level);
+                region.ActivateAround(x, y, z);
+            }
+        }
+
+        // fall first; only fluid resting on something spreads sideways
+        if (y > 0 && isReplaceable(x, y - 1, z))
+        {
+            region.SetBlock(x, y - 1, z, block);
+            region.SetLevel(x, y - 1, z, 1);
+            region.Activate(x, y - 1, z);
+            continue;
+        }
+        if (y > 0 && region.GetBlock(x, y - 1, z) == block)
+            continue;
+        if (level + 1 > type.maxDistance)
+            continue;
+
+        for (const auto& offset : HORIZONTAL)
+        {
+            const int nx = x + offset[0];
+            const int nz = z + offset[1];
+            if (isReplaceable(nx, y, nz))
+            {
+                region.SetBlock(nx, y, nz, block);
+                region.SetLevel(nx, y, nz, level + 1);
+                region.Activate(nx, y, nz);
+            }
+            else if (region.GetBlock(nx, y, nz) == block && region.GetLevel(nx, y, nz) > level + 1)
+            {
+                region.Activate(nx, y, nz);
+            }
+        }
+    }
+    column.processing.clear();
+}
+
+void FluidSimulator::RequestRemesh(const std::vector<BlockChange>& changes)
+{
+    // the edited chunks are already dirty; border faces of their neighbours are not
+    std::unordered_set<ChunkCoord, ChunkCoordHash> chunks;
+    for (const BlockChange& change : changes)
+    {
+        const int local[3] = {BlockToLocal(change.x), BlockToLocal(change.y), BlockToLocal(change.z)};
+        const ChunkCoord coord = BlockToChunkCoord(change.x, change.y, change.z);
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            if (local[axis] != 0 && local[axis] != Chunk::MASK)
+                continue;
+
+            ChunkCoord neighbor = coord;
+            int* component = axis == 0 ? &neighbor.x : axis == 1 ? &neighbor.y : &neighbor.z;
+            *component += local[axis] == 0 ? -1 : 1;
+            chunks.insert(neighbor);
+        }
+    }
+
+    for (const ChunkCoord& coord : chunks)
+    {
+        if (Chunk* chunk = m_world.GetChunk(coord))
+            chunk->SetDirty(true);
+    }
+}
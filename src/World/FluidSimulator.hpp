@@ -0,0 +1,138 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "BlockRegistry.hpp"
+#include "BlockTickScheduler.hpp"
+#include "Chunk.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class JobSystem;
+class World;
+
+/**
+ * How a fluid block behaves
+ */
+struct FluidType
+{
+    BlockId block = BLOCK_AIR;
+    int maxDistance = 7; // how far flowing fluid reaches sideways from a source
+    int stepInterval = 1; // flows every n simulation steps
+    BlockId solidifiesInto = BLOCK_AIR; // block left behind when touching another fluid, if any
+};
+
+/**
+ * Cellular fluid flow (water, lava).
+ *
+ * Fluid blocks are sources unless the simulator holds a flow level for them (1 = next to a
+ * source or falling, up to FluidType::maxDistance). Only active cells are looked at: a cell
+ * becomes active when it or a neighbour changes and drops out once it has settled, so a
+ * flooded map that is at rest costs nothing. Active cells and levels are kept per column in
+ * sparse sets.
+ *
+ * Each step processes the active columns in 9 colour phases (x mod 3, z mod 3). A cell only
+ * touches its 6 neighbours, so same-coloured columns never share a cell and each phase runs
+ * in parallel. Edits of a step are batched: the chunks they touch (and neighbours whose
+ * border faces they change) are flagged for remeshing once, after the step.
+ */
+class FluidSimulator
+{
+public:
+    static constexpr int STEPS_PER_SECOND = 4;
+    static constexpr int MAX_STEPS_PER_UPDATE = 2;
+    // flow levels are stored in a byte
+    static constexpr int MAX_FLOW_DISTANCE = 255;
+
+    FluidSimulator(World& world, const BlockRegistry& registry);
+
+    FluidSimulator(const FluidSimulator&) = delete;
+    FluidSimulator& operator=(const FluidSimulator&) = delete;
+
+    /**
+     * Register a fluid
+     * @return False, registering nothing, if its block is air, its stepInterval is below 1 or its
+     *         maxDistance is outside 1..MAX_FLOW_DISTANCE
+     */
+    bool AddFluid(const FluidType& type);
+
+    /**
+     * Wake the fluid at and around a block changed by something other than the simulator
+     */
+    void OnBlockChanged(int x, int y, int z);
+
+    /**
+     * Drop the flow state of columns that are about to be unloaded (chunk y ignored)
+     */
+    void RemoveColumns(const std::vector<ChunkCoord>& columns);
+
+    /**
+     * Advance by the fixed steps that fit into the elapsed time
+     * @return Number of steps run
+     */
+    int Update(JobSystem& jobs, float deltaTime);
+
+    /**
+     * Run exactly one step, regardless of elapsed time
+     */
+    void Step(JobSystem& jobs);
+
+    /**
+     * Block edits made by the steps of the last Update or Step call
+     */
+    [[nodiscard]] const std::vector<BlockChange>& GetChanges() const { return m_changes; }
+
+    /**
+     * Flow level of the fluid at a position: 0 for a source, -1 if there is no fluid
+     */
+    [[nodiscard]] int GetLevel(int x, int y, int z) const;
+
+    [[nodiscard]] std::size_t GetActiveCellCount() const;
+
+    /**
+     * Number of columns holding flow levels or active cells
+     */
+    [[nodiscard]] std::size_t GetColumnCount() const { return m_columns.size(); }
+
+private:
+    /**
+     * Sparse fluid state of one chunk column; cells are x | z << 5 | y << 10 within it
+     */
+    struct ColumnFluid
+    {
+        std::unordered_map<std::uint32_t, std::uint8_t> levels;
+        std::unordered_set<std::uint32_t> active;
+        std::vector<std::uint32_t> processing;
+    };
+
+    class Region;
+
+    World& m_world;
+    const BlockRegistry& m_registry;
+    std::vector<FluidType> m_fluids;
+    // index into m_fluids per block id, -1 for blocks that are not fluids
+    std::vector<int> m_fluidIndex;
+
+    std::unordered_map<std::uint64_t, ColumnFluid> m_columns;
+    std::uint64_t m_step;
+    float m_accumulator;
+
+    // reused across steps
+    std::vector<std::uint64_t> m_activeColumns;
+    std::vector<std::vector<BlockChange>> m_columnChanges;
+    std::vector<BlockChange> m_changes;
+    std::vector<BlockChange> m_updateChanges;
+
+    void Activate(int x, int y, int z);
+
+    void ProcessColumn(std::uint64_t columnKey, std::vector<BlockChange>& changes);
+
+    /**
+     * Flag the chunks whose meshes the edits of a step changed
+     */
+    void RequestRemesh(const std::vector<BlockChange>& changes);
+};
@@ -0,0 +1,412 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "Noise.hpp"
+
+#include "NoiseKernels.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+using namespace Noise::Kernels;
+
+namespace
+{
+// integer math is done unsigned so overflow wraps exactly like the SIMD lanes do
+std::int32_t Hash(int seed, std::uint32_t xPrimed, std::uint32_t yPrimed)
+{
+    const std::uint32_t h = static_cast<std::uint32_t>(seed) ^ xPrimed ^ yPrimed;
+    return static_cast<std::int32_t>(h * static_cast<std::uint32_t>(HASH_MULTIPLIER));
+}
+
+std::int32_t Hash(int seed, std::uint32_t xPrimed, std::uint32_t yPrimed, std::uint32_t zPrimed)
+{
+    const std::uint32_t h = static_cast<std::uint32_t>(seed) ^ xPrimed ^ yPrimed ^ zPrimed;
+    return static_cast<std::int32_t>(h * static_cast<std::uint32_t>(HASH_MULTIPLIER));
+}
+
+std::uint32_t Prime(int cell, int prime)
+{
+    return static_cast<std::uint32_t>(cell) * static_cast<std::uint32_t>(prime);
+}
+
+int FastFloor(float value)
+{
+    return static_cast<int>(std::floor(value));
+}
+
+float Gradient2D(std::int32_t hash, float x, float y)
+{
+    const int h = hash & 7;
+    const float u = h < 4 ? x : y;
+    const float v = h < 4 ? y : x;
+    return ((h & 1) ? -u : u) + ((h & 2) ? -2.0f * v : 2.0f * v);
+}
+
+float Gradient3D(std::int32_t hash, float x, float y, float z)
+{
+    const int h = hash & 15;
+    const float u = h < 8 ? x : y;
+    const float v = h < 4 ? y : (h == 12 || h == 14) ? x : z;
+    return ((h & 1) ? -u : u) + ((h & 2) ? -v : v);
+}
+
+float Quintic(float t)
+{
+    return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+}
+
+float HashToFloat(std::int32_t hash)
+{
+    return static_cast<float>(hash) * HASH_TO_FLOAT;
+}
+
+float SimplexCorner2D(int seed, int i, int j, float x, float y)
+{
+    const float t = 0.5f - x * x - y * y;
+    if (t <= 0.0f)
+        return 0.0f;
+
+    const float t2 = t * t;
+    return t2 * t2 * Gradient2D(Hash(seed, Prime(i, PRIME_X), Prime(j, PRIME_Y)), x, y);
+}
+
+float SimplexCorner3D(int seed, int i, int j, int k, float x, float y, float z)
+{
+    const float t = 0.6f - x * x - y * y - z * z;
+    if (t <= 0.0f)
+        return 0.0f;
+
+    const float t2 = t * t;
+    return t2 * t2 *
+           Gradient3D(Hash(seed, Prime(i, PRIME_X), Prime(j, PRIME_Y), Prime(k, PRIME_Z)), x, y, z);
+}
+
+bool DetectAVX2()
+{
+#if !defined(SILK_NOISE_AVX2)
+    return false;
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    const bool fma = (info[2] & (1 << 12)) != 0;
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    if (!fma || !osxsave || (_xgetbv(0) & 0x6) != 0x6)
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+}
+
+const bool CPU_HAS_AVX2 = DetectAVX2();
+bool simdEnabled = true;
+
+bool UseAVX2()
+{
+    return CPU_HAS_AVX2 && simdEnabled;
+}
+} // namespace
+
+namespace Noise
+{
+float Simplex2D(int seed, float x, float y)
+{
+    const float s = (x + y) * SKEW_2D;
+    const int i = FastFloor(x + s);
+    const int j = FastFloor(y + s);
+
+    const float t = static_cast<float>(i + j) * UNSKEW_2D;
+    const float x0 = x - (static_cast<float>(i) - t);
+    const float y0 = y - (static_cast<float>(j) - t);
+
+    const int i1 = x0 > y0 ? 1 : 0;
+    const int j1 = 1 - i1;
+
+    const float x1 = x0 - static_cast<float>(i1) + UNSKEW_2D;
+    const float y1 = y0 - static_cast<float>(j1) + UNSKEW_2D;
+    const float x2 = x0 - 1.0f + 2.0f * UNSKEW_2D;
+    const float y2 = y0 - 1.0f + 2.0f * UNSKEW_2D;
+
+    const float n = SimplexCorner2D(seed, i, j, x0, y0) +
+                    SimplexCorner2D(seed, i + i1, j + j1, x1, y1) +
+                    SimplexCorner2D(seed, i + 1, j + 1, x2, y2);
+    return n * SIMPLEX_2D_SCALE;
+}
+
+float Simplex3D(int seed, float x, float y, float z)
+{
+    const float s = (x + y + z) * SKEW_3D;
+    const int i = FastFloor(x + s);
+    const int j = FastFloor(y + s);
+    const int k = FastFloor(z + s);
+
+    const float t = static_cast<float>(i + j + k) * UNSKEW_3D;
+    const float x0 = x - (static_cast<float>(i) - t);
+    const float y0 = y - (static_cast<float>(j) - t);
+    const float z0 = z - (static_cast<float>(k) - t);
+
+    // rank the offsets to find which of the six tetrahedra we are in
+    const int xGeY = x0 >= y0;
+    const int yGeZ = y0 >= z0;
+    const int xGeZ = x0 >= z0;
+
+    const int i1 = xGeY & xGeZ;
+    const int j1 = (1 - xGeY) & yGeZ;
+    const int k1 = (1 - xGeZ) & (1 - yGeZ);
+    const int i2 = xGeY | xGeZ;
+    const int j2 = (1 - xGeY) | yGeZ;
+    const int k2 = (1 - xGeZ) | (1 - yGeZ);
+
+    const float x1 = x0 - static_cast<float>(i1) + UNSKEW_3D;
+    const float y1 = y0 - static_cast<float>(j1) + UNSKEW_3D;
+    const float z1 = z0 - static_cast<float>(k1) + UNSKEW_3D;
+    const float x2 = x0 - static_cast<float>(i2) + 2.0f * UNSKEW_3D;
+    const float y2 = y0 - static_cast<float>(j2) + 2.0f * UNSKEW_3D;
+    const float z2 = z0 - static_cast<float>(k2) + 2.0f * UNSKEW_3D;
+    const float x3 = x0 - 1.0f + 3.0f * UNSKEW_3D;
+    const float y3 = y0 - 1.0f + 3.0f * UNSKEW_3D;
+    const float z3 = z0 - 1.0f + 3.0f * UNSKEW_3D;
+
+    const float n = SimplexCorner3D(seed, i, j, k, x0, y0, z0) +
+                    SimplexCorner3D(seed, i + i1, j + j1, k + k1, x1, y1, z1) +
+                    SimplexCorner3D(seed, i + i2, j + j2, k + k2, x2, y2, z2) +
+                    SimplexCorner3D(seed, i + 1, j + 1, k + 1, x3, y3, z3);
+    return n * SIMPLEX_3D_SCALE;
+}
+
+float Value2D(int seed, float x, float y)
+{
+    const int x0 = FastFloor(x);
+    const int y0 = FastFloor(y);
+    const float xs = Quintic(x - static_cast<float>(x0));
+    const float ys = Quintic(y - static_cast<float>(y0));
+
+    const std::uint32_t px0 = Prime(x0, PRIME_X);
+    const std::uint32_t py0 = Prime(y0, PRIME_Y);
+    const std::uint32_t px1 = px0 + static_cast<std::uint32_t>(PRIME_X);
+    const std::uint32_t py1 = py0 + static_cast<std::uint32_t>(PRIME_Y);
+
+    const float a = HashToFloat(Hash(seed, px0, py0));
+    const float b = HashToFloat(Hash(seed, px1, py0));
+    const float c = HashToFloat(Hash(seed, px0, py1));
+    const float d = HashToFloat(Hash(seed, px1, py1));
+
+    const float top = a + xs * (b - a);
+    const float bottom = c + xs * (d - c);
+    return top + ys * (bottom - top);
+}
+
+float Value3D(int seed, float x, float y, float z)
+{
+    const int x0 = FastFloor(x);
+    const int y0 = FastFloor(y);
+    const int z0 = FastFloor(z);
+    const float xs = Quintic(x - static_cast<float>(x0));
+    const float ys = Quintic(y - static_cast<float>(y0));
+    const float zs = Quintic(z - static_cast<float>(z0));
+
+    const std::uint32_t px0 = Prime(x0, PRIME_X);
+    const std::uint32_t py0 = Prime(y0, PRIME_Y);
+    const std::uint32_t pz0 = Prime(z0, PRIME_Z);
+    const std::uint32_t px1 = px0 + static_cast<std::uint32_t>(PRIME_X);
+    const std::uint32_t py1 = py0 + static_cast<std::uint32_t>(PRIME_Y);
+    const std::uint32_t pz1 = pz0 + static_cast<std::uint32_t>(PRIME_Z);
+
+    auto lerpX = [&](std::uint32_t py, std::uint32_t pz) {
+        const float a = HashToFloat(Hash(seed, px0, py, pz));
+        const float b = HashToFloat(Hash(seed, px1, py, pz));
+        return a + xs * (b - a);
+    };
+
+    const float near0 = lerpX(py0, pz0);
+    const float near1 = lerpX(py1, pz0);
+    const float far0 = lerpX(py0, pz1);
+    const float far1 = lerpX(py1, pz1);
+
+    const float nearValue = near0 + ys * (near1 - near0);
+    const float farValue = far0 + ys * (far1 - far0);
+    return nearValue + zs * (farValue - nearValue);
+}
+
+float Fbm2D(int seed, const FractalSettings& settings, float x, float y)
+{
+    float sum = 0.0f;
+    float amplitude = 1.0f;
+    float amplitudeSum = 0.0f;
+    float frequency = settings.frequency;
+
+    for (int octave = 0; octave < settings.octaves; ++octave)
+    {
+        const int octaveSeed = seed + octave * OCTAVE_SEED_STEP;
+        const float value = settings.type == NoiseType::Simplex
+                                ? Simplex2D(octaveSeed, x * frequency, y * frequency)
+                                : Value2D(octaveSeed, x * frequency, y * frequency);
+        sum += value * amplitude;
+        amplitudeSum += amplitude;
+        amplitude *= settings.gain;
+        frequency *= settings.lacunarity;
+    }
+    return amplitudeSum > 0.0f ? sum / amplitudeSum : 0.0f;
+}
+
+float Fbm3D(int seed, const FractalSettings& settings, float x, float y, float z)
+{
+    float sum = 0.0f;
+    float amplitude = 1.0f;
+    float amplitudeSum = 0.0f;
+    float frequency = settings.frequency;
+
+    for (int octave = 0; octave < settings.octaves; ++octave)
+    {
+        const int octaveSeed = seed + octave * OCTAVE_SEED_STEP;
+        const float value =
+            settings.type == NoiseType::Simplex
+                ? Simplex3D(octaveSeed, x * frequency, y * frequency, z * frequency)
+                : Value3D(octaveSeed, x * frequency, y * frequency, z * frequency);
+        sum += value * amplitude;
+        amplitudeSum += amplitude;
+        amplitude *= settings.gain;
+        frequency *= settings.lacunarity;
+    }
+    return amplitudeSum > 0.0f ? sum / amplitudeSum : 0.0f;
+}
+
+void Simplex2DBatch(int seed, const float* x, const float* y, float* out, std::size_t count)
+{
+#ifdef SILK_NOISE_AVX2
+    if (UseAVX2())
+    {
+        Simplex2DAVX2(seed, x, y, out, count);
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out[i] = Simplex2D(seed, x[i], y[i]);
+    }
+}
+
+void Simplex3DBatch(int seed, const float* x, const float* y, const float* z, float* out,
+                    std::size_t count)
+{
+#ifdef SILK_NOISE_AVX2
+    if (UseAVX2())
+    {
+        Simplex3DAVX2(seed, x, y, z, out, count);
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out[i] = Simplex3D(seed, x[i], y[i], z[i]);
+    }
+}
+
+void Value2DBatch(int seed, const float* x, const float* y, float* out, std::size_t count)
+{
+#ifdef SILK_NOISE_AVX2
+    if (UseAVX2())
+    {
+        Value2DAVX2(seed, x, y, out, count);
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out[i] = Value2D(seed, x[i], y[i]);
+    }
+}
+
+void Value3DBatch(int seed, const float* x, const float* y, const float* z, float* out,
+                  std::size_t count)
+{
+#ifdef SILK_NOISE_AVX2
+    if (UseAVX2())
+    {
+        Value3DAVX2(seed, x, y, z, out, count);
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out[i] = Value3D(seed, x[i], y[i], z[i]);
+    }
+}
+
+void Fbm2DBatch(int seed, const FractalSettings& settings, const float* x, const float* y,
+                float* out, std::size_t count)
+{
+#ifdef SILK_NOISE_AVX2
+    if (UseAVX2())
+    {
+        Fbm2DAVX2(seed, settings.type == NoiseType::Simplex ? NOISE_SIMPLEX : NOISE_VALUE,
+                  settings.octaves, settings.frequency, settings.lacunarity, settings.gain, x, y,
+                  out, count);
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out[i] = Fbm2D(seed, settings, x[i], y[i]);
+    }
+}
+
+void Fbm3DBatch(int seed, const FractalSettings& settings, const float* x, const float* y,
+                const float* z, float* out, std::size_t count)
+{
+#ifdef SILK_NOISE_AVX2
+    if (UseAVX2())
+    {
+        Fbm3DAVX2(seed, settings.type == NoiseType::Simplex ? NOISE_SIMPLEX : NOISE_VALUE,
+                  settings.octaves, settings.frequency, settings.lacunarity, settings.gain, x, y,
+                  z, out, count);
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out[i] = Fbm3D(seed, settings, x[i], y[i], z[i]);
+    }
+}
+
+void DomainWarp2DBatch(int seed, const FractalSettings& settings, float amplitude, float* x,
+                       float* y, std::size_t count)
+{
+    constexpr std::size_t BLOCK = 256;
+    float offsetX[BLOCK];
+    float offsetY[BLOCK];
+
+    for (std::size_t start = 0; start < count; start += BLOCK)
+    {
+        const std::size_t n = count - start < BLOCK ? count - start : BLOCK;
+
+        // both offsets sample the unwarped position so the result does not depend on order
+        Fbm2DBatch(seed, settings, x + start, y + start, offsetX, n);
+        Fbm2DBatch(seed + 1, settings, x + start, y + start, offsetY, n);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            x[start + i] += offsetX[i] * amplitude;
+            y[start + i] += offsetY[i] * amplitude;
+        }
+    }
+}
+
+bool IsSIMDActive()
+{
+    return UseAVX2();
+}
+
+void SetSIMDEnabled(bool enabled)
+{
+    simdEnabled = enabled;
+}
+} // namespace Noise
@@ -0,0 +1,74 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include <cstddef>
+
+/**
+ * Coherent noise functions used by world generation.
+ *
+ * Lattice points are hashed with a seeded integer hash instead of a permutation
+ * table, so the batch kernels never need gathers and the scalar and SIMD paths
+ * produce the same values. All functions return values in roughly [-1, 1].
+ */
+namespace Noise
+{
+enum class NoiseType
+{
+    Simplex,
+    Value
+};
+
+struct FractalSettings
+{
+    NoiseType type = NoiseType::Simplex;
+    int octaves = 4;
+    float frequency = 0.01f;
+    float lacunarity = 2.0f;
+    float gain = 0.5f;
+};
+
+float Simplex2D(int seed, float x, float y);
+float Simplex3D(int seed, float x, float y, float z);
+float Value2D(int seed, float x, float y);
+float Value3D(int seed, float x, float y, float z);
+
+/**
+ * Fractal Brownian motion: octaves of the base noise summed with decreasing amplitude,
+ * normalized back to [-1, 1]
+ */
+float Fbm2D(int seed, const FractalSettings& settings, float x, float y);
+float Fbm3D(int seed, const FractalSettings& settings, float x, float y, float z);
+
+/**
+ * Batch kernels over structure-of-arrays coordinates. These use AVX2 (8 points per
+ * iteration) when the CPU supports it and fall back to the scalar functions otherwise.
+ */
+void Simplex2DBatch(int seed, const float* x, const float* y, float* out, std::size_t count);
+void Simplex3DBatch(int seed, const float* x, const float* y, const float* z, float* out,
+                    std::size_t count);
+void Value2DBatch(int seed, const float* x, const float* y, float* out, std::size_t count);
+void Value3DBatch(int seed, const float* x, const float* y, const float* z, float* out,
+                  std::size_t count);
+void Fbm2DBatch(int seed, const FractalSettings& settings, const float* x, const float* y,
+                float* out, std::size_t count);
+void Fbm3DBatch(int seed, const FractalSettings& settings, const float* x, const float* y,
+                const float* z, float* out, std::size_t count);
+
+/**
+ * Offset coordinates in place by fBm noise (domain warping), which breaks up the
+ * grid-aligned look of plain fBm
+ */
+void DomainWarp2DBatch(int seed, const FractalSettings& settings, float amplitude, float* x,
+                       float* y, std::size_t count);
+
+/**
+ * Check whether the batch kernels are running the AVX2 path
+ */
+bool IsSIMDActive();
+
+/**
+ * Force the scalar path even on AVX2 hardware (for benchmarking and validation)
+ */
+void SetSIMDEnabled(bool enabled);
+} // namespace Noise
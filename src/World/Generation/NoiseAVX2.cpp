@@ -0,0 +1,387 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+// AVX2 versions of the noise kernels, 8 points per iteration. This file is compiled with
+// AVX2/FMA code generation and only called after a runtime CPU check, so it deliberately
+// includes nothing but intrinsics and NoiseKernels.hpp (see the note there).
+//
+
+#include "NoiseKernels.hpp"
+
+#ifdef SILK_NOISE_AVX2
+
+#include <immintrin.h>
+
+namespace Noise::Kernels
+{
+namespace
+{
+inline __m256i Hash(__m256i seed, __m256i xPrimed, __m256i yPrimed)
+{
+    const __m256i h = _mm256_xor_si256(seed, _mm256_xor_si256(xPrimed, yPrimed));
+    return _mm256_mullo_epi32(h, _mm256_set1_epi32(HASH_MULTIPLIER));
+}
+
+inline __m256i Hash(__m256i seed, __m256i xPrimed, __m256i yPrimed, __m256i zPrimed)
+{
+    const __m256i h =
+        _mm256_xor_si256(_mm256_xor_si256(seed, xPrimed), _mm256_xor_si256(yPrimed, zPrimed));
+    return _mm256_mullo_epi32(h, _mm256_set1_epi32(HASH_MULTIPLIER));
+}
+
+inline __m256 FlipSign(__m256 value, __m256i hash, int bit)
+{
+    const __m256i sign = _mm256_slli_epi32(_mm256_and_si256(hash, _mm256_set1_epi32(1 << bit)),
+                                           31 - bit);
+    return _mm256_xor_ps(value, _mm256_castsi256_ps(sign));
+}
+
+inline __m256 Gradient2D(__m256i hash, __m256 x, __m256 y)
+{
+    const __m256i h = _mm256_and_si256(hash, _mm256_set1_epi32(7));
+    const __m256 lessThan4 = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(4), h));
+
+    const __m256 u = _mm256_blendv_ps(y, x, lessThan4);
+    const __m256 v = _mm256_blendv_ps(x, y, lessThan4);
+    return _mm256_add_ps(FlipSign(u, h, 0),
+                         FlipSign(_mm256_mul_ps(v, _mm256_set1_ps(2.0f)), h, 1));
+}
+
+inline __m256 Gradient3D(__m256i hash, __m256 x, __m256 y, __m256 z)
+{
+    const __m256i h = _mm256_and_si256(hash, _mm256_set1_epi32(15));
+    const __m256 lessThan8 = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(8), h));
+    const __m256 lessThan4 = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(4), h));
+    const __m256 is12or14 = _mm256_castsi256_ps(
+        _mm256_cmpeq_epi32(_mm256_and_si256(h, _mm256_set1_epi32(13)), _mm256_set1_epi32(12)));
+
+    const __m256 u = _mm256_blendv_ps(y, x, lessThan8);
+    const __m256 v = _mm256_blendv_ps(_mm256_blendv_ps(z, x, is12or14), y, lessThan4);
+    return _mm256_add_ps(FlipSign(u, h, 0), FlipSign(v, h, 1));
+}
+
+inline __m256 Quintic(__m256 t)
+{
+    const __m256 inner = _mm256_add_ps(
+        _mm256_mul_ps(t, _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)),
+                                       _mm256_set1_ps(15.0f))),
+        _mm256_set1_ps(10.0f));
+    return _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(t, t), t), inner);
+}
+
+inline __m256 HashToFloat(__m256i hash)
+{
+    return _mm256_mul_ps(_mm256_cvtepi32_ps(hash), _mm256_set1_ps(HASH_TO_FLOAT));
+}
+
+inline __m256 Lerp(__m256 a, __m256 b, __m256 t)
+{
+    return _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+}
+
+inline __m256 Falloff(__m256 radius, __m256 x, __m256 y)
+{
+    __m256 t = _mm256_sub_ps(_mm256_sub_ps(radius, _mm256_mul_ps(x, x)), _mm256_mul_ps(y, y));
+    t = _mm256_max_ps(t, _mm256_setzero_ps());
+    t = _mm256_mul_ps(t, t);
+    return _mm256_mul_ps(t, t);
+}
+
+inline __m256 Falloff(__m256 radius, __m256 x, __m256 y, __m256 z)
+{
+    __m256 t = _mm256_sub_ps(_mm256_sub_ps(radius, _mm256_mul_ps(x, x)), _mm256_mul_ps(y, y));
+    t = _mm256_max_ps(_mm256_sub_ps(t, _mm256_mul_ps(z, z)), _mm256_setzero_ps());
+    t = _mm256_mul_ps(t, t);
+    return _mm256_mul_ps(t, t);
+}
+
+inline __m256i PrimeOffset(__m256 mask, int prime)
+{
+    return _mm256_and_si256(_mm256_castps_si256(mask), _mm256_set1_epi32(prime));
+}
+
+inline __m256 Simplex2D(__m256i seed, __m256 x, __m256 y)
+{
+    const __m256 s = _mm256_mul_ps(_mm256_add_ps(x, y), _mm256_set1_ps(SKEW_2D));
+    const __m256 fi = _mm256_floor_ps(_mm256_add_ps(x, s));
+    const __m256 fj = _mm256_floor_ps(_mm256_add_ps(y, s));
+
+    const __m256 t = _mm256_mul_ps(_mm256_add_ps(fi, fj), _mm256_set1_ps(UNSKEW_2D));
+    const __m256 x0 = _mm256_sub_ps(x, _mm256_sub_ps(fi, t));
+    const __m256 y0 = _mm256_sub_ps(y, _mm256_sub_ps(fj, t));
+
+    const __m256 xGreater = _mm256_cmp_ps(x0, y0, _CMP_GT_OQ);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 i1 = _mm256_and_ps(xGreater, one);
+    const __m256 j1 = _mm256_andnot_ps(xGreater, one);
+
+    const __m256 unskew = _mm256_set1_ps(UNSKEW_2D);
+    const __m256 x1 = _mm256_add_ps(_mm256_sub_ps(x0, i1), unskew);
+    const __m256 y1 = _mm256_add_ps(_mm256_sub_ps(y0, j1), unskew);
+    const __m256 unskew2 = _mm256_set1_ps(2.0f * UNSKEW_2D - 1.0f);
+    const __m256 x2 = _mm256_add_ps(x0, unskew2);
+    const __m256 y2 = _mm256_add_ps(y0, unskew2);
+
+    const __m256i pi = _mm256_mullo_epi32(_mm256_cvttps_epi32(fi), _mm256_set1_epi32(PRIME_X));
+    const __m256i pj = _mm256_mullo_epi32(_mm256_cvttps_epi32(fj), _mm256_set1_epi32(PRIME_Y));
+    const __m256i pi1 = _mm256_add_epi32(pi, PrimeOffset(xGreater, PRIME_X));
+    const __m256i pj1 = _mm256_add_epi32(
+        pj, _mm256_andnot_si256(_mm256_castps_si256(xGreater), _mm256_set1_epi32(PRIME_Y)));
+    const __m256i pi2 = _mm256_add_epi32(pi, _mm256_set1_epi32(PRIME_X));
+    const __m256i pj2 = _mm256_add_epi32(pj, _mm256_set1_epi32(PRIME_Y));
+
+    const __m256 radius = _mm256_set1_ps(0.5f);
+    const __m256 n0 = _mm256_mul_ps(Falloff(radius, x0, y0), Gradient2D(Hash(seed, pi, pj), x0, y0));
+    const __m256 n1 =
+        _mm256_mul_ps(Falloff(radius, x1, y1), Gradient2D(Hash(seed, pi1, pj1), x1, y1));
+    const __m256 n2 =
+        _mm256_mul_ps(Falloff(radius, x2, y2), Gradient2D(Hash(seed, pi2, pj2), x2, y2));
+
+    return _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(n0, n1), n2),
+                         _mm256_set1_ps(SIMPLEX_2D_SCALE));
+}
+
+inline __m256 Simplex3D(__m256i seed, __m256 x, __m256 y, __m256 z)
+{
+    const __m256 s = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(x, y), z), _mm256_set1_ps(SKEW_3D));
+    const __m256 fi = _mm256_floor_ps(_mm256_add_ps(x, s));
+    const __m256 fj = _mm256_floor_ps(_mm256_add_ps(y, s));
+    const __m256 fk = _mm256_floor_ps(_mm256_add_ps(z, s));
+
+    const __m256 t =
+        _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(fi, fj), fk), _mm256_set1_ps(UNSKEW_3D));
+    const __m256 x0 = _mm256_sub_ps(x, _mm256_sub_ps(fi, t));
+    const __m256 y0 = _mm256_sub_ps(y, _mm256_sub_ps(fj, t));
+    const __m256 z0 = _mm256_sub_ps(z, _mm256_sub_ps(fk, t));
+
+    const __m256 xGeY = _mm256_cmp_ps(x0, y0, _CMP_GE_OQ);
+    const __m256 yGeZ = _mm256_cmp_ps(y0, z0, _CMP_GE_OQ);
+    const __m256 xGeZ = _mm256_cmp_ps(x0, z0, _CMP_GE_OQ);
+
+    const __m256 allOnes = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    const __m256 i1 = _mm256_and_ps(xGeY, xGeZ);
+    const __m256 j1 = _mm256_andnot_ps(xGeY, yGeZ);
+    const __m256 k1 = _mm256_andnot_ps(xGeZ, _mm256_xor_ps(yGeZ, allOnes));
+    const __m256 i2 = _mm256_or_ps(xGeY, xGeZ);
+    const __m256 j2 = _mm256_or_ps(_mm256_xor_ps(xGeY, allOnes), yGeZ);
+    const __m256 k2 = _mm256_or_ps(_mm256_xor_ps(xGeZ, allOnes), _mm256_xor_ps(yGeZ, allOnes));
+
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 unskew = _mm256_set1_ps(UNSKEW_3D);
+    const __m256 unskew2 = _mm256_set1_ps(2.0f * UNSKEW_3D);
+    const __m256 unskew3 = _mm256_set1_ps(3.0f * UNSKEW_3D - 1.0f);
+
+    const __m256 x1 = _mm256_add_ps(_mm256_sub_ps(x0, _mm256_and_ps(i1, one)), unskew);
+    const __m256 y1 = _mm256_add_ps(_mm256_sub_ps(y0, _mm256_and_ps(j1, one)), unskew);
+    const __m256 z1 = _mm256_add_ps(_mm256_sub_ps(z0, _mm256_and_ps(k1, one)), unskew);
+    const __m256 x2 = _mm256_add_ps(_mm256_sub_ps(x0, _mm256_and_ps(i2, one)), unskew2);
+    const __m256 y2 = _mm256_add_ps(_mm256_sub_ps(y0, _mm256_and_ps(j2, one)), unskew2);
+    const __m256 z2 = _mm256_add_ps(_mm256_sub_ps(z0, _mm256_and_ps(k2, one)), unskew2);
+    const __m256 x3 = _mm256_add_ps(x0, unskew3);
+    const __m256 y3 = _mm256_add_ps(y0, unskew3);
+    const __m256 z3 = _mm256_add_ps(z0, unskew3);
+
+    const __m256i pi = _mm256_mullo_epi32(_mm256_cvttps_epi32(fi), _mm256_set1_epi32(PRIME_X));
+    const __m256i pj = _mm256_mullo_epi32(_mm256_cvttps_epi32(fj), _mm256_set1_epi32(PRIME_Y));
+    const __m256i pk = _mm256_mullo_epi32(_mm256_cvttps_epi32(fk), _mm256_set1_epi32(PRIME_Z));
+
+    const __m256i h0 = Hash(seed, pi, pj, pk);
+    const __m256i h1 = Hash(seed, _mm256_add_epi32(pi, PrimeOffset(i1, PRIME_X)),
+                            _mm256_add_epi32(pj, PrimeOffset(j1, PRIME_Y)),
+                            _mm256_add_epi32(pk, PrimeOffset(k1, PRIME_Z)));
+    const __m256i h2 = Hash(seed, _mm256_add_epi32(pi, PrimeOffset(i2, PRIME_X)),
+                            _mm256_add_epi32(pj, PrimeOffset(j2, PRIME_Y)),
+                            _mm256_add_epi32(pk, PrimeOffset(k2, PRIME_Z)));
+    const __m256i h3 = Hash(seed, _mm256_add_epi32(pi, _mm256_set1_epi32(PRIME_X)),
+                            _mm256_add_epi32(pj, _mm256_set1_epi32(PRIME_Y)),
+                            _mm256_add_epi32(pk, _mm256_set1_epi32(PRIME_Z)));
+
+    const __m256 radius = _mm256_set1_ps(0.6f);
+    __m256 n = _mm256_mul_ps(Falloff(radius, x0, y0, z0), Gradient3D(h0, x0, y0, z0));
+    n = _mm256_add_ps(n, _mm256_mul_ps(Falloff(radius, x1, y1, z1), Gradient3D(h1, x1, y1, z1)));
+    n = _mm256_add_ps(n, _mm256_mul_ps(Falloff(radius, x2, y2, z2), Gradient3D(h2, x2, y2, z2)));
+    n = _mm256_add_ps(n, _mm256_mul_ps(Falloff(radius, x3, y3, z3), Gradient3D(h3, x3, y3, z3)));
+
+    return _mm256_mul_ps(n, _mm256_set1_ps(SIMPLEX_3D_SCALE));
+}
+
+inline __m256 Value2D(__m256i seed, __m256 x, __m256 y)
+{
+    const __m256 fx = _mm256_floor_ps(x);
+    const __m256 fy = _mm256_floor_ps(y);
+    const __m256 xs = Quintic(_mm256_sub_ps(x, fx));
+    const __m256 ys = Quintic(_mm256_sub_ps(y, fy));
+
+    const __m256i px0 = _mm256_mullo_epi32(_mm256_cvttps_epi32(fx), _mm256_set1_epi32(PRIME_X));
+    const __m256i py0 = _mm256_mullo_epi32(_mm256_cvttps_epi32(fy), _mm256_set1_epi32(PRIME_Y));
+    const __m256i px1 = _mm256_add_epi32(px0, _mm256_set1_epi32(PRIME_X));
+    const __m256i py1 = _mm256_add_epi32(py0, _mm256_set1_epi32(PRIME_Y));
+
+    const __m256 top = Lerp(HashToFloat(Hash(seed, px0, py0)), HashToFloat(Hash(seed, px1, py0)), xs);
+    const __m256 bottom =
+        Lerp(HashToFloat(Hash(seed, px0, py1)), HashToFloat(Hash(seed, px1, py1)), xs);
+    return Lerp(top, bottom, ys);
+}
+
+inline __m256 Value3D(__m256i seed, __m256 x, __m256 y, __m256 z)
+{
+    const __m256 fx = _mm256_floor_ps(x);
+    const __m256 fy = _mm256_floor_ps(y);
+    const __m256 fz = _mm256_floor_ps(z);
+    const __m256 xs = Quintic(_mm256_sub_ps(x, fx));
+    const __m256 ys = Quintic(_mm256_sub_ps(y, fy));
+    const __m256 zs = Quintic(_mm256_sub_ps(z, fz));
+
+    const __m256i px0 = _mm256_mullo_epi32(_mm256_cvttps_epi32(fx), _mm256_set1_epi32(PRIME_X));
+    const __m256i py0 = _mm256_mullo_epi32(_mm256_cvttps_epi32(fy), _mm256_set1_epi32(PRIME_Y));
+    const __m256i pz0 = _mm256_mullo_epi32(_mm256_cvttps_epi32(fz), _mm256_set1_epi32(PRIME_Z));
+    const __m256i px1 = _mm256_add_epi32(px0, _mm256_set1_epi32(PRIME_X));
+    const __m256i py1 = _mm256_add_epi32(py0, _mm256_set1_epi32(PRIME_Y));
+    const __m256i pz1 = _mm256_add_epi32(pz0, _mm256_set1_epi32(PRIME_Z));
+
+    auto lerpX = [&](__m256i py, __m256i pz) {
+        return Lerp(HashToFloat(Hash(seed, px0, py, pz)), HashToFloat(Hash(seed, px1, py, pz)), xs);
+    };
+
+    const __m256 nearValue = Lerp(lerpX(py0, pz0), lerpX(py1, pz0), ys);
+    const __m256 farValue = Lerp(lerpX(py0, pz1), lerpX(py1, pz1), ys);
+    return Lerp(nearValue, farValue, zs);
+}
+
+inline __m256 Fbm2D(int seed, int type, int octaves, float frequency, float lacunarity, float gain,
+                    __m256 x, __m256 y)
+{
+    __m256 sum = _mm256_setzero_ps();
+    float amplitude = 1.0f;
+    float amplitudeSum = 0.0f;
+
+    for (int octave = 0; octave < octaves; ++octave)
+    {
+        const __m256i octaveSeed = _mm256_set1_epi32(seed + octave * OCTAVE_SEED_STEP);
+        const __m256 freq = _mm256_set1_ps(frequency);
+        const __m256 sx = _mm256_mul_ps(x, freq);
+        const __m256 sy = _mm256_mul_ps(y, freq);
+        const __m256 value =
+            type == NOISE_SIMPLEX ? Simplex2D(octaveSeed, sx, sy) : Value2D(octaveSeed, sx, sy);
+
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(value, _mm256_set1_ps(amplitude)));
+        amplitudeSum += amplitude;
+        amplitude *= gain;
+        frequency *= lacunarity;
+    }
+    return amplitudeSum > 0.0f ? _mm256_div_ps(sum, _mm256_set1_ps(amplitudeSum))
+                               : _mm256_setzero_ps();
+}
+
+inline __m256 Fbm3D(int seed, int type, int octaves, float frequency, float lacunarity, float gain,
+                    __m256 x, __m256 y, __m256 z)
+{
+    __m256 sum = _mm256_setzero_ps();
+    float amplitude = 1.0f;
+    float amplitudeSum = 0.0f;
+
+    for (int octave = 0; octave < octaves; ++octave)
+    {
+        const __m256i octaveSeed = _mm256_set1_epi32(seed + octave * OCTAVE_SEED_STEP);
+        const __m256 freq = _mm256_set1_ps(frequency);
+        const __m256 sx = _mm256_mul_ps(x, freq);
+        const __m256 sy = _mm256_mul_ps(y, freq);
+        const __m256 sz = _mm256_mul_ps(z, freq);
+        const __m256 value = type == NOISE_SIMPLEX ? Simplex3D(octaveSeed, sx, sy, sz)
+                                                   : Value3D(octaveSeed, sx, sy, sz);
+
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(value, _mm256_set1_ps(amplitude)));
+        amplitudeSum += amplitude;
+        amplitude *= gain;
+        frequency *= lacunarity;
+    }
+    return amplitudeSum > 0.0f ? _mm256_div_ps(sum, _mm256_set1_ps(amplitudeSum))
+                               : _mm256_setzero_ps();
+}
+
+/**
+ * Run an 8-wide kernel over count points, padding the tail so it takes the same path
+ */
+template<typename Kernel>
+inline void ForEachBlock(const float* x, const float* y, const float* z, float* out,
+                         std::size_t count, Kernel kernel)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 vz = z ? _mm256_loadu_ps(z + i) : _mm256_setzero_ps();
+        _mm256_storeu_ps(out + i, kernel(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i), vz));
+    }
+
+    if (i < count)
+    {
+        alignas(32) float tailX[8] = {};
+        alignas(32) float tailY[8] = {};
+        alignas(32) float tailZ[8] = {};
+        alignas(32) float tailOut[8];
+        const std::size_t remaining = count - i;
+        for (std::size_t j = 0; j < remaining; ++j)
+        {
+            tailX[j] = x[i + j];
+            tailY[j] = y[i + j];
+            tailZ[j] = z ? z[i + j] : 0.0f;
+        }
+
+        _mm256_store_ps(tailOut, kernel(_mm256_load_ps(tailX), _mm256_load_ps(tailY),
+                                        _mm256_load_ps(tailZ)));
+        for (std::size_t j = 0; j < remaining; ++j)
+        {
+            out[i + j] = tailOut[j];
+        }
+    }
+}
+} // namespace
+
+void Simplex2DAVX2(int seed, const float* x, const float* y, float* out, std::size_t count)
+{
+    const __m256i vseed = _mm256_set1_epi32(seed);
+    ForEachBlock(x, y, nullptr, out, count,
+                 [vseed](__m256 vx, __m256 vy, __m256) { return Simplex2D(vseed, vx, vy); });
+}
+
+void Simplex3DAVX2(int seed, const float* x, const float* y, const float* z, float* out,
+                   std::size_t count)
+{
+    const __m256i vseed = _mm256_set1_epi32(seed);
+    ForEachBlock(x, y, z, out, count,
+                 [vseed](__m256 vx, __m256 vy, __m256 vz) { return Simplex3D(vseed, vx, vy, vz); });
+}
+
+void Value2DAVX2(int seed, const float* x, const float* y, float* out, std::size_t count)
+{
+    const __m256i vseed = _mm256_set1_epi32(seed);
+    ForEachBlock(x, y, nullptr, out, count,
+                 [vseed](__m256 vx, __m256 vy, __m256) { return Value2D(vseed, vx, vy); });
+}
+
+void Value3DAVX2(int seed, const float* x, const float* y, const float* z, float* out,
+                 std::size_t count)
+{
+    const __m256i vseed = _mm256_set1_epi32(seed);
+    ForEachBlock(x, y, z, out, count,
+                 [vseed](__m256 vx, __m256 vy, __m256 vz) { return Value3D(vseed, vx, vy, vz); });
+}
+
+void Fbm2DAVX2(int seed, int type, int octaves, float frequency, float lacunarity, float gain,
+               const float* x, const float* y, float* out, std::size_t count)
+{
+    ForEachBlock(x, y, nullptr, out, count, [=](__m256 vx, __m256 vy, __m256) {
+        return Fbm2D(seed, type, octaves, frequency, lacunarity, gain, vx, vy);
+    });
+}
+
+void Fbm3DAVX2(int seed, int type, int octaves, float frequency, float lacunarity, float gain,
+               const float* x, const float* y, const float* z, float* out, std::size_t count)
+{
+    ForEachBlock(x, y, z, out, count, [=](__m256 vx, __m256 vy, __m256 vz) {
+        return Fbm3D(seed, type, octaves, frequency, lacunarity, gain, vx, vy, vz);
+    });
+}
+} // namespace Noise::Kernels
+
+#endif
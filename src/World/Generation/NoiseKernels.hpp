@@ -0,0 +1,42 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include <cstddef>
+
+// Shared between Noise.cpp and NoiseAVX2.cpp. NoiseAVX2.cpp is compiled with AVX2 code
+// generation, so this header must not declare inline functions or types with implicit
+// inline members: the linker could otherwise keep the AVX2 copy for the whole program.
+namespace Noise::Kernels
+{
+constexpr int PRIME_X = 501125321;
+constexpr int PRIME_Y = 1136930381;
+constexpr int PRIME_Z = 1720413743;
+constexpr int HASH_MULTIPLIER = 0x27d4eb2d;
+constexpr int OCTAVE_SEED_STEP = 1013;
+
+constexpr float SKEW_2D = 0.36602540378f;   // (sqrt(3) - 1) / 2
+constexpr float UNSKEW_2D = 0.21132486540f; // (3 - sqrt(3)) / 6
+constexpr float SKEW_3D = 1.0f / 3.0f;
+constexpr float UNSKEW_3D = 1.0f / 6.0f;
+
+constexpr float SIMPLEX_2D_SCALE = 45.0f;
+constexpr float SIMPLEX_3D_SCALE = 32.0f;
+constexpr float HASH_TO_FLOAT = 1.0f / 2147483648.0f;
+
+constexpr int NOISE_SIMPLEX = 0;
+constexpr int NOISE_VALUE = 1;
+
+#ifdef SILK_NOISE_AVX2
+void Simplex2DAVX2(int seed, const float* x, const float* y, float* out, std::size_t count);
+void Simplex3DAVX2(int seed, const float* x, const float* y, const float* z, float* out,
+                   std::size_t count);
+void Value2DAVX2(int seed, const float* x, const float* y, float* out, std::size_t count);
+void Value3DAVX2(int seed, const float* x, const float* y, const float* z, float* out,
+                 std::size_t count);
+void Fbm2DAVX2(int seed, int type, int octaves, float frequency, float lacunarity, float gain,
+               const float* x, const float* y, float* out, std::size_t count);
+void Fbm3DAVX2(int seed, int type, int octaves, float frequency, float lacunarity, float gain,
+               const float* x, const float* y, const float* z, float* out, std::size_t count);
+#endif
+} // namespace Noise::Kernels
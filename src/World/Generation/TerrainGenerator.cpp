@@ -0,0 +1,193 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "TerrainGenerator.hpp"
+
+#include "Core/JobSystem.hpp"
+#include "Core/Math/Math.hpp"
+#include "Core/Profiling/Profiler.hpp"
+#include "World/ChunkLod.hpp"
+#include "World/World.hpp"
+
+#include <algorithm>
+
+namespace
+{
+// dirt layer thickness under the grass
+constexpr int SOIL_DEPTH = 4;
+} // namespace
+
+TerrainGenerator::TerrainGenerator(const TerrainSettings& settings)
+    : m_settings(settings)
+{
+}
+
+TerrainGenerator::ChunkColumn TerrainGenerator::GenerateColumn(int chunkX, int chunkZ) const
+{
+    PROFILE_SCOPE("GenerateColumn");
+    int heights[Chunk::AREA];
+    GenerateHeightmap(chunkX, chunkZ, heights);
+
+    const int maxHeight = *std::max_element(heights, heights + Chunk::AREA);
+    const int topFilled = std::max(maxHeight, m_settings.seaLevel);
+
+    ChunkColumn column;
+    for (int cy = 0; cy < COLUMN_HEIGHT; ++cy)
+    {
+        const int chunkBottom = cy * Chunk::SIZE;
+        if (chunkBottom > topFilled)
+            break;
+
+        auto chunk = std::make_unique<Chunk>(ChunkCoord{chunkX, cy, chunkZ});
+        BlockId* blocks = chunk->GetData();
+
+        for (int ly = 0; ly < Chunk::SIZE; ++ly)
+        {
+            const int y = chunkBottom + ly;
+            for (int i = 0; i < Chunk::AREA; ++i)
+            {
+                const int height = heights[i];
+                BlockId block = BLOCK_AIR;
+                if (y < height - SOIL_DEPTH)
+                    block = m_settings.stoneBlock;
+                else if (y < height)
+                    block = m_settings.dirtBlock;
+                else if (y == height)
+                    block = height < m_settings.seaLevel ? m_settings.dirtBlock
+                                                         : m_settings.grassBlock;
+                else if (y <= m_settings.seaLevel)
+                    block = m_settings.waterBlock;
+
+                blocks[ly * Chunk::AREA + i] = block;
+            }
+
+            // y == 0 stays solid so the world always has a floor
+            if (y > 0 && y <= maxHeight)
+                CarveSlice(chunkX, chunkZ, y, heights, *chunk);
+        }
+
+        if (!chunk->IsEmpty())
+            column[cy] = std::move(chunk);
+    }
+    return column;
+}
+
+std::size_t TerrainGenerator::GenerateColumns(JobSystem& jobs, World& world,
+                                              const std::vector<ChunkCoord>& columns) const
+{
+    std::vector<ChunkColumn> results(columns.size());
+
+    jobs.ParallelFor(columns.size(), 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            results[i] = GenerateColumn(columns[i].x, columns[i].z);
+        }
+    });
+
+    // the world map is not thread-safe, so insertion happens on the calling thread
+    std::size_t inserted = 0;
+    for (ChunkColumn& column : results)
+    {
+        for (std::unique_ptr<Chunk>& chunk : column)
+        {
+            if (chunk)
+            {
+                world.InsertChunk(std::move(chunk));
+                ++inserted;
+            }
+        }
+    }
+    return inserted;
+}
+
+std::size_t TerrainGenerator::GenerateLodColumns(JobSystem& jobs, LodStore& store,
+                                                 const std::vector<ChunkCoord>& columns) const
+{
+    std::vector<std::array<std::unique_ptr<ChunkLod>, COLUMN_HEIGHT>> results(columns.size());
+
+    jobs.ParallelFor(columns.size(), 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            ChunkColumn column = GenerateColumn(columns[i].x, columns[i].z);
+            for (int y = 0; y < COLUMN_HEIGHT; ++y)
+            {
+                if (column[y])
+                {
+                    results[i][y] = std::make_unique<ChunkLod>(*column[y]);
+                }
+            }
+        }
+    });
+
+    std::size_t inserted = 0;
+    for (auto& column : results)
+    {
+        for (std::unique_ptr<ChunkLod>& lod : column)
+        {
+            if (lod)
+            {
+                store.Insert(std::move(lod));
+                ++inserted;
+            }
+        }
+    }
+    return inserted;
+}
+
+void TerrainGenerator::GenerateHeightmap(int chunkX, int chunkZ, int* heights) const
+{
+    float xs[Chunk::AREA];
+    float zs[Chunk::AREA];
+    float noise[Chunk::AREA];
+
+    const int baseX = chunkX * Chunk::SIZE;
+    const int baseZ = chunkZ * Chunk::SIZE;
+    for (int i = 0; i < Chunk::AREA; ++i)
+    {
+        xs[i] = static_cast<float>(baseX + (i & Chunk::MASK));
+        zs[i] = static_cast<float>(baseZ + (i >> Chunk::SIZE_BITS));
+    }
+
+    Noise::DomainWarp2DBatch(m_settings.seed + 1, m_settings.warp, m_settings.warpAmplitude, xs, zs,
+                             Chunk::AREA);
+    Noise::Fbm2DBatch(m_settings.seed, m_settings.height, xs, zs, noise, Chunk::AREA);
+
+    const int maxWorldY = COLUMN_HEIGHT * Chunk::SIZE - 1;
+    for (int i = 0; i < Chunk::AREA; ++i)
+    {
+        const float height = m_settings.baseHeight + noise[i] * m_settings.heightAmplitude;
+        heights[i] = std::clamp(Math::FloorToInt(height), 1, maxWorldY);
+    }
+}
+
+void TerrainGenerator::CarveSlice(int chunkX, int chunkZ, int y, const int* heights,
+                                  Chunk& chunk) const
+{
+    float xs[Chunk::AREA];
+    float ys[Chunk::AREA];
+    float zs[Chunk::AREA];
+    float density[Chunk::AREA];
+
+    const int baseX = chunkX * Chunk::SIZE;
+    const int baseZ = chunkZ * Chunk::SIZE;
+    // caves are stretched horizontally so they read as tunnels rather than blobs
+    const float sampleY = static_cast<float>(y) * 2.0f;
+    for (int i = 0; i < Chunk::AREA; ++i)
+    {
+        xs[i] = static_cast<float>(baseX + (i & Chunk::MASK));
+        ys[i] = sampleY;
+        zs[i] = static_cast<float>(baseZ + (i >> Chunk::SIZE_BITS));
+    }
+
+    Noise::Fbm3DBatch(m_settings.seed + 2, m_settings.caves, xs, ys, zs, density, Chunk::AREA);
+
+    BlockId* slice = chunk.GetData() + BlockToLocal(y) * Chunk::AREA;
+    for (int i = 0; i < Chunk::AREA; ++i)
+    {
+        // keep a lid over caves that would otherwise open into the sea
+        const bool underwater = heights[i] < m_settings.seaLevel && y >= heights[i] - SOIL_DEPTH;
+        if (y <= heights[i] && !underwater && density[i] > m_settings.caveThreshold)
+            slice[i] = BLOCK_AIR;
+    }
+}
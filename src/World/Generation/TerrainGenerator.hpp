@@ -0,0 +1,85 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Noise.hpp"
+#include "World/Chunk.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class JobSystem;
+class LodStore;
+class World;
+
+struct TerrainSettings
+{
+    int seed = 1337;
+    int seaLevel = 48;
+    float baseHeight = 64.0f;
+    float heightAmplitude = 48.0f;
+
+    Noise::FractalSettings height{Noise::NoiseType::Simplex, 5, 0.004f, 2.0f, 0.5f};
+    Noise::FractalSettings warp{Noise::NoiseType::Simplex, 2, 0.002f, 2.0f, 0.5f};
+    float warpAmplitude = 60.0f;
+
+    Noise::FractalSettings caves{Noise::NoiseType::Simplex, 2, 0.03f, 2.0f, 0.5f};
+    float caveThreshold = 0.55f;
+
+    BlockId stoneBlock = 1;
+    BlockId dirtBlock = 2;
+    BlockId grassBlock = 3;
+    BlockId waterBlock = 4;
+};
+
+/**
+ * Procedural terrain: a domain-warped fBm heightmap with 3D noise caves. A whole chunk
+ * column is produced per call so the noise kernels always run over full 32x32 slices.
+ */
+class TerrainGenerator
+{
+public:
+    static constexpr int COLUMN_HEIGHT = WORLD_HEIGHT_CHUNKS;
+
+    using ChunkColumn = std::array<std::unique_ptr<Chunk>, COLUMN_HEIGHT>;
+
+    explicit TerrainGenerator(const TerrainSettings& settings = {});
+
+    [[nodiscard]] const TerrainSettings& GetSettings() const { return m_settings; }
+
+    /**
+     * Generate every chunk of a column. Chunks that are entirely air are left null.
+     * Safe to call from several threads at once.
+     */
+    [[nodiscard]] ChunkColumn GenerateColumn(int chunkX, int chunkZ) const;
+
+    /**
+     * Generate columns on the job system and insert the results into the world
+     * @return Number of non-empty chunks added to the world
+     */
+    std::size_t GenerateColumns(JobSystem& jobs, World& world,
+                                const std::vector<ChunkCoord>& columns) const;
+
+    /**
+     * Generate columns that will only be drawn at a reduced level of detail. Only the
+     * downsampled chunks are kept; the full resolution data is dropped on the worker.
+     * @return Number of non-empty chunks added to the store
+     */
+    std::size_t GenerateLodColumns(JobSystem& jobs, LodStore& store,
+                                   const std::vector<ChunkCoord>& columns) const;
+
+private:
+    TerrainSettings m_settings;
+
+    /**
+     * Fill heights (Chunk::AREA entries, x-fastest) with the surface height of each block column
+     */
+    void GenerateHeightmap(int chunkX, int chunkZ, int* heights) const;
+
+    /**
+     * Carve caves into the solid part of a horizontal slice
+     */
+    void CarveSlice(int chunkX, int chunkZ, int y, const int* heights, Chunk& chunk) const;
+};
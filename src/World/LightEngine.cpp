@@ -0,0 +1,541 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "LightEngine.hpp"
+
+#include "Core/JobSystem.hpp"
+#include "Core/Memory/TransientMemory.hpp"
+#include "Core/Profiling/Profiler.hpp"
+#include "World.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory_resource>
+#include <unordered_map>
+
+namespace
+{
+constexpr std::uint8_t MAX_LIGHT = BlockRegistry::MAX_LIGHT;
+
+enum class LightChannel
+{
+    Sky,
+    Block
+};
+
+constexpr int DIRECTION_DOWN = 3;
+} // namespace
+
+/**
+ * Per-task BFS state. Caches the last chunk looked up so that consecutive cells in the
+ * same chunk (the common case) skip the hash map. The queues live in the task's scratch
+ * arena.
+ */
+class LightEngine::Propagator
+{
+public:
+    Propagator(World& world, const BlockRegistry& registry, std::pmr::memory_resource* memory)
+        : m_world(world)
+        , m_registry(registry)
+        , m_addQueue{LightQueue(memory), LightQueue(memory)}
+        , m_removeQueue{LightQueue(memory), LightQueue(memory)}
+    {
+    }
+
+    struct Cell
+    {
+        Chunk* chunk = nullptr;
+        int index = 0;
+    };
+
+    struct LightNode
+    {
+        int x, y, z;
+        std::uint8_t level;
+    };
+
+    using LightQueue = std::pmr::vector<LightNode>;
+
+    Cell Locate(int x, int y, int z)
+    {
+        if (y < 0 || y >= WORLD_HEIGHT)
+            return {};
+
+        const ChunkCoord coord = BlockToChunkCoord(x, y, z);
+        if (!m_hasCachedChunk || coord != m_cachedCoord)
+        {
+            m_cachedCoord = coord;
+            m_cachedChunk = m_world.GetChunk(coord);
+            m_hasCachedChunk = true;
+        }
+
+        // chunks waiting for their column to be lit neither give nor take light
+        if (!m_cachedChunk || !m_cachedChunk->IsLightReady())
+            return {};
+        return {m_cachedChunk, Chunk::Index(BlockToLocal(x), BlockToLocal(y), BlockToLocal(z))};
+    }
+
+    static std::uint8_t Read(LightChannel channel, const Cell& cell)
+    {
+        if (!cell.chunk)
+            return 0;
+        return channel == LightChannel::Sky ? cell.chunk->GetSkyLight(cell.index)
+                                            : cell.chunk->GetBlockLight(cell.index);
+    }
+
+    void Write(LightChannel channel, const Cell& cell, int x, int y, int z, std::uint8_t level)
+    {
+        if (channel == LightChannel::Sky)
+            cell.chunk->SetSkyLight(cell.index, level);
+        else
+            cell.chunk->SetBlockLight(cell.index, level);
+
+        cell.chunk->SetDirty(true);
+
+        // smooth lighting samples across chunk borders, so the neighbour's mesh is stale too
+        const int lx = BlockToLocal(x), ly = BlockToLocal(y), lz = BlockToLocal(z);
+        if (lx == 0 || lx == Chunk::MASK || ly == 0 || ly == Chunk::MASK || lz == 0 ||
+            lz == Chunk::MASK)
+        {
+            MarkBorderNeighborsDirty(x, y, z);
+        }
+    }
+
+    /**
+     * Whether a position has open sky above it: either outside the stored world or in an
+     * all-air chunk that was never allocated
+     */
+    bool IsOpenSky(int x, int y, int z)
+    {
+        if (y >= WORLD_HEIGHT)
+            return true;
+        return y >= 0 && !m_world.GetChunk(BlockToChunkCoord(x, y, z));
+    }
+
+    bool IsTransparent(const Cell& cell) const
+    {
+        return cell.chunk && !m_registry.IsOpaque(cell.chunk->GetBlock(cell.index));
+    }
+
+    void PushAdd(LightChannel channel, int x, int y, int z, std::uint8_t level)
+    {
+        Queue(m_addQueue, channel).push_back({x, y, z, level});
+    }
+
+    void PushRemove(LightChannel channel, int x, int y, int z, std::uint8_t level)
+    {
+        Queue(m_removeQueue, channel).push_back({x, y, z, level});
+    }
+
+    /**
+     * Clear light that depended on the removed nodes, re-queueing brighter neighbours that
+     * must flood back into the cleared region
+     */
+    void RunRemoval(LightChannel channel)
+    {
+        LightQueue& queue = Queue(m_removeQueue, channel);
+        for (std::size_t head = 0; head < queue.size(); ++head)
+        {
+            const LightNode node = queue[head];
+            for (int d = 0; d < 6; ++d)
+            {
+                const int nx = node.x + NEIGHBOR_DIRECTIONS[d][0];
+                const int ny = node.y + NEIGHBOR_DIRECTIONS[d][1];
+                const int nz = node.z + NEIGHBOR_DIRECTIONS[d][2];
+                const Cell neighbor = Locate(nx, ny, nz);
+                if (!neighbor.chunk)
+                    continue;
+
+                const std::uint8_t level = Read(channel, neighbor);
+                if (level == 0)
+                    continue;
+
+                const bool skyColumn = channel == LightChannel::Sky && d == DIRECTION_DOWN &&
+                                       node.level == MAX_LIGHT && level == MAX_LIGHT;
+                if (level < node.level || skyColumn)
+                {
+                    Write(channel, neighbor, nx, ny, nz, 0);
+                    queue.push_back({nx, ny, nz, level});
+                }
+                else
+                {
+                    PushAdd(channel, nx, ny, nz, level);
+                }
+            }
+        }
+        queue.clear();
+    }
+
+    /**
+     * Spread light outward from the queued nodes
+     */
+    void RunAddition(LightChannel channel)
+    {
+        LightQueue& queue = Queue(m_addQueue, channel);
+        for (std::size_t head = 0; head < queue.size(); ++head)
+        {
+            const LightNode node = queue[head];
+            const std::uint8_t level = Read(channel, Locate(node.x, node.y, node.z));
+            if (level <= 1)
+                continue;
+
+            for (int d = 0; d < 6; ++d)
+            {
+                const int nx = node.x + NEIGHBOR_DIRECTIONS[d][0];
+                const int ny = node.y + NEIGHBOR_DIRECTIONS[d][1];
+                const int nz = node.z + NEIGHBOR_DIRECTIONS[d][2];
+                const Cell neighbor = Locate(nx, ny, nz);
+                if (!IsTransparent(neighbor))
+                    continue;
+
+                // sunlight travels straight down without fading
+                const bool skyColumn =
+                    channel == LightChannel::Sky && d == DIRECTION_DOWN && level == MAX_LIGHT;
+                const auto target = static_cast<std::uint8_t>(skyColumn ? MAX_LIGHT : level - 1);
+                if (Read(channel, neighbor) < target)
+                {
+                    Write(channel, neighbor, nx, ny, nz, target);
+                    queue.push_back({nx, ny, nz, target});
+                }
+            }
+        }
+        queue.clear();
+    }
+
+    World& GetWorld() { return m_world; }
+    const BlockRegistry& GetRegistry() const { return m_registry; }
+
+private:
+    World& m_world;
+    const BlockRegistry& m_registry;
+
+    ChunkCoord m_cachedCoord;
+    Chunk* m_cachedChunk = nullptr;
+    bool m_hasCachedChunk = false;
+
+    std::array<LightQueue, 2> m_addQueue;
+    std::array<LightQueue, 2> m_removeQueue;
+
+    static LightQueue& Queue(std::array<LightQueue, 2>& queues, LightChannel channel)
+    {
+        return queues[channel == LightChannel::Sky ? 0 : 1];
+    }
+
+    void MarkBorderNeighborsDirty(int x, int y, int z)
+    {
+        for (const auto& direction : NEIGHBOR_DIRECTIONS)
+        {
+            const int ny = y + direction[1];
+            if (ny < 0 || ny >= WORLD_HEIGHT)
+                continue;
+
+            const ChunkCoord coord = BlockToChunkCoord(x + direction[0], ny, z + direction[2]);
+            if (coord != m_cachedCoord)
+            {
+                if (Chunk* neighbor = m_world.GetChunk(coord))
+                    neighbor->SetDirty(true);
+            }
+        }
+    }
+};
+
+LightEngine::LightEngine(World& world, const BlockRegistry& registry)
+    : m_world(world)
+    , m_registry(registry)
+{
+}
+
+template<typename Func>
+void LightEngine::ForEachColumnColored(JobSystem& jobs, const ChunkCoord* columns, std::size_t count,
+                                       Func&& func)
+{
+    // counting sort of the column indices by colour
+    ScratchScope scratch;
+    std::array<std::size_t, 10> starts{};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        ++starts[ColumnColor(columns[i].x, columns[i].z) + 1];
+    }
+    for (std::size_t color = 0; color < 9; ++color)
+    {
+        starts[color + 1] += starts[color];
+    }
+
+    std::pmr::vector<std::size_t> order(count, &scratch.GetArena());
+    std::array<std::size_t, 9> cursors{};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const int color = ColumnColor(columns[i].x, columns[i].z);
+        order[starts[color] + cursors[color]++] = i;
+    }
+
+    const std::size_t* bucket = nullptr;
+    auto runRange = [&](std::size_t begin, std::size_t end) {
+        PROFILE_SCOPE("LightColumns");
+        ScratchScope taskScratch;
+        Propagator propagator(m_world, m_registry, &taskScratch.GetArena());
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            func(propagator, bucket[i]);
+        }
+    };
+
+    for (std::size_t color = 0; color < 9; ++color)
+    {
+        bucket = order.data() + starts[color];
+        jobs.ParallelFor(starts[color + 1] - starts[color], 1, runRange);
+    }
+}
+
+void LightEngine::LightColumns(JobSystem& jobs, const std::vector<ChunkCoord>& columns)
+{
+    ForEachColumnColored(jobs, columns.data(), columns.size(), [&](Propagator& propagator, std::size_t columnIndex) {
+        const int chunkX = columns[columnIndex].x;
+        const int chunkZ = columns[columnIndex].z;
+        const int baseX = chunkX * Chunk::SIZE;
+        const int baseZ = chunkZ * Chunk::SIZE;
+
+        std::array<Chunk*, WORLD_HEIGHT_CHUNKS> chunks{};
+        for (int cy = 0; cy < WORLD_HEIGHT_CHUNKS; ++cy)
+        {
+            chunks[cy] = m_world.GetChunk({chunkX, cy, chunkZ});
+            if (chunks[cy])
+            {
+                chunks[cy]->FillSkyLight(0);
+                chunks[cy]->FillBlockLight(0);
+                chunks[cy]->SetLightReady(true);
+                chunks[cy]->SetDirty(true);
+            }
+        }
+
+        // sunlight: straight down each block column until the first opaque block
+        std::array<int, Chunk::AREA> skyBottom{};
+        for (int lz = 0; lz < Chunk::SIZE; ++lz)
+        {
+            for (int lx = 0; lx < Chunk::SIZE; ++lx)
+            {
+                int y = WORLD_HEIGHT - 1;
+                for (; y >= 0; --y)
+                {
+                    Chunk* chunk = chunks[BlockToChunk(y)];
+                    if (!chunk)
+                        continue;
+
+                    const int index = Chunk::Index(lx, BlockToLocal(y), lz);
+                    if (m_registry.IsOpaque(chunk->GetBlock(index)))
+                        break;
+                    chunk->SetSkyLight(index, MAX_LIGHT);
+                }
+                skyBottom[lx + lz * Chunk::SIZE] = y + 1;
+            }
+        }
+
+        // sunlit cells beside a deeper or shallower neighbour column are where sideways spread
+        // starts; interior cells of a flat sunlit area have nothing to add
+        for (int lz = 0; lz < Chunk::SIZE; ++lz)
+        {
+            for (int lx = 0; lx < Chunk::SIZE; ++lx)
+            {
+                const int bottom = skyBottom[lx + lz * Chunk::SIZE];
+                int seedTop = bottom;
+                for (const int d : {0, 1, 4, 5})
+                {
+                    const int nx = lx + NEIGHBOR_DIRECTIONS[d][0];
+                    const int nz = lz + NEIGHBOR_DIRECTIONS[d][2];
+                    if (nx < 0 || nx >= Chunk::SIZE || nz < 0 || nz >= Chunk::SIZE)
+                        seedTop = std::max(seedTop, WORLD_HEIGHT);
+                    else
+                        seedTop = std::max(seedTop, skyBottom[nx + nz * Chunk::SIZE]);
+                }
+
+                for (int y = bottom; y < seedTop && y < WORLD_HEIGHT; ++y)
+                {
+                    if (chunks[BlockToChunk(y)])
+                        propagator.PushAdd(LightChannel::Sky, baseX + lx, y, baseZ + lz, MAX_LIGHT);
+                }
+            }
+        }
+
+        // emitters inside the column
+        for (int cy = 0; cy < WORLD_HEIGHT_CHUNKS; ++cy)
+        {
+            Chunk* chunk = chunks[cy];
+            if (!chunk)
+                continue;
+
+            for (int index = 0; index < Chunk::VOLUME; ++index)
+            {
+                if (const std::uint8_t emission = m_registry.GetLightEmission(chunk->GetBlock(index)))
+                {
+                    chunk->SetBlockLight(index, emission);
+                    const int lx = index & Chunk::MASK;
+                    const int lz = (index >> Chunk::SIZE_BITS) & Chunk::MASK;
+                    const int ly = index >> (2 * Chunk::SIZE_BITS);
+                    propagator.PushAdd(LightChannel::Block, baseX + lx, cy * Chunk::SIZE + ly,
+                                       baseZ + lz, emission);
+                }
+            }
+        }
+
+        // light already present in lit neighbour columns flows across the border
+        for (int y = 0; y < WORLD_HEIGHT; ++y)
+        {
+            for (int i = 0; i < Chunk::SIZE; ++i)
+            {
+                const int borders[4][2] = {{baseX - 1, baseZ + i},
+                                           {baseX + Chunk::SIZE, baseZ + i},
+                                           {baseX + i, baseZ - 1},
+                                           {baseX + i, baseZ + Chunk::SIZE}};
+                for (const auto& border : borders)
+                {
+                    const auto cell = propagator.Locate(border[0], y, border[1]);
+                    if (!cell.chunk)
+                        continue;
+
+                    if (const std::uint8_t sky = Propagator::Read(LightChannel::Sky, cell); sky > 1)
+                        propagator.PushAdd(LightChannel::Sky, border[0], y, border[1], sky);
+                    if (const std::uint8_t block = Propagator::Read(LightChannel::Block, cell);
+                        block > 1)
+                        propagator.PushAdd(LightChannel::Block, border[0], y, border[1], block);
+                }
+            }
+        }
+
+        propagator.RunAddition(LightChannel::Sky);
+        propagator.RunAddition(LightChannel::Block);
+    });
+}
+
+void LightEngine::OnBlockChanged(int x, int y, int z, BlockId oldBlock, BlockId newBlock)
+{
+    if (oldBlock == newBlock || y < 0 || y >= WORLD_HEIGHT)
+        return;
+
+    m_pendingEdits.push_back({x, y, z, oldBlock, newBlock});
+}
+
+void LightEngine::RemoveColumns(const std::vector<ChunkCoord>& columns)
+{
+    const auto removed = [&columns](const BlockEdit& edit) {
+        const ChunkCoord column{BlockToChunk(edit.x), 0, BlockToChunk(edit.z)};
+        return std::any_of(columns.begin(), columns.end(), [&column](const ChunkCoord& coord) {
+            return coord.x == column.x && coord.z == column.z;
+        });
+    };
+    m_pendingEdits.erase(std::remove_if(m_pendingEdits.begin(), m_pendingEdits.end(), removed), m_pendingEdits.end());
+}
+
+std::size_t LightEngine::ProcessUpdates(JobSystem& jobs)
+{
+    // chunks loaded through LightColumns are ready by now; the rest were created by edits
+    m_world.TakeCreatedChunks(m_createdChunks);
+    m_unlitColumns.clear();
+    for (const ChunkCoord& coord : m_createdChunks)
+    {
+        const Chunk* chunk = m_world.GetChunk(coord);
+        const ChunkCoord column{coord.x, 0, coord.z};
+        if (chunk && !chunk->IsLightReady() &&
+            std::find(m_unlitColumns.begin(), m_unlitColumns.end(), column) == m_unlitColumns.end())
+        {
+            m_unlitColumns.push_back(column);
+        }
+    }
+    if (!m_unlitColumns.empty())
+        LightColumns(jobs, m_unlitColumns);
+
+    if (m_pendingEdits.empty())
+        return 0;
+
+    // group edits by column, keeping their original order within a column
+    ScratchScope scratch;
+    std::pmr::unordered_map<std::uint64_t, std::size_t> columnIndex(&scratch.GetArena());
+    std::pmr::vector<ChunkCoord> columns(&scratch.GetArena());
+    std::pmr::vector<std::pmr::vector<BlockEdit>> columnEdits(&scratch.GetArena());
+    for (const BlockEdit& edit : m_pendingEdits)
+    {
+        const int chunkX = BlockToChunk(edit.x);
+        const int chunkZ = BlockToChunk(edit.z);
+        const auto [it, inserted] = columnIndex.try_emplace(ColumnKey(chunkX, chunkZ), columns.size());
+        if (inserted)
+        {
+            columns.push_back({chunkX, 0, chunkZ});
+            columnEdits.emplace_back();
+        }
+        columnEdits[it->second].push_back(edit);
+    }
+
+    const std::size_t processed = m_pendingEdits.size();
+    m_pendingEdits.clear();
+
+    ForEachColumnColored(jobs, columns.data(), columns.size(), [&](Propagator& propagator, std::size_t column) {
+        for (const BlockEdit& edit : columnEdits[column])
+        {
+            const auto cell = propagator.Locate(edit.x, edit.y, edit.z);
+            if (!cell.chunk)
+                continue;
+
+            const bool transparent = !m_registry.IsOpaque(edit.newBlock);
+            const std::uint8_t emission = m_registry.GetLightEmission(edit.newBlock);
+
+            for (const LightChannel channel : {LightChannel::Sky, LightChannel::Block})
+            {
+                if (const std::uint8_t oldLevel = Propagator::Read(channel, cell); oldLevel > 0)
+                {
+                    propagator.Write(channel, cell, edit.x, edit.y, edit.z, 0);
+                    propagator.PushRemove(channel, edit.x, edit.y, edit.z, oldLevel);
+                    propagator.RunRemoval(channel);
+                }
+
+                if (channel == LightChannel::Block && emission > 0)
+                {
+                    propagator.Write(channel, cell, edit.x, edit.y, edit.z, emission);
+                    propagator.PushAdd(channel, edit.x, edit.y, edit.z, emission);
+                }
+
+                if (transparent)
+                {
+                    if (channel == LightChannel::Sky && propagator.IsOpenSky(edit.x, edit.y + 1, edit.z))
+                    {
+                        propagator.Write(channel, cell, edit.x, edit.y, edit.z, MAX_LIGHT);
+                        propagator.PushAdd(channel, edit.x, edit.y, edit.z, MAX_LIGHT);
+                    }
+
+                    // neighbours flood back into the now transparent cell
+                    for (const auto& direction : NEIGHBOR_DIRECTIONS)
+                    {
+                        const int nx = edit.x + direction[0];
+                        const int ny = edit.y + direction[1];
+                        const int nz = edit.z + direction[2];
+                        const auto neighbor = propagator.Locate(nx, ny, nz);
+                        if (const std::uint8_t level = Propagator::Read(channel, neighbor); level > 1)
+                            propagator.PushAdd(channel, nx, ny, nz, level);
+                    }
+                }
+
+                propagator.RunAddition(channel);
+            }
+        }
+    });
+
+    return processed;
+}
+
+std::uint8_t LightEngine::GetSkyLight(int x, int y, int z) const
+{
+    if (y >= WORLD_HEIGHT)
+        return MAX_LIGHT;
+
+    if (const Chunk* chunk = m_world.GetChunk(BlockToChunkCoord(x, y, z)))
+        return chunk->GetSkyLight(Chunk::Index(BlockToLocal(x), BlockToLocal(y), BlockToLocal(z)));
+
+    return y >= 0 ? MAX_LIGHT : 0;
+}
+
+std::uint8_t LightEngine::GetBlockLight(int x, int y, int z) const
+{
+    if (const Chunk* chunk = m_world.GetChunk(BlockToChunkCoord(x, y, z)))
+        return chunk->GetBlockLight(Chunk::Index(BlockToLocal(x), BlockToLocal(y), BlockToLocal(z)));
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "BlockRegistry.hpp"
+#include "Chunk.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class JobSystem;
+class World;
+
+/**
+ * Flood-fill voxel lighting with separate sky and block channels.
+ *
+ * Edits are relit incrementally with BFS removal/addition queues, so a block change
+ * only touches the cells whose light actually depended on it. Light never travels more
+ * than 15 blocks sideways, which is less than a chunk, so the work for a column only
+ * reaches its 8 neighbouring columns. Columns are processed in 9 colour phases
+ * (x mod 3, z mod 3) and same-coloured columns run in parallel without sharing cells.
+ */
+class LightEngine
+{
+public:
+    LightEngine(World& world, const BlockRegistry& registry);
+
+    /**
+     * Compute light from scratch for freshly generated or loaded columns (chunk y ignored),
+     * pulling in light from already lit neighbours
+     */
+    void LightColumns(JobSystem& jobs, const std::vector<ChunkCoord>& columns);
+
+    /**
+     * Queue a relight for a block that has already been changed in the world
+     */
+    void OnBlockChanged(int x, int y, int z, BlockId oldBlock, BlockId newBlock);
+
+    /**
+     * Drop queued relights inside columns that are about to be unloaded (chunk y ignored);
+     * the light itself is stored in the chunks and goes with them
+     */
+    void RemoveColumns(const std::vector<ChunkCoord>& columns);
+
+    /**
+     * Light the columns of chunks the world created since the last call (see
+     * World::GetOrCreateChunk), then apply every queued block change
+     * @return Number of changes processed
+     */
+    std::size_t ProcessUpdates(JobSystem& jobs);
+
+    [[nodiscard]] std::size_t GetPendingUpdateCount() const { return m_pendingEdits.size(); }
+
+    [[nodiscard]] std::uint8_t GetSkyLight(int x, int y, int z) const;
+    [[nodiscard]] std::uint8_t GetBlockLight(int x, int y, int z) const;
+
+private:
+    struct BlockEdit
+    {
+        int x, y, z;
+        BlockId oldBlock;
+        BlockId newBlock;
+    };
+
+    class Propagator;
+
+    World& m_world;
+    const BlockRegistry& m_registry;
+    std::vector<BlockEdit> m_pendingEdits;
+    std::vector<ChunkCoord> m_createdChunks; // reused
+    std::vector<ChunkCoord> m_unlitColumns; // reused
+
+    /**
+     * Run func(propagator, column index) over the columns in 9 non-interfering phases
+     */
+    template<typename Func>
+    void ForEachColumnColored(JobSystem& jobs, const ChunkCoord* columns, std::size_t count, Func&& func);
+};
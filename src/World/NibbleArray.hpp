@@ -0,0 +1,40 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Packed array of 4-bit values, two per byte (even index in the low nibble)
+ */
+template<std::size_t Count>
+class NibbleArray
+{
+public:
+    static_assert(Count % 2 == 0, "NibbleArray needs an even element count");
+
+    [[nodiscard]] std::uint8_t Get(std::size_t index) const
+    {
+        return (m_data[index >> 1] >> ((index & 1) << 2)) & 0x0F;
+    }
+
+    void Set(std::size_t index, std::uint8_t value)
+    {
+        const unsigned shift = (index & 1) << 2;
+        std::uint8_t& byte = m_data[index >> 1];
+        byte = static_cast<std::uint8_t>((byte & ~(0x0F << shift)) | ((value & 0x0F) << shift));
+    }
+
+    void Fill(std::uint8_t value)
+    {
+        m_data.fill(static_cast<std::uint8_t>((value & 0x0F) | ((value & 0x0F) << 4)));
+    }
+
+    [[nodiscard]] const std::uint8_t* GetData() const { return m_data.data(); }
+    [[nodiscard]] static constexpr std::size_t GetByteSize() { return Count / 2; }
+
+private:
+    std::array<std::uint8_t, Count / 2> m_data{};
+};
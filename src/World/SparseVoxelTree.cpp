@@ -0,0 +1,339 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "SparseVoxelTree.hpp"
+
+#include "Core/Math/Math.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <limits>
+
+namespace
+{
+constexpr int CHILD_COUNT = SparseVoxelTree::BRANCH * SparseVoxelTree::BRANCH * SparseVoxelTree::BRANCH;
+
+int PopCount(std::uint64_t mask)
+{
+    return static_cast<int>(std::bitset<64>(mask).count());
+}
+
+std::uint64_t HashNode(bool leafLevel, std::uint64_t childMask, std::uint64_t uniformMask, const std::uint32_t* children,
+                       int childCount)
+{
+    // FNV-1a over the masks and child slots
+    std::uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](std::uint64_t value) {
+        hash ^= value;
+        hash *= 1099511628211ull;
+    };
+    mix(leafLevel);
+    mix(childMask);
+    mix(uniformMask);
+    for (int i = 0; i < childCount; ++i)
+    {
+        mix(children[i]);
+    }
+    return hash;
+}
+} // namespace
+
+SparseVoxelTree::SparseVoxelTree()
+    : m_sharedNodes(0)
+    , m_root{Subtree::Kind::Air, 0}
+    , m_regionX(0)
+    , m_regionZ(0)
+{
+}
+
+void SparseVoxelTree::Build(int regionX, int regionZ, const ChunkLookup& lookup)
+{
+    Clear();
+    m_regionX = regionX;
+    m_regionZ = regionZ;
+
+    const Chunk* cachedChunk = nullptr;
+    ChunkCoord cachedCoord{std::numeric_limits<int>::min(), 0, 0};
+    m_root = BuildNode(0, 0, 0, 0, lookup, cachedChunk, cachedCoord);
+
+    // the table only matters while building
+    m_dedup.clear();
+}
+
+void SparseVoxelTree::Clear()
+{
+    m_nodes.clear();
+    m_children.clear();
+    m_leafBlocks.clear();
+    m_dedup.clear();
+    m_sharedNodes = 0;
+    m_root = {Subtree::Kind::Air, 0};
+}
+
+SparseVoxelTree::Subtree SparseVoxelTree::BuildNode(int level, int x, int y, int z, const ChunkLookup& lookup,
+                                                    const Chunk*& cachedChunk, ChunkCoord& cachedCoord)
+{
+    const int childSize = REGION_SIZE >> (BRANCH_BITS * (level + 1));
+
+    // nodes at or below chunk size lie inside one chunk; a missing chunk is all air
+    if ((childSize * BRANCH) <= Chunk::SIZE)
+    {
+        const ChunkCoord coord{m_regionX * REGION_CHUNKS + BlockToChunk(x), BlockToChunk(y),
+                               m_regionZ * REGION_CHUNKS + BlockToChunk(z)};
+        if (coord != cachedCoord)
+        {
+            cachedCoord = coord;
+            cachedChunk = lookup(coord);
+        }
+        if (!cachedChunk)
+            return {Subtree::Kind::Air, 0};
+    }
+
+    std::uint32_t children[CHILD_COUNT];
+    std::uint64_t childMask = 0;
+    std::uint64_t uniformMask = 0;
+    int childCount = 0;
+
+    // coarse summary: total fill, and the fill each distinct block brings
+    std::uint32_t fillSum = 0;
+    BlockId blocks[CHILD_COUNT];
+    std::uint32_t blockFills[CHILD_COUNT];
+    int blockCount = 0;
+
+    for (int child = 0; child < CHILD_COUNT; ++child)
+    {
+        const int cx = x + (child & (BRANCH - 1)) * childSize;
+        const int cz = z + ((child >> BRANCH_BITS) & (BRANCH - 1)) * childSize;
+        const int cy = y + (child >> (2 * BRANCH_BITS)) * childSize;
+
+        Subtree subtree;
+        if (childSize == 1)
+        {
+            const BlockId block = cachedChunk->GetBlock(BlockToLocal(cx), BlockToLocal(cy), BlockToLocal(cz));
+            subtree = block == BLOCK_AIR ? Subtree{Subtree::Kind::Air, 0} : Subtree{Subtree::Kind::Uniform, block};
+        }
+        else
+        {
+            subtree = BuildNode(level + 1, cx, cy, cz, lookup, cachedChunk, cachedCoord);
+        }
+
+        if (subtree.kind == Subtree::Kind::Air)
+            continue;
+
+        childMask |= std::uint64_t{1} << child;
+        if (subtree.kind == Subtree::Kind::Uniform)
+            uniformMask |= std::uint64_t{1} << child;
+        children[childCount++] = subtree.value;
+
+        const bool uniform = subtree.kind == Subtree::Kind::Uniform;
+        const std::uint32_t fill = uniform ? FILL_FULL : m_nodes[subtree.value].fill;
+        const BlockId block = uniform ? static_cast<BlockId>(subtree.value) : m_nodes[subtree.value].dominant;
+        fillSum += fill;
+        const int slot = static_cast<int>(std::find(blocks, blocks + blockCount, block) - blocks);
+        if (slot == blockCount)
+        {
+            blocks[blockCount] = block;
+            blockFills[blockCount++] = 0;
+        }
+        blockFills[slot] += fill;
+    }
+
+    if (childMask == 0)
+        return {Subtree::Kind::Air, 0};
+
+    // a full node of one block type collapses into its parent's child slot
+    if (childMask == ~std::uint64_t{0} && uniformMask == childMask &&
+        std::all_of(children, children + CHILD_COUNT, [&](std::uint32_t value) { return value == children[0]; }))
+    {
+        return {Subtree::Kind::Uniform, children[0]};
+    }
+
+    const auto dominant = static_cast<int>(std::max_element(blockFills, blockFills + blockCount) - blockFills);
+    return {Subtree::Kind::Node, AddNode(childSize == 1, childMask, uniformMask, children, childCount,
+                                         static_cast<std::uint16_t>(fillSum / CHILD_COUNT), blocks[dominant])};
+}
+
+std::uint32_t SparseVoxelTree::AddNode(bool leafLevel, std::uint64_t childMask, std::uint64_t uniformMask,
+                                       const std::uint32_t* children, int childCount, std::uint16_t fill,
+                                       BlockId dominant)
+{
+    auto sameChildren = [&](const Node& node) {
+        if (leafLevel)
+            return std::equal(children, children + childCount, m_leafBlocks.begin() + node.firstChild);
+        return std::equal(children, children + childCount, m_children.begin() + node.firstChild);
+    };
+
+    // children are already deduplicated, so equal slots mean equal subtrees (and equal summaries)
+    const std::uint64_t hash = HashNode(leafLevel, childMask, uniformMask, children, childCount);
+    if (const auto it = m_dedup.find(hash); it != m_dedup.end())
+    {
+        const Node& existing = m_nodes[it->second];
+        if (existing.childMask == childMask && existing.uniformMask == uniformMask && sameChildren(existing))
+        {
+            ++m_sharedNodes;
+            return it->second;
+        }
+    }
+
+    const auto index = static_cast<std::uint32_t>(m_nodes.size());
+    if (leafLevel)
+    {
+        m_nodes.push_back({childMask, uniformMask, static_cast<std::uint32_t>(m_leafBlocks.size()), fill, dominant});
+        m_leafBlocks.insert(m_leafBlocks.end(), children, children + childCount);
+    }
+    else
+    {
+        m_nodes.push_back({childMask, uniformMask, static_cast<std::uint32_t>(m_children.size()), fill, dominant});
+        m_children.insert(m_children.end(), children, children + childCount);
+    }
+
+    // on a hash collision the first node keeps the slot; the new one is simply not shared
+    m_dedup.emplace(hash, index);
+    return index;
+}
+
+SparseVoxelTree::Subtree SparseVoxelTree::Find(int x, int y, int z, int depth, int& size) const
+{
+    Subtree subtree = m_root;
+    size = REGION_SIZE;
+    for (int level = 0; level < depth && subtree.kind == Subtree::Kind::Node; ++level)
+    {
+        const Node& node = m_nodes[subtree.value];
+        const int shift = BRANCH_BITS * (DEPTH - 1 - level);
+        const int child = ChildIndex(x, y, z, shift);
+        const std::uint64_t bit = std::uint64_t{1} << child;
+        size >>= BRANCH_BITS;
+
+        if ((node.childMask & bit) == 0)
+            return {Subtree::Kind::Air, 0};
+
+        const int slot = PopCount(node.childMask & (bit - 1));
+        const std::uint32_t value = level == DEPTH - 1 ? m_leafBlocks[node.firstChild + slot]
+                                                       : m_children[node.firstChild + slot];
+        subtree = {(node.uniformMask & bit) ? Subtree::Kind::Uniform : Subtree::Kind::Node, value};
+    }
+    return subtree;
+}
+
+BlockId SparseVoxelTree::GetBlock(int x, int y, int z) const
+{
+    const int localX = x - m_regionX * REGION_SIZE;
+    const int localZ = z - m_regionZ * REGION_SIZE;
+    if (localX < 0 || localX >= REGION_SIZE || y < 0 || y >= REGION_SIZE || localZ < 0 || localZ >= REGION_SIZE)
+        return BLOCK_AIR;
+
+    int size;
+    return BlockOf(Find(localX, y, localZ, DEPTH, size));
+}
+
+BlockId SparseVoxelTree::GetCoarseBlock(int depth, int x, int y, int z) const
+{
+    const int localX = x - m_regionX * REGION_SIZE;
+    const int localZ = z - m_regionZ * REGION_SIZE;
+    if (localX < 0 || localX >= REGION_SIZE || y < 0 || y >= REGION_SIZE || localZ < 0 || localZ >= REGION_SIZE)
+        return BLOCK_AIR;
+
+    int size;
+    const Subtree subtree = Find(localX, y, localZ, std::clamp(depth, 0, DEPTH), size);
+    if (subtree.kind != Subtree::Kind::Node)
+        return BlockOf(subtree);
+
+    const Node& node = m_nodes[subtree.value];
+    return node.fill * 2 >= FILL_FULL ? node.dominant : BLOCK_AIR;
+}
+
+bool SparseVoxelTree::Raycast(const Ray& ray, RaycastHit& hit) const
+{
+    hit = RaycastHit{};
+
+    const Vector3 direction = ray.direction.Normalized();
+    if (direction.LengthSquared() == 0.0f)
+        return false;
+
+    // work in region-local space, where float precision is plenty
+    const glm::dvec3 local = ray.origin - glm::dvec3(m_regionX * REGION_SIZE, 0.0, m_regionZ * REGION_SIZE);
+    const Vector3 origin{static_cast<float>(local.x), static_cast<float>(local.y), static_cast<float>(local.z)};
+    const Vector3 regionMax{static_cast<float>(REGION_SIZE)};
+
+    // clip the ray against the region box
+    float tEnter = 0.0f;
+    float tExit = ray.maxDistance;
+    int enterAxis = -1;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        if (Math::IsNearlyZero(direction[axis]))
+        {
+            if (origin[axis] < 0.0f || origin[axis] >= regionMax[axis])
+                return false;
+            continue;
+        }
+
+        float t0 = (0.0f - origin[axis]) / direction[axis];
+        float t1 = (regionMax[axis] - origin[axis]) / direction[axis];
+        if (t0 > t1)
+            std::swap(t0, t1);
+        if (t0 > tEnter)
+        {
+            tEnter = t0;
+            enterAxis = axis;
+        }
+        tExit = std::min(tExit, t1);
+    }
+    if (tEnter > tExit)
+        return false;
+
+    // nudging along the ray picks the cell on the far side of the boundary being crossed
+    constexpr float NUDGE = 1e-4f;
+    float t = tEnter;
+    int lastAxis = enterAxis;
+
+    while (t <= tExit)
+    {
+        const Vector3 point = origin + direction * (t + NUDGE);
+        const int x = Math::FloorToInt(Math::Clamp(point.x, 0.0f, regionMax.x - 1.0f));
+        const int y = Math::FloorToInt(Math::Clamp(point.y, 0.0f, regionMax.y - 1.0f));
+        const int z = Math::FloorToInt(Math::Clamp(point.z, 0.0f, regionMax.z - 1.0f));
+
+        int size;
+        const Subtree subtree = Find(x, y, z, DEPTH, size);
+        if (subtree.kind != Subtree::Kind::Air)
+        {
+            hit.hit = true;
+            hit.x = x + m_regionX * REGION_SIZE;
+            hit.y = y;
+            hit.z = z + m_regionZ * REGION_SIZE;
+            hit.block = BlockOf(subtree);
+            hit.distance = t;
+            if (lastAxis >= 0)
+            {
+                hit.face = static_cast<BlockFace>(lastAxis * 2 + (direction[lastAxis] > 0.0f ? 1 : 0));
+            }
+            return true;
+        }
+
+        // leave the whole empty cell at once
+        const int cell[3] = {x & ~(size - 1), y & ~(size - 1), z & ~(size - 1)};
+        float tNext = std::numeric_limits<float>::infinity();
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            if (Math::IsNearlyZero(direction[axis]))
+                continue;
+            const float boundary = static_cast<float>(direction[axis] > 0.0f ? cell[axis] + size : cell[axis]);
+            const float tAxis = (boundary - origin[axis]) / direction[axis];
+            if (tAxis < tNext)
+            {
+                tNext = tAxis;
+                lastAxis = axis;
+            }
+        }
+        t = std::max(tNext, t + NUDGE);
+    }
+    return false;
+}
+
+std::size_t SparseVoxelTree::GetMemoryUsage() const
+{
+    return m_nodes.size() * sizeof(Node) + m_children.size() * sizeof(std::uint32_t) +
+           m_leafBlocks.size() * sizeof(BlockId);
+}
@@ -0,0 +1,155 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Chunk.hpp"
+#include "VoxelRaycaster.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Sparse 64-tree (4x4x4 children per node) over a 256^3 block region: 8x8 chunk columns,
+ * the full world height. Meant for terrain far beyond the chunk radius, where dense chunks
+ * would cost too much memory.
+ *
+ * Air children are implicit and children of a single block type are stored inline as a
+ * value, so solid rock and open sky cost nothing past the node above them. Nodes live in
+ * two flat pools (nodes, child slots) and identical subtrees are stored once (a DAG), which
+ * folds repeated patterns such as flat layers and ocean floor together. Clear keeps the
+ * pools' capacity so rebuilding regions does not reallocate.
+ *
+ * Child and cell ordering follow chunks: x fastest, then z, then y.
+ */
+class SparseVoxelTree
+{
+public:
+    static constexpr int BRANCH_BITS = 2;
+    static constexpr int BRANCH = 1 << BRANCH_BITS;
+    static constexpr int DEPTH = 4;
+    static constexpr int REGION_SIZE = 1 << (BRANCH_BITS * DEPTH);
+    static constexpr int REGION_CHUNKS = REGION_SIZE / Chunk::SIZE;
+
+    static_assert(REGION_SIZE == WORLD_HEIGHT, "a region spans the full world height");
+
+    using ChunkLookup = std::function<const Chunk*(const ChunkCoord&)>;
+
+    SparseVoxelTree();
+
+    /**
+     * Build the tree for the region whose minimum corner is chunk column
+     * (regionX * REGION_CHUNKS, regionZ * REGION_CHUNKS). Chunks the lookup does not
+     * return are treated as air.
+     */
+    void Build(int regionX, int regionZ, const ChunkLookup& lookup);
+
+    void Clear();
+
+    /**
+     * Get a block in world coordinates; air outside the region
+     */
+    [[nodiscard]] BlockId GetBlock(int x, int y, int z) const;
+
+    /**
+     * Coarse view of the cell of edge REGION_SIZE >> (BRANCH_BITS * depth) that holds a block in
+     * world coordinates, for drawing terrain too far away for single blocks: air if less than half
+     * of the cell is solid (as in ChunkLod), otherwise the block that fills most of it, counting
+     * each child cell by its own coarse view. Depth DEPTH is the block itself.
+     */
+    [[nodiscard]] BlockId GetCoarseBlock(int depth, int x, int y, int z) const;
+
+    /**
+     * Cast a ray in world coordinates, skipping whole empty nodes at a time
+     */
+    bool Raycast(const Ray& ray, RaycastHit& hit) const;
+
+    [[nodiscard]] int GetRegionX() const { return m_regionX; }
+    [[nodiscard]] int GetRegionZ() const { return m_regionZ; }
+
+    [[nodiscard]] std::size_t GetNodeCount() const { return m_nodes.size(); }
+
+    /**
+     * Number of subtrees that were found already in the tree and shared instead of stored
+     */
+    [[nodiscard]] std::size_t GetSharedNodeCount() const { return m_sharedNodes; }
+
+    /**
+     * Bytes of tree data in the pools (excluding spare capacity and the build-time dedup table)
+     */
+    [[nodiscard]] std::size_t GetMemoryUsage() const;
+
+private:
+    /**
+     * Child slots of non-uniform children hold a node index, the others a BlockId. Nodes on
+     * the last level only have block children, which go to the 16-bit m_leafBlocks pool.
+     * The coarse summary used by GetCoarseBlock fits in what would otherwise be padding.
+     */
+    struct Node
+    {
+        std::uint64_t childMask;   // children that are not air
+        std::uint64_t uniformMask; // non-air children made of a single block type
+        std::uint32_t firstChild;  // index of the first present child in m_children or m_leafBlocks
+        std::uint16_t fill;        // solid share of the node's volume, FILL_FULL when full
+        BlockId dominant;          // block that fills most of the node
+    };
+
+    static_assert(sizeof(Node) == 24, "the coarse summary should not grow nodes");
+
+    static constexpr std::uint32_t FILL_FULL = 1u << 15;
+
+    /**
+     * Result of building a subtree: air, a single block type, or a node
+     */
+    struct Subtree
+    {
+        enum class Kind : std::uint8_t
+        {
+            Air,
+            Uniform,
+            Node
+        } kind;
+        std::uint32_t value;
+    };
+
+    std::vector<Node> m_nodes;
+    std::vector<std::uint32_t> m_children;
+    std::vector<BlockId> m_leafBlocks;
+    std::unordered_map<std::uint64_t, std::uint32_t> m_dedup;
+    std::size_t m_sharedNodes;
+    Subtree m_root;
+    int m_regionX;
+    int m_regionZ;
+
+    Subtree BuildNode(int level, int x, int y, int z, const ChunkLookup& lookup, const Chunk*& cachedChunk,
+                      ChunkCoord& cachedCoord);
+
+    /**
+     * Store a node unless an identical one exists
+     */
+    std::uint32_t AddNode(bool leafLevel, std::uint64_t childMask, std::uint64_t uniformMask,
+                          const std::uint32_t* children, int childCount, std::uint16_t fill, BlockId dominant);
+
+    /**
+     * Descend at most depth levels towards a region-local block; with depth DEPTH this always
+     * ends at an air or single-type subtree
+     * @param size Receives the edge length of the returned subtree's cell
+     */
+    [[nodiscard]] Subtree Find(int x, int y, int z, int depth, int& size) const;
+
+    /**
+     * Block of a subtree from Find: its block type, or air
+     */
+    [[nodiscard]] static BlockId BlockOf(const Subtree& subtree)
+    {
+        return subtree.kind == Subtree::Kind::Uniform ? static_cast<BlockId>(subtree.value) : BLOCK_AIR;
+    }
+
+    static int ChildIndex(int x, int y, int z, int shift)
+    {
+        return ((x >> shift) & (BRANCH - 1)) | (((z >> shift) & (BRANCH - 1)) << BRANCH_BITS) |
+               (((y >> shift) & (BRANCH - 1)) << (2 * BRANCH_BITS));
+    }
+};
@@ -0,0 +1,133 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "VoxelRaycaster.hpp"
+
+#include "Core/JobSystem.hpp"
+#include "World.hpp"
+
+#include <cmath>
+#include <limits>
+
+VoxelRaycaster::VoxelRaycaster(const World& world, const BlockRegistry* registry)
+    : m_world(world)
+    , m_registry(registry)
+{
+}
+
+bool VoxelRaycaster::Cast(const Ray& ray, RaycastHit& hit) const
+{
+    hit = RaycastHit{};
+
+    const Vector3 direction = ray.direction.Normalized();
+    if (direction.LengthSquared() == 0.0f)
+        return false;
+
+    constexpr float infinity = std::numeric_limits<float>::infinity();
+
+    // tMax: distance along the ray to the next border on each axis, tDelta: distance between borders
+    int cell[3];
+    int step[3];
+    float tMax[3];
+    float tDelta[3];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        // split the origin into its cell and the offset within it while still in double
+        // precision; everything after that is relative to the cell and fits a float
+        const double cellStart = std::floor(ray.origin[axis]);
+        const auto offset = static_cast<float>(ray.origin[axis] - cellStart);
+        cell[axis] = static_cast<int>(cellStart);
+        if (direction[axis] > 0.0f)
+        {
+            step[axis] = 1;
+            tDelta[axis] = 1.0f / direction[axis];
+            tMax[axis] = (1.0f - offset) * tDelta[axis];
+        }
+        else if (direction[axis] < 0.0f)
+        {
+            step[axis] = -1;
+            tDelta[axis] = -1.0f / direction[axis];
+            tMax[axis] = offset * tDelta[axis];
+        }
+        else
+        {
+            step[axis] = 0;
+            tDelta[axis] = infinity;
+            tMax[axis] = infinity;
+        }
+    }
+
+    ChunkCoord chunkCoord{};
+    const Chunk* chunk = nullptr;
+    bool chunkCached = false;
+
+    float distance = 0.0f;
+    auto face = BlockFace::None;
+
+    while (true)
+    {
+        if (cell[1] >= 0 && cell[1] < WORLD_HEIGHT)
+        {
+            // only a chunk border crossing costs a hash lookup
+            const ChunkCoord coord = BlockToChunkCoord(cell[0], cell[1], cell[2]);
+            if (!chunkCached || coord != chunkCoord)
+            {
+                chunkCoord = coord;
+                chunk = m_world.GetChunk(coord);
+                chunkCached = true;
+            }
+
+            if (chunk)
+            {
+                const BlockId block =
+                    chunk->GetBlock(BlockToLocal(cell[0]), BlockToLocal(cell[1]), BlockToLocal(cell[2]));
+                if (Stops(block))
+                {
+                    hit.hit = true;
+                    hit.x = cell[0];
+                    hit.y = cell[1];
+                    hit.z = cell[2];
+                    hit.block = block;
+                    hit.face = face;
+                    hit.distance = distance;
+                    return true;
+                }
+            }
+        }
+        else if ((cell[1] < 0 && step[1] <= 0) || (cell[1] >= WORLD_HEIGHT && step[1] >= 0))
+        {
+            // outside the world and not heading back in
+            return false;
+        }
+
+        int axis = tMax[0] < tMax[1] ? 0 : 1;
+        if (tMax[2] < tMax[axis])
+            axis = 2;
+
+        if (tMax[axis] > ray.maxDistance)
+            return false;
+
+        distance = tMax[axis];
+        cell[axis] += step[axis];
+        tMax[axis] += tDelta[axis];
+
+        // moving in +axis enters the next cell through its negative face
+        face = static_cast<BlockFace>(axis * 2 + (step[axis] > 0 ? 1 : 0));
+    }
+}
+
+void VoxelRaycaster::CastBatch(JobSystem& jobs, const std::vector<Ray>& rays,
+                               std::vector<RaycastHit>& hits) const
+{
+    hits.resize(rays.size());
+
+    // rays are cheap, so hand them out in blocks large enough to amortize the job overhead
+    constexpr std::size_t RAYS_PER_JOB = 256;
+    jobs.ParallelFor(rays.size(), RAYS_PER_JOB, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            Cast(rays[i], hits[i]);
+        }
+    });
+}
@@ -0,0 +1,84 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "BlockRegistry.hpp"
+#include "Chunk.hpp"
+#include "Core/Math/Vector3.hpp"
+
+#include <cstdint>
+#include <glm/vec3.hpp>
+#include <vector>
+
+class JobSystem;
+class World;
+
+/**
+ * Face of a block, in the same order the mesher and light engine use
+ */
+enum class BlockFace : std::uint8_t
+{
+    PositiveX,
+    NegativeX,
+    PositiveY,
+    NegativeY,
+    PositiveZ,
+    NegativeZ,
+    None // the ray started inside the block it hit
+};
+
+/**
+ * Ray in world coordinates. The origin is double precision like Camera::Position, so rays
+ * cast far from the world origin still start at the right point within their block.
+ */
+struct Ray
+{
+    glm::dvec3 origin{};
+    Vector3 direction;
+    float maxDistance = 8.0f;
+};
+
+struct RaycastHit
+{
+    bool hit = false;
+    int x = 0, y = 0, z = 0;
+    BlockId block = BLOCK_AIR;
+    BlockFace face = BlockFace::None;
+    float distance = 0.0f;
+};
+
+/**
+ * Amanatides-Woo grid traversal over chunk storage. Every cell the ray passes through is
+ * visited exactly once, and the chunk pointer is cached until the ray crosses a chunk
+ * border, so a step costs a few compares and one block read.
+ *
+ * Queries only read the world; batches may run in parallel as long as nothing edits it.
+ */
+class VoxelRaycaster
+{
+public:
+    /**
+     * @param registry If set, only opaque blocks stop rays (line of sight); otherwise any non-air block does
+     */
+    explicit VoxelRaycaster(const World& world, const BlockRegistry* registry = nullptr);
+
+    /**
+     * Find the first block along the ray
+     * @return True if a block was hit within ray.maxDistance
+     */
+    bool Cast(const Ray& ray, RaycastHit& hit) const;
+
+    /**
+     * Cast many rays across the job system; hits is resized to match rays
+     */
+    void CastBatch(JobSystem& jobs, const std::vector<Ray>& rays, std::vector<RaycastHit>& hits) const;
+
+private:
+    const World& m_world;
+    const BlockRegistry* m_registry;
+
+    [[nodiscard]] bool Stops(BlockId block) const
+    {
+        return m_registry ? m_registry->IsOpaque(block) : block != BLOCK_AIR;
+    }
+};
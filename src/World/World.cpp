@@ -0,0 +1,124 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "World.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+World::World() = default;
+
+World::~World() = default;
+
+Chunk* World::GetChunk(const ChunkCoord& coord)
+{
+    if (const auto it = m_chunks.find(coord); it != m_chunks.end())
+    {
+        return it->second.get();
+    }
+    return nullptr;
+}
+
+const Chunk* World::GetChunk(const ChunkCoord& coord) const
+{
+    if (const auto it = m_chunks.find(coord); it != m_chunks.end())
+    {
+        return it->second.get();
+    }
+    return nullptr;
+}
+
+Chunk& World::GetOrCreateChunk(const ChunkCoord& coord)
+{
+    auto& slot = m_chunks[coord];
+    if (!slot)
+    {
+        // unlit until the light engine relights its column; a new chunk may be anywhere,
+        // including underground, so it cannot assume open sky
+        slot = std::make_unique<Chunk>(coord);
+        slot->SetDirtyList(&m_dirtyChunks);
+        m_createdChunks.push_back(coord);
+    }
+    return *slot;
+}
+
+void World::TakeCreatedChunks(std::vector<ChunkCoord>& chunks)
+{
+    chunks.clear();
+    chunks.swap(m_createdChunks);
+}
+
+Chunk& World::InsertChunk(std::unique_ptr<Chunk> chunk)
+{
+    auto& slot = m_chunks[chunk->GetCoord()];
+    slot = std::move(chunk);
+    slot->SetDirtyList(&m_dirtyChunks);
+    return *slot;
+}
+
+bool World::HasChunk(const ChunkCoord& coord) const
+{
+    return m_chunks.find(coord) != m_chunks.end();
+}
+
+void World::UnloadChunk(const ChunkCoord& coord)
+{
+    m_chunks.erase(coord);
+}
+
+std::size_t World::UnloadOutsideRadius(const ChunkCoord& center, int radius)
+{
+    std::size_t unloaded = 0;
+    for (auto it = m_chunks.begin(); it != m_chunks.end();)
+    {
+        const ChunkCoord& coord = it->first;
+        if (std::abs(coord.x - center.x) > radius || std::abs(coord.z - center.z) > radius)
+        {
+            it = m_chunks.erase(it);
+            ++unloaded;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    return unloaded;
+}
+
+std::vector<ChunkCoord> World::GetColumnsInRadius(const ChunkCoord& center, int radius)
+{
+    std::vector<ChunkCoord> columns;
+    columns.reserve(static_cast<std::size_t>((2 * radius + 1) * (2 * radius + 1)));
+
+    for (int dz = -radius; dz <= radius; ++dz)
+    {
+        for (int dx = -radius; dx <= radius; ++dx)
+        {
+            columns.push_back({center.x + dx, 0, center.z + dz});
+        }
+    }
+
+    std::sort(columns.begin(), columns.end(), [&center](const ChunkCoord& a, const ChunkCoord& b) {
+        const int da = (a.x - center.x) * (a.x - center.x) + (a.z - center.z) * (a.z - center.z);
+        const int db = (b.x - center.x) * (b.x - center.x) + (b.z - center.z) * (b.z - center.z);
+        return da < db;
+    });
+
+    return columns;
+}
+
+BlockId World::GetBlock(int x, int y, int z) const
+{
+    if (const Chunk* chunk = GetChunk(BlockToChunkCoord(x, y, z)))
+    {
+        return chunk->GetBlock(BlockToLocal(x), BlockToLocal(y), BlockToLocal(z));
+    }
+    return BLOCK_AIR;
+}
+
+void World::SetBlock(int x, int y, int z, BlockId block)
+{
+    Chunk& chunk = GetOrCreateChunk(BlockToChunkCoord(x, y, z));
+    chunk.SetBlock(BlockToLocal(x), BlockToLocal(y), BlockToLocal(z), block);
+}
@@ -0,0 +1,111 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Chunk.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Owns the chunks currently resident in memory and provides block access in
+ * world (block) coordinates.
+ */
+class World
+{
+public:
+    World();
+    ~World();
+
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    /**
+     * Get a loaded chunk, or nullptr if it is not resident
+     */
+    [[nodiscard]] Chunk* GetChunk(const ChunkCoord& coord);
+    [[nodiscard]] const Chunk* GetChunk(const ChunkCoord& coord) const;
+
+    /**
+     * Get a loaded chunk, creating an empty (all air) one if needed. Created chunks are not
+     * lit; they are listed for the light engine (TakeCreatedChunks).
+     */
+    Chunk& GetOrCreateChunk(const ChunkCoord& coord);
+
+    /**
+     * Move the chunks created by GetOrCreateChunk since the last call into chunks. The
+     * vectors swap storage, so passing the same one every time allocates nothing.
+     */
+    void TakeCreatedChunks(std::vector<ChunkCoord>& chunks);
+
+    /**
+     * Append the coordinates of chunks that became dirty since the last call. Chunks may have
+     * been cleaned or unloaded since, so check them before use.
+     */
+    void TakeDirtyChunks(std::vector<ChunkCoord>& chunks) { m_dirtyChunks.TakeAll(chunks); }
+
+    /**
+     * Add a chunk built elsewhere (e.g. on a worker thread), replacing any chunk at its coordinate
+     */
+    Chunk& InsertChunk(std::unique_ptr<Chunk> chunk);
+
+    /**
+     * Check whether a chunk is resident
+     */
+    [[nodiscard]] bool HasChunk(const ChunkCoord& coord) const;
+
+    /**
+     * Drop a chunk from memory
+     */
+    void UnloadChunk(const ChunkCoord& coord);
+
+    /**
+     * Drop every chunk farther than radius (in chunks, horizontal Chebyshev distance) from center
+     * @return Number of chunks unloaded
+     */
+    std::size_t UnloadOutsideRadius(const ChunkCoord& center, int radius);
+
+    /**
+     * Collect the horizontal chunk columns within radius of center, nearest first. Used to
+     * drive loading so that work is bounded by what can be seen, not by world size.
+     */
+    [[nodiscard]] static std::vector<ChunkCoord> GetColumnsInRadius(const ChunkCoord& center,
+                                                                    int radius);
+
+    /**
+     * Get a block in world coordinates; unloaded chunks read as air
+     */
+    [[nodiscard]] BlockId GetBlock(int x, int y, int z) const;
+
+    /**
+     * Set a block in world coordinates, creating the owning chunk if needed
+     */
+    void SetBlock(int x, int y, int z, BlockId block);
+
+    [[nodiscard]] std::size_t GetLoadedChunkCount() const { return m_chunks.size(); }
+
+    template<typename Func>
+    void ForEachChunk(Func&& func) const
+    {
+        for (const auto& [coord, chunk] : m_chunks)
+        {
+            func(*chunk);
+        }
+    }
+
+    template<typename Func>
+    void ForEachChunk(Func&& func)
+    {
+        for (auto& [coord, chunk] : m_chunks)
+        {
+            func(*chunk);
+        }
+    }
+
+private:
+    DirtyChunkList m_dirtyChunks; // outlives the chunks pointing at it
+    std::unordered_map<ChunkCoord, std::unique_ptr<Chunk>, ChunkCoordHash> m_chunks;
+    std::vector<ChunkCoord> m_createdChunks;
+};
@@ -0,0 +1,435 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+
+#include "WorldSnapshot.hpp"
+
+#include "ChunkLod.hpp"
+#include "Core/JobSystem.hpp"
+#include "World.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t SNAPSHOT_ALIGNMENT = 64;
+
+std::size_t AlignUp(std::size_t value)
+{
+    return (value + SNAPSHOT_ALIGNMENT - 1) & ~(SNAPSHOT_ALIGNMENT - 1);
+}
+
+bool ColumnOrder(const SnapshotChunkEntry& a, const SnapshotChunkEntry& b)
+{
+    if (a.x != b.x)
+        return a.x < b.x;
+    if (a.z != b.z)
+        return a.z < b.z;
+    return a.y < b.y;
+}
+
+std::uint8_t BitsForPalette(std::size_t paletteSize)
+{
+    if (paletteSize <= 1)
+        return 0;
+
+    std::uint8_t bits = 1;
+    while ((std::size_t{1} << bits) < paletteSize)
+    {
+        bits *= 2;
+    }
+    return bits;
+}
+
+std::size_t IndexWordCount(std::uint8_t bits)
+{
+    return (static_cast<std::size_t>(Chunk::VOLUME) * bits + 63) / 64;
+}
+
+struct EncodedChunk
+{
+    SnapshotChunkEntry entry{};
+    std::vector<BlockId> palette;
+    std::vector<std::uint64_t> indices;
+};
+
+EncodedChunk EncodeChunk(const Chunk& chunk, std::vector<std::int32_t>& remap)
+{
+    EncodedChunk encoded;
+    const ChunkCoord& coord = chunk.GetCoord();
+    encoded.entry.x = coord.x;
+    encoded.entry.y = coord.y;
+    encoded.entry.z = coord.z;
+
+    std::vector<std::uint16_t> localIndices(Chunk::VOLUME);
+    for (int i = 0; i < Chunk::VOLUME; ++i)
+    {
+        const BlockId block = chunk.GetBlock(i);
+        if (remap[block] < 0)
+        {
+            remap[block] = static_cast<std::int32_t>(encoded.palette.size());
+            encoded.palette.push_back(block);
+        }
+        localIndices[i] = static_cast<std::uint16_t>(remap[block]);
+    }
+
+    // reset only the entries we touched so the table can be reused for the next chunk
+    for (const BlockId block : encoded.palette)
+    {
+        remap[block] = -1;
+    }
+
+    const std::uint8_t bits = BitsForPalette(encoded.palette.size());
+    encoded.entry.paletteSize = static_cast<std::uint16_t>(encoded.palette.size());
+    encoded.entry.bitsPerIndex = bits;
+
+    encoded.indices.assign(IndexWordCount(bits), 0);
+    if (bits > 0)
+    {
+        for (int i = 0; i < Chunk::VOLUME; ++i)
+        {
+            const auto bit = static_cast<std::size_t>(i) * bits;
+            encoded.indices[bit >> 6] |= static_cast<std::uint64_t>(localIndices[i]) << (bit & 63);
+        }
+    }
+    return encoded;
+}
+
+void WritePadding(std::ofstream& file, std::size_t& offset)
+{
+    static constexpr char zeros[SNAPSHOT_ALIGNMENT]{};
+    const std::size_t aligned = AlignUp(offset);
+    file.write(zeros, static_cast<std::streamsize>(aligned - offset));
+    offset = aligned;
+}
+} // namespace
+
+SnapshotChunkView::SnapshotChunkView(const SnapshotChunkEntry* entry, const BlockId* palette,
+                                     const std::uint64_t* indices)
+    : m_entry(entry)
+    , m_palette(palette)
+    , m_indices(indices)
+    , m_bits(entry->bitsPerIndex)
+    , m_mask(entry->bitsPerIndex == 0 ? 0 : (std::uint64_t{1} << entry->bitsPerIndex) - 1)
+    , m_lastIndex(entry->paletteSize - 1u)
+{
+}
+
+void SnapshotChunkView::CopyTo(Chunk& chunk) const
+{
+    BlockId* blocks = chunk.GetData();
+    if (m_bits == 0)
+    {
+        std::fill(blocks, blocks + Chunk::VOLUME, m_palette[0]);
+    }
+    else
+    {
+        const int perWord = 64 / static_cast<int>(m_bits);
+        for (int word = 0; word < Chunk::VOLUME / perWord; ++word)
+        {
+            std::uint64_t packed = m_indices[word];
+            for (int i = 0; i < perWord; ++i)
+            {
+                blocks[word * perWord + i] = m_palette[std::min(packed & m_mask, m_lastIndex)];
+                packed >>= m_bits;
+            }
+        }
+    }
+    chunk.SetDirty(true);
+    chunk.SetLightReady(false);
+}
+
+WorldSnapshot::WorldSnapshot()
+    : m_entries(nullptr)
+    , m_chunkCount(0)
+{
+}
+
+WorldSnapshot::~WorldSnapshot()
+{
+    Close();
+}
+
+bool WorldSnapshot::Bake(const World& world, const std::string& filename)
+{
+    std::vector<EncodedChunk> chunks;
+    chunks.reserve(world.GetLoadedChunkCount());
+
+    std::vector<std::int32_t> remap(std::size_t{1} << (8 * sizeof(BlockId)), -1);
+    world.ForEachChunk([&](const Chunk& chunk) {
+        if (!chunk.IsEmpty())
+        {
+            chunks.push_back(EncodeChunk(chunk, remap));
+        }
+    });
+
+    std::sort(chunks.begin(), chunks.end(), [](const EncodedChunk& a, const EncodedChunk& b) {
+        return ColumnOrder(a.entry, b.entry);
+    });
+
+    // assign offsets before writing so the table can go first
+    std::size_t offset = AlignUp(sizeof(SnapshotHeader) + chunks.size() * sizeof(SnapshotChunkEntry));
+    for (EncodedChunk& chunk : chunks)
+    {
+        chunk.entry.paletteOffset = offset;
+        offset = AlignUp(offset + chunk.palette.size() * sizeof(BlockId));
+        chunk.entry.indexOffset = offset;
+        offset = AlignUp(offset + chunk.indices.size() * sizeof(std::uint64_t));
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open snapshot file " << filename << std::endl;
+        return false;
+    }
+
+    SnapshotHeader header{};
+    header.magic = SnapshotHeader::MAGIC;
+    header.version = SnapshotHeader::VERSION;
+    header.chunkSize = Chunk::SIZE;
+    header.chunkCount = static_cast<std::uint32_t>(chunks.size());
+    header.tableOffset = sizeof(SnapshotHeader);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const EncodedChunk& chunk : chunks)
+    {
+        file.write(reinterpret_cast<const char*>(&chunk.entry), sizeof(SnapshotChunkEntry));
+    }
+
+    std::size_t written = sizeof(SnapshotHeader) + chunks.size() * sizeof(SnapshotChunkEntry);
+    WritePadding(file, written);
+
+    for (const EncodedChunk& chunk : chunks)
+    {
+        const std::size_t paletteBytes = chunk.palette.size() * sizeof(BlockId);
+        file.write(reinterpret_cast<const char*>(chunk.palette.data()),
+                   static_cast<std::streamsize>(paletteBytes));
+        written += paletteBytes;
+        WritePadding(file, written);
+
+        const std::size_t indexBytes = chunk.indices.size() * sizeof(std::uint64_t);
+        file.write(reinterpret_cast<const char*>(chunk.indices.data()),
+                   static_cast<std::streamsize>(indexBytes));
+        written += indexBytes;
+        WritePadding(file, written);
+    }
+
+    if (!file.good())
+    {
+        std::cerr << "Failed to write snapshot file " << filename << std::endl;
+        return false;
+    }
+
+    std::cout << "Baked " << chunks.size() << " chunks (" << written / 1024 << " KiB) to "
+              << filename << std::endl;
+    return true;
+}
+
+bool WorldSnapshot::Open(const std::string& filename)
+{
+    Close();
+
+    if (!m_file.Open(filename))
+        return false;
+
+    SnapshotHeader header{};
+    if (m_file.GetSize() < sizeof(header))
+    {
+        std::cerr << "Snapshot file too small: " << filename << std::endl;
+        Close();
+        return false;
+    }
+    std::memcpy(&header, m_file.GetData(), sizeof(header));
+
+    if (header.magic != SnapshotHeader::MAGIC || header.version != SnapshotHeader::VERSION)
+    {
+        std::cerr << "Not a supported world snapshot: " << filename << std::endl;
+        Close();
+        return false;
+    }
+
+    if (header.chunkSize != Chunk::SIZE)
+    {
+        std::cerr << "Snapshot chunk size " << header.chunkSize << " does not match engine chunk size "
+                  << Chunk::SIZE << std::endl;
+        Close();
+        return false;
+    }
+
+    // compared by division so a garbage offset or count cannot wrap around the size check
+    const std::size_t size = m_file.GetSize();
+    if (header.tableOffset % alignof(SnapshotChunkEntry) != 0 || header.tableOffset > size ||
+        header.chunkCount > (size - header.tableOffset) / sizeof(SnapshotChunkEntry))
+    {
+        std::cerr << "Corrupt snapshot offset table: " << filename << std::endl;
+        Close();
+        return false;
+    }
+
+    m_entries = reinterpret_cast<const SnapshotChunkEntry*>(m_file.GetData() + header.tableOffset);
+    m_chunkCount = header.chunkCount;
+
+    std::cout << "Mapped world snapshot " << filename << " (" << m_chunkCount << " chunks)"
+              << std::endl;
+    return true;
+}
+
+void WorldSnapshot::Close()
+{
+    m_file.Close();
+    m_entries = nullptr;
+    m_chunkCount = 0;
+}
+
+SnapshotChunkView WorldSnapshot::FindChunk(const ChunkCoord& coord) const
+{
+    const SnapshotChunkEntry* begin = nullptr;
+    const SnapshotChunkEntry* end = nullptr;
+    FindColumn(coord.x, coord.z, begin, end);
+
+    for (const SnapshotChunkEntry* entry = begin; entry != end; ++entry)
+    {
+        if (entry->y == coord.y)
+            return MakeView(*entry);
+    }
+    return {};
+}
+
+std::size_t WorldSnapshot::LoadColumn(World& world, int chunkX, int chunkZ) const
+{
+    const SnapshotChunkEntry* begin = nullptr;
+    const SnapshotChunkEntry* end = nullptr;
+    FindColumn(chunkX, chunkZ, begin, end);
+
+    std::size_t loaded = 0;
+    for (const SnapshotChunkEntry* entry = begin; entry != end; ++entry)
+    {
+        if (const SnapshotChunkView view = MakeView(*entry); view.IsValid())
+        {
+            view.CopyTo(world.GetOrCreateChunk(view.GetCoord()));
+            ++loaded;
+        }
+    }
+    return loaded;
+}
+
+std::size_t WorldSnapshot::LoadAround(World& world, const ChunkCoord& center, int radius) const
+{
+    if (!IsOpen())
+        return 0;
+
+    const std::vector<ChunkCoord> columns = World::GetColumnsInRadius(center, radius);
+
+    // ask the OS to start paging in the next column while the current one is decoded
+    auto prefetchColumn = [this](const ChunkCoord& column) {
+        const SnapshotChunkEntry* begin = nullptr;
+        const SnapshotChunkEntry* end = nullptr;
+        FindColumn(column.x, column.z, begin, end);
+        if (begin != end && (end - 1)->indexOffset >= begin->paletteOffset)
+        {
+            const std::size_t first = begin->paletteOffset;
+            const std::size_t last = (end - 1)->indexOffset +
+                                     IndexWordCount((end - 1)->bitsPerIndex) * sizeof(std::uint64_t);
+            m_file.Prefetch(first, last - first);
+        }
+    };
+
+    std::size_t loaded = 0;
+    for (std::size_t i = 0; i < columns.size(); ++i)
+    {
+        if (i + 1 < columns.size())
+            prefetchColumn(columns[i + 1]);
+
+        loaded += LoadColumn(world, columns[i].x, columns[i].z);
+    }
+    return loaded;
+}
+
+std::size_t WorldSnapshot::LoadLodColumns(JobSystem& jobs, LodStore& store,
+                                         const std::vector<ChunkCoord>& columns) const
+{
+    if (!IsOpen())
+        return 0;
+
+    std::vector<std::vector<std::unique_ptr<ChunkLod>>> results(columns.size());
+    jobs.ParallelFor(columns.size(), 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const SnapshotChunkEntry* first = nullptr;
+            const SnapshotChunkEntry* last = nullptr;
+            FindColumn(columns[i].x, columns[i].z, first, last);
+            for (const SnapshotChunkEntry* entry = first; entry != last; ++entry)
+            {
+                if (const SnapshotChunkView view = MakeView(*entry); view.IsValid())
+                {
+                    // pooled, so decoding column after column reuses the same memory
+                    const auto chunk = std::make_unique<Chunk>(view.GetCoord());
+                    view.CopyTo(*chunk);
+                    results[i].push_back(std::make_unique<ChunkLod>(*chunk));
+                }
+            }
+        }
+    });
+
+    std::size_t inserted = 0;
+    for (auto& column : results)
+    {
+        for (std::unique_ptr<ChunkLod>& lod : column)
+        {
+            store.Insert(std::move(lod));
+            ++inserted;
+        }
+    }
+    return inserted;
+}
+
+void WorldSnapshot::FindColumn(int chunkX, int chunkZ, const SnapshotChunkEntry*& begin,
+                               const SnapshotChunkEntry*& end) const
+{
+    const SnapshotChunkEntry* first = m_entries;
+    const SnapshotChunkEntry* last = m_entries + m_chunkCount;
+
+    SnapshotChunkEntry lowKey{};
+    lowKey.x = chunkX;
+    lowKey.z = chunkZ;
+    lowKey.y = std::numeric_limits<std::int32_t>::min();
+
+    begin = std::lower_bound(first, last, lowKey, ColumnOrder);
+    end = begin;
+    while (end != last && end->x == chunkX && end->z == chunkZ)
+    {
+        ++end;
+    }
+}
+
+SnapshotChunkView WorldSnapshot::MakeView(const SnapshotChunkEntry& entry) const
+{
+    const std::size_t size = m_file.GetSize();
+    const std::size_t paletteBytes = entry.paletteSize * sizeof(BlockId);
+    const std::size_t indexBytes = IndexWordCount(entry.bitsPerIndex) * sizeof(std::uint64_t);
+
+    const bool validBits = entry.bitsPerIndex == 0 || entry.bitsPerIndex == 1 ||
+                           entry.bitsPerIndex == 2 || entry.bitsPerIndex == 4 ||
+                           entry.bitsPerIndex == 8 || entry.bitsPerIndex == 16;
+
+    // sizes are compared against what is left past each offset so garbage cannot wrap around
+    if (!validBits || entry.paletteSize == 0 || entry.paletteOffset > size ||
+        paletteBytes > size - entry.paletteOffset || entry.indexOffset > size ||
+        indexBytes > size - entry.indexOffset || entry.paletteOffset % SNAPSHOT_ALIGNMENT != 0 ||
+        entry.indexOffset % SNAPSHOT_ALIGNMENT != 0)
+    {
+        std::cerr << "Skipping corrupt snapshot chunk (" << entry.x << ", " << entry.y << ", "
+                  << entry.z << ")" << std::endl;
+        return {};
+    }
+
+    return {&entry, reinterpret_cast<const BlockId*>(m_file.GetData() + entry.paletteOffset),
+            reinterpret_cast<const std::uint64_t*>(m_file.GetData() + entry.indexOffset)};
+}
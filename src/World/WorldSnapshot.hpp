@@ -0,0 +1,162 @@
+//
+// Created by Bisher Almasri on 2026-10-19.
+//
+#pragma once
+#include "Chunk.hpp"
+#include "Core/MappedFile.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class JobSystem;
+class LodStore;
+class World;
+
+/**
+ * On-disk layout of a baked world. Everything is little-endian, fixed size and
+ * 64-byte aligned so it can be read in place from a memory mapping.
+ *
+ *   SnapshotHeader
+ *   SnapshotChunkEntry[chunkCount]   sorted by (x, z, y) so a column is contiguous
+ *   per chunk: BlockId palette[paletteSize], uint64_t indices[...]
+ */
+struct SnapshotHeader
+{
+    static constexpr std::uint32_t MAGIC = 0x574B4C53; // "SLKW"
+    static constexpr std::uint32_t VERSION = 1;
+
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t chunkSize;
+    std::uint32_t chunkCount;
+    std::uint64_t tableOffset;
+    std::uint64_t reserved[5];
+};
+
+struct SnapshotChunkEntry
+{
+    std::int32_t x, y, z;
+    std::uint16_t paletteSize;
+    std::uint8_t bitsPerIndex;
+    std::uint8_t reserved;
+    std::uint64_t paletteOffset;
+    std::uint64_t indexOffset;
+};
+
+static_assert(sizeof(SnapshotHeader) == 64, "Snapshot header layout changed");
+static_assert(sizeof(SnapshotChunkEntry) == 32, "Snapshot chunk entry layout changed");
+
+/**
+ * Zero-copy read access to a chunk stored in a snapshot. Indices are packed with a
+ * power-of-two bit width so an index never straddles two words.
+ */
+class SnapshotChunkView
+{
+public:
+    SnapshotChunkView() = default;
+    SnapshotChunkView(const SnapshotChunkEntry* entry, const BlockId* palette,
+                      const std::uint64_t* indices);
+
+    [[nodiscard]] bool IsValid() const { return m_entry != nullptr; }
+    [[nodiscard]] ChunkCoord GetCoord() const { return {m_entry->x, m_entry->y, m_entry->z}; }
+
+    [[nodiscard]] BlockId GetBlock(int index) const
+    {
+        if (m_bits == 0)
+            return m_palette[0];
+
+        const auto bit = static_cast<std::uint32_t>(index) * m_bits;
+        return m_palette[std::min((m_indices[bit >> 6] >> (bit & 63)) & m_mask, m_lastIndex)];
+    }
+
+    [[nodiscard]] BlockId GetBlock(int x, int y, int z) const
+    {
+        return GetBlock(Chunk::Index(x, y, z));
+    }
+
+    /**
+     * Decode the whole chunk into dense editable storage
+     */
+    void CopyTo(Chunk& chunk) const;
+
+private:
+    const SnapshotChunkEntry* m_entry = nullptr;
+    const BlockId* m_palette = nullptr;
+    const std::uint64_t* m_indices = nullptr;
+    std::uint32_t m_bits = 0;
+    std::uint64_t m_mask = 0;
+    std::uint64_t m_lastIndex = 0; // indices past the palette (corrupt files) read its last entry
+};
+
+/**
+ * Read-only baked world backed by a memory-mapped file. Opening only validates the
+ * header and offset table; chunk data is paged in by the OS when a chunk is first read,
+ * so load time scales with the render distance rather than the world size.
+ */
+class WorldSnapshot
+{
+public:
+    WorldSnapshot();
+    ~WorldSnapshot();
+
+    WorldSnapshot(const WorldSnapshot&) = delete;
+    WorldSnapshot& operator=(const WorldSnapshot&) = delete;
+
+    /**
+     * Write every non-empty chunk of the world to a snapshot file
+     * @return true if the file was written
+     */
+    static bool Bake(const World& world, const std::string& filename);
+
+    /**
+     * Map a snapshot file and validate its header and offset table
+     * @return true if the snapshot can be used
+     */
+    bool Open(const std::string& filename);
+
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const { return m_file.IsOpen(); }
+    [[nodiscard]] std::size_t GetChunkCount() const { return m_chunkCount; }
+
+    /**
+     * Look up a chunk; returns an invalid view if the snapshot does not contain it (all air)
+     */
+    [[nodiscard]] SnapshotChunkView FindChunk(const ChunkCoord& coord) const;
+
+    /**
+     * Copy every stored chunk of a column into the world
+     * @return Number of chunks loaded
+     */
+    std::size_t LoadColumn(World& world, int chunkX, int chunkZ) const;
+
+    /**
+     * Load the columns within radius of center into the world, nearest first
+     * @return Number of chunks loaded
+     */
+    std::size_t LoadAround(World& world, const ChunkCoord& center, int radius) const;
+
+    /**
+     * Load columns that will only be drawn at a reduced level of detail, like
+     * TerrainGenerator::GenerateLodColumns: chunks are decoded on the job system and only
+     * their downsampled data is kept
+     * @return Number of chunks added to the store
+     */
+    std::size_t LoadLodColumns(JobSystem& jobs, LodStore& store, const std::vector<ChunkCoord>& columns) const;
+
+private:
+    MappedFile m_file;
+    const SnapshotChunkEntry* m_entries;
+    std::size_t m_chunkCount;
+
+    /**
+     * Find the contiguous range of entries belonging to a column
+     */
+    void FindColumn(int chunkX, int chunkZ, const SnapshotChunkEntry*& begin,
+                    const SnapshotChunkEntry*& end) const;
+
+    [[nodiscard]] SnapshotChunkView MakeView(const SnapshotChunkEntry& entry) const;
+};
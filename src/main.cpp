@@ -15,6 +15,14 @@ int main(int argc, char* argv[])
     
     std::cout << "Loading configuration from config.ini..." << std::endl;
     config.LoadFromFile("config.ini");
+
+    // command line overrides (e.g. --headless --engine.frames=1000) are for this run only
+    const bool hasOverrides = argc > 1;
+    if (hasOverrides && !config.ApplyArguments(argc, argv))
+    {
+        std::cerr << "Usage: silk [--headless] [--key=value ...]" << std::endl;
+        return 1;
+    }
     
     std::cout << "Loaded config values:" << std::endl;
     std::cout << "  Window Title: " << config.GetWindowTitle() << std::endl;
@@ -51,7 +59,7 @@ int main(int argc, char* argv[])
 
     int exitCode = engine.Run();
 
-    if (!config.SaveToFile("config.ini"))
+    if (!hasOverrides && !config.SaveToFile("config.ini"))
     {
         std::cerr << "Failed to save config ini" << std::endl;
         return -1;